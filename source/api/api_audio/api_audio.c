@@ -16,7 +16,16 @@
 
 #include "api_data.h"
 #include "bsp_i2s.h"
+#include "bsp_mcu.h"
+#include "crc32.h"
 #include "drv_amplifier.h"
+#include "dsp_adpcm.h"
+#include "dsp_chain.h"
+#include "dsp_gain.h"
+#include "dsp_osc.h"
+#include "dsp_pcm.h"
+#include "dsp_resampler.h"
+#include "spsc_queue.h"
 
 #include "log.h"
 
@@ -24,34 +33,221 @@ LOG_MODULE_NAME("API_AUDIO");
 
 #include "drv_flash.h" // TODO
 
+#if defined(API_AUDIO_PROFILE)
+#include "audio_profile.h"
+#endif
 
 /*******************************************************************************
  * Macros
  ******************************************************************************/
 
 /**
- * @brief This macro indicates the audio buffer size.
+ * @brief These macros mark the timed stages of the pipeline. The host build
+ *        (tools/audio_bench) defines them, they are empty on the target.
  *
- * https://codebeamer.daiichi.com/issue/194275
+ */
+#if !defined(API_AUDIO_PROFILE)
+#define AUDIO_PROFILE_BEGIN(stage)
+#define AUDIO_PROFILE_END(stage)
+#endif
+
+/**
+ * @brief This macro indicates the size of one stereo frame in the audio
+ *        buffer.
+ *
+ */
+#define AUDIO_FRAME_SIZE (DSP_RESAMPLER_CH_CNT * sizeof(int32_t))
+
+/**
+ * @brief This macro indicates the frame count played from one ring slot (2 ms
+ *        at 16 kHz). The input buffer holds the resampler input of one slot,
+ *        so the pitch can be raised up to DSP_RESAMPLER_STEP_MAX. The input
+ *        buffer of layer 0 also receives the calibration curve and the loop
+ *        start for the crossfade while the audio is loaded, it holds both
+ *        from 32 frames on.
+ *
+ */
+#define AUDIO_BLOCK_FRAME_CNT (32U)
+
+#if (32U > AUDIO_BLOCK_FRAME_CNT)
+#error "Audio block frame count not config properly"
+#endif
+
+/**
+ * @brief This macro indicates the byte count played from one ring slot.
+ *
+ */
+#define AUDIO_BLOCK_SIZE (AUDIO_BLOCK_FRAME_CNT * AUDIO_FRAME_SIZE)
+
+/**
+ * @brief This macro indicates the slot count of the playback ring. Each slot
+ *        holds AUDIO_BLOCK_SIZE bytes, so one more slot costs 280 bytes of RAM
+ *        and gives one more block (2 ms at 16 kHz) of underrun headroom.
+ *
+ */
+#if !defined(AUDIO_CONF_RING_SLOT_CNT)
+#define AUDIO_CONF_RING_SLOT_CNT (4U)
+#endif
+
+#if (2U > AUDIO_CONF_RING_SLOT_CNT) || \
+    (BSP_I2S_RING_SLOT_MAX < AUDIO_CONF_RING_SLOT_CNT)
+#error "Audio ring slot count not config properly"
+#endif
+
+/**
+ * @brief This macro indicates the input block count of the pipeline. With two
+ *        blocks the flash read of a block overlaps the edit of the previous
+ *        one, each block costs AUDIO_BUFF_SIZE bytes of RAM. The RAM of the
+ *        S32K116 leaves room for one block.
+ *
+ */
+#if !defined(AUDIO_CONF_BLOCK_CNT)
+#define AUDIO_CONF_BLOCK_CNT (1U)
+#endif
+
+/**
+ * @brief This macro indicates that no input block is being read.
+ *
+ */
+#define AUDIO_BLOCK_NONE (AUDIO_CONF_BLOCK_CNT)
+
+/**
+ * @brief This macro indicates that a block read directly to a ring slot has
+ *        not taken its slot yet.
+ *
+ */
+#define AUDIO_SLOT_NONE (AUDIO_CONF_RING_SLOT_CNT)
+
+/**
+ * @brief This macro indicates the crossfade length at the loop wrap in frames
+ *        (2 ms at 16 kHz). The crossfade is skipped for a loop shorter than
+ *        twice this length.
+ *
+ */
+#define AUDIO_CONF_XFADE_FRAME_CNT (32U)
+
+/**
+ * @brief This macro indicates the sample rate of the audio in Hz when the
+ *        configuration table gives none. The ring slots are sized for it, a
+ *        lower rate plays fewer frames per slot to keep the slot length.
+ *
+ */
+#define AUDIO_SAMPLE_RATE (BSP_I2S_SAMPLE_RATE_DEFAULT)
+
+/**
+ * @brief This macro indicates the oscillator count of a synthesized audio.
+ *
+ */
+#define AUDIO_CONF_OSC_CNT (3U)
+
+/**
+ * @brief This macro indicates the layer count of the mixer. Layer 0 plays the
+ *        audio selected by api_audio_switch(), the other layers are set by
+ *        api_audio_layer_set(). The input blocks and the ring slots are shared,
+ *        each layer costs about 1.1 KB of RAM for its decoded table, crossfade
+ *        and resampler state, and one more resampler pass per block. The
+ *        S32K116 build plays layer 0 only.
+ *
+ */
+#if !defined(AUDIO_CONF_LAYER_CNT)
+#define AUDIO_CONF_LAYER_CNT (1U)
+#endif
+
+#if (1U > AUDIO_CONF_LAYER_CNT) || (API_AUDIO_LAYER_MAX < AUDIO_CONF_LAYER_CNT)
+#error "Audio layer count not config properly"
+#endif
+
+/**
+ * @brief This macro enables the standby layer loaded by api_audio_prefetch().
+ *        It costs about 1.2 KB of RAM, so the S32K116 build reads a switched
+ *        audio from the flash instead.
+ *
+ */
+#if !defined(AUDIO_CONF_STANDBY)
+#define AUDIO_CONF_STANDBY (0U)
+#endif
+
+#if (1U < AUDIO_CONF_STANDBY)
+#error "Audio standby layer not config properly"
+#endif
+
+/**
+ * @brief This macro indicates that layers other than layer 0 are loaded, the
+ *        mixer layers or the standby layer.
+ *
+ */
+#define AUDIO_LAYER_LOAD \
+    ((1U < AUDIO_CONF_LAYER_CNT) || (1U == AUDIO_CONF_STANDBY))
+
+/**
+ * @brief This macro indicates that no layer is being loaded.
+ *
+ */
+#define AUDIO_LAYER_NONE (AUDIO_CONF_LAYER_CNT)
+
+/**
+ * @brief This macro indicates that the standby layer is being loaded.
  *
  */
-#define AUDIO_BUFF_SIZE (2048U)
+#define AUDIO_LAYER_STANDBY (AUDIO_CONF_LAYER_CNT + 1U)
 
 /**
- * @brief This macro indicates the audio mute buffer size.
+ * @brief These macros indicate the attack and the release times of the output
+ *        envelope in milliseconds when the speaker chain table gives none.
  *
- * https://codebeamer.daiichi.com/issue/194276
+ */
+#define AUDIO_CONF_FADE_ATTACK_MS (20U)
+#define AUDIO_CONF_FADE_RELEASE_MS (50U)
+
+/**
+ * @brief This macro indicates the External Flash bandwidth in bytes per second
+ *        the layers may take together at their highest pitch. The SPI runs at
+ *        4 MHz (500000 B/s), the rest is left to the read commands.
+ *
+ */
+#define AUDIO_CONF_SPI_BUDGET (400000U)
+
+/**
+ * @brief This macro indicates the crossfade length at the loop wrap in bytes.
+ *
+ */
+#define AUDIO_XFADE_SIZE (AUDIO_CONF_XFADE_FRAME_CNT * AUDIO_FRAME_SIZE)
+
+/**
+ * @brief This macro indicates the interpolation mode of the pitch shifter.
+ *        DSP_RESAMPLER_MODE_CUBIC gives a cleaner sound at about twice the
+ *        CPU load.
+ *
+ */
+#define AUDIO_CONF_RESAMPLER_MODE (DSP_RESAMPLER_MODE_LINEAR)
+
+/**
+ * @brief This macro indicates the limiter threshold step (-1 dB) in Q15 format
+ *        taken at each amplifier report with clipping.
+ *
+ */
+#define AUDIO_AMP_CLIP_STEP_Q15 (29205U)
+
+/**
+ * @brief This macro indicates the lowest limiter threshold (-12 dB) the
+ *        amplifier reports may set in Q15 format.
  *
  */
-#define AUDIO_MUTE_BUFF_SIZE (100U)
+#define AUDIO_AMP_BACKOFF_MIN_Q15 (8231U)
 
 /**
- * @brief This macro indicates the default value of the audio shifting rate.
+ * @brief This macro indicates the limiter threshold step (+0.5 dB) in Q15
+ *        format taken back after AUDIO_AMP_RECOVER_CNT clean reports.
  *
- * https://codebeamer.daiichi.com/issue/194286
+ */
+#define AUDIO_AMP_RECOVER_STEP_Q15 (34712U)
+
+/**
+ * @brief This macro indicates the clean amplifier report count of one
+ *        recovery step. Both amplifiers report every 300 ms, so it is 3 s.
  *
  */
-#define AUDIO_SHIFTING_RATE (1U)
+#define AUDIO_AMP_RECOVER_CNT (20U)
 
 /**
  * @brief This macro indicates the Audio calculation rate.
@@ -59,15 +255,47 @@ LOG_MODULE_NAME("API_AUDIO");
  * https://codebeamer.daiichi.com/issue/195752
  *
  */
-#define AUDIO_GAIN_CALC_RATE (1000.0)
+#define AUDIO_GAIN_CALC_RATE (1000U)
+
+/**
+ * @brief This macro indicates the size of one PCM sample in the audio buffer.
+ *        The audio is stored as interleaved 32-bit stereo samples.
+ *
+ */
+#define AUDIO_SAMPLE_SIZE (sizeof(int32_t))
+
+/**
+ * @brief This macro indicates the audio buffer size, the resampler input of
+ *        one block resampled in place.
+ *
+ * https://codebeamer.daiichi.com/issue/194275
+ *
+ */
+#define AUDIO_BUFF_SIZE                                          \
+    (DSP_RESAMPLER_INPLACE_FRAME_CNT(AUDIO_BLOCK_FRAME_CNT) *    \
+     AUDIO_FRAME_SIZE)
 
 /**
- * @brief This macro indicates the audio offset value in the External Flash.
+ * @brief This macro indicates the audio buffer size in 32-bit words. Buffers
+ *        are declared as words to keep the samples 32-bit aligned.
  *
- * https://codebeamer.daiichi.com/issue/194315
+ */
+#define AUDIO_BUFF_WORD_CNT (AUDIO_BUFF_SIZE / AUDIO_SAMPLE_SIZE)
+
+/**
+ * @brief This macro indicates the ring slot size in 32-bit words.
+ *
+ */
+#define AUDIO_BLOCK_WORD_CNT (AUDIO_BLOCK_SIZE / AUDIO_SAMPLE_SIZE)
+
+/**
+ * @brief This macro indicates the ring slot storage in 32-bit words. A block
+ *        read directly to a slot is stored DSP_RESAMPLER_DELAY_CNT frames into
+ *        it, so these frames are kept after the played part of the slot.
  *
  */
-#define AUDIO_OFFSET (API_DATA_AUDIO_CFG_TBL_SIZE + API_DATA_AUDIO_DEFAULT_SIZE)
+#define AUDIO_SLOT_WORD_CNT \
+    (AUDIO_BLOCK_WORD_CNT + (DSP_RESAMPLER_DELAY_CNT * DSP_RESAMPLER_CH_CNT))
 
 /**
  * @brief This macro indicates the audio name (Audio File Name) parameter size
@@ -244,6 +472,243 @@ LOG_MODULE_NAME("API_AUDIO");
  */
 #define CFG_TBL_FREQ_OFFSET (CFG_TBL_GAIN_OFFSET + CFG_TBL_GAIN_PARAM_SIZE)
 
+/**
+ * @brief This macro indicates the loop start (byte offset in the audio file)
+ *        offset in the reserved area of the audio configuration table.
+ *
+ */
+#define CFG_TBL_LOOP_START_OFFSET (CFG_TBL_RESERVED_OFFSET)
+
+/**
+ * @brief This macro indicates the loop end (byte offset in the audio file, not
+ *        included) offset in the reserved area of the audio configuration
+ *        table. Zero loops up to the end of the audio file.
+ *
+ */
+#define CFG_TBL_LOOP_END_OFFSET (CFG_TBL_LOOP_START_OFFSET + sizeof(uint32_t))
+
+/**
+ * @brief This macro indicates the audio format (see audio_format_t) offset in
+ *        the reserved area of the audio configuration table.
+ *
+ */
+#define CFG_TBL_FORMAT_OFFSET (CFG_TBL_LOOP_END_OFFSET + sizeof(uint32_t))
+
+/**
+ * @brief This macro indicates the stored bit depth (16 or 32, zero is 32) of
+ *        the PCM audio in the reserved area of the audio configuration table.
+ *
+ */
+#define CFG_TBL_BIT_DEPTH_OFFSET (CFG_TBL_FORMAT_OFFSET + 1U)
+
+/**
+ * @brief This macro indicates the stored channel count (1 or 2, zero is 2) of
+ *        the PCM audio in the reserved area of the audio configuration table.
+ *
+ */
+#define CFG_TBL_CH_CNT_OFFSET (CFG_TBL_BIT_DEPTH_OFFSET + 1U)
+
+/**
+ * @brief This macro indicates the first oscillator offset of a synthesized
+ *        audio in the reserved area of the audio configuration table.
+ *
+ */
+#define CFG_TBL_OSC_OFFSET (CFG_TBL_CH_CNT_OFFSET + 2U)
+
+/**
+ * @brief This macro indicates the size of one oscillator entry: wavetable
+ *        (uint8_t), level (uint8_t, 255 is unity) and frequency in Hz
+ *        (big-endian uint16_t).
+ *
+ */
+#define CFG_TBL_OSC_SIZE (4U)
+
+/**
+ * @brief This macro indicates the oscillator level of the configuration
+ *        table which is unity.
+ *
+ */
+#define CFG_TBL_OSC_LEVEL_MAX (255U)
+
+/**
+ * @brief This macro indicates the CRC-32 offset (big-endian uint32_t) of a
+ *        sampled audio in the reserved area of the audio configuration table.
+ *        A sampled audio has no oscillators, so the CRC takes the place of the
+ *        first one. It covers the stored audio from its start to the loop
+ *        end, zero is no CRC.
+ *
+ */
+#define CFG_TBL_CRC_OFFSET (CFG_TBL_OSC_OFFSET)
+
+/**
+ * @brief This macro indicates the part count of the CRC check: the audio up
+ *        to the loop crossfade, read by the first pass of the playback, and
+ *        the loop tail, read for the crossfade when the audio is loaded.
+ *
+ */
+#define AUDIO_CRC_PART_CNT (2U)
+
+/**
+ * @brief This macro indicates the DTC value set when an audio does not match
+ *        its CRC.
+ *
+ */
+#define AUDIO_CRC_DTC (1U)
+
+/**
+ * @brief This macro indicates the speaker chain table offset (big-endian
+ *        uint32_t) in the reserved area of the audio configuration table. It
+ *        is the byte offset of the table in the audio of the slot, zero keeps
+ *        both chains flat. Only the table of the played audio is used.
+ *
+ */
+#define CFG_TBL_CHAIN_OFFSET \
+    (CFG_TBL_OSC_OFFSET + (AUDIO_CONF_OSC_CNT * CFG_TBL_OSC_SIZE))
+
+/**
+ * @brief This macro indicates the gain offset in the speaker chain table. The
+ *        gains are big-endian uint16_t values per mille, one per channel, and
+ *        zero is unity.
+ *
+ */
+#define CHAIN_TBL_GAIN_OFFSET (0U)
+
+/**
+ * @brief This macro indicates the EQ stage count offset in the speaker chain
+ *        table, one uint8_t per channel.
+ *
+ */
+#define CHAIN_TBL_EQ_CNT_OFFSET \
+    (CHAIN_TBL_GAIN_OFFSET + (DSP_CHAIN_CH_CNT * sizeof(uint16_t)))
+
+/**
+ * @brief This macro indicates the EQ coefficient offset in the speaker chain
+ *        table. Each channel has DSP_BIQUAD_STAGE_MAX stages of big-endian
+ *        Q14 coefficients (b0, b1, b2, a1, a2), the unused stages are skipped.
+ *
+ */
+#define CHAIN_TBL_EQ_COEF_OFFSET (CHAIN_TBL_EQ_CNT_OFFSET + DSP_CHAIN_CH_CNT)
+
+/**
+ * @brief This macro indicates the EQ coefficient count of one channel in the
+ *        speaker chain table.
+ *
+ */
+#define CHAIN_TBL_EQ_COEF_CNT (DSP_BIQUAD_STAGE_MAX * DSP_BIQUAD_COEF_CNT)
+
+/**
+ * @brief This macro indicates the limiter threshold offset in the speaker
+ *        chain table. The thresholds are big-endian uint16_t values per mille
+ *        of the full scale, one per channel, and zero is the full scale.
+ *
+ */
+#define CHAIN_TBL_LIMIT_OFFSET \
+    (CHAIN_TBL_EQ_COEF_OFFSET + \
+     (DSP_CHAIN_CH_CNT * CHAIN_TBL_EQ_COEF_CNT * sizeof(int16_t)))
+
+/**
+ * @brief This macro indicates the fade time offset in the speaker chain
+ *        table. The attack and the release times of the output envelope are
+ *        big-endian uint16_t values in milliseconds from silence to the full
+ *        scale, zero is the default time.
+ *
+ */
+#define CHAIN_TBL_FADE_OFFSET \
+    (CHAIN_TBL_LIMIT_OFFSET + (DSP_CHAIN_CH_CNT * sizeof(uint16_t)))
+
+/**
+ * @brief This macro indicates the size of the speaker chain table.
+ *
+ */
+#define CHAIN_TBL_SIZE (CHAIN_TBL_FADE_OFFSET + (2U * sizeof(uint16_t)))
+
+/**
+ * @brief This macro indicates the calibration curve offset (big-endian
+ *        uint32_t) in the reserved area of the audio configuration table. It
+ *        is the byte offset of the curve in the audio of the slot, zero keeps
+ *        the gain and frequency parameters of the table.
+ *
+ */
+#define CFG_TBL_CURVE_OFFSET (CFG_TBL_CHAIN_OFFSET + sizeof(uint32_t))
+
+/**
+ * @brief This macro indicates the breakpoint count offset (big-endian
+ *        uint16_t) in the calibration curve.
+ *
+ */
+#define CURVE_TBL_CNT_OFFSET (0U)
+
+/**
+ * @brief This macro indicates the first breakpoint offset in the calibration
+ *        curve. A breakpoint is the speed in 1/256 km/h, the gain and the
+ *        shifting rate of the table format, all big-endian uint16_t. The
+ *        speeds are strictly increasing.
+ *
+ */
+#define CURVE_TBL_POINT_OFFSET (CURVE_TBL_CNT_OFFSET + sizeof(uint16_t))
+
+/**
+ * @brief This macro indicates the size of one breakpoint of the calibration
+ *        curve.
+ *
+ */
+#define CURVE_TBL_POINT_SIZE (3U * sizeof(uint16_t))
+
+/**
+ * @brief This macro indicates the highest breakpoint count of the calibration
+ *        curve, the curve is read to the buffer of the table.
+ *
+ */
+#define CURVE_TBL_POINT_MAX (64U)
+
+/**
+ * @brief This macro indicates the highest size of the calibration curve.
+ *
+ */
+#define CURVE_TBL_SIZE_MAX \
+    (CURVE_TBL_POINT_OFFSET + (CURVE_TBL_POINT_MAX * CURVE_TBL_POINT_SIZE))
+
+/**
+ * @brief This macro indicates the sample rate offset (big-endian uint16_t, in
+ *        Hz) in the reserved area of the audio configuration table. It is
+ *        8000, 16000, 32000 or 48000, zero is AUDIO_SAMPLE_RATE.
+ *
+ */
+#define CFG_TBL_RATE_OFFSET (CFG_TBL_CURVE_OFFSET + sizeof(uint32_t))
+
+/**
+ * @brief This macro indicates that the ADPCM decoder state does not belong to
+ *        any frame of the audio.
+ *
+ */
+#define AUDIO_ADPCM_POS_NONE (UINT32_MAX)
+
+/**
+ * @brief This macro indicates the entry count (one per km/h) of the gain and
+ *        frequency parameters in the audio configuration table.
+ *
+ */
+#define CFG_TBL_ENTRY_CNT (CFG_TBL_GAIN_PARAM_SIZE / sizeof(uint16_t))
+
+/**
+ * @brief This macro indicates the breakpoint count of the decoded curve. The
+ *        parameters of the table are decoded to one breakpoint per km/h.
+ *
+ */
+#define AUDIO_CURVE_POINT_MAX (CFG_TBL_ENTRY_CNT)
+
+/**
+ * @brief This macro indicates whether the big-endian fields of the audio
+ *        configuration table are byte swapped on load. It is resolved at
+ *        compile time from the target byte order.
+ *
+ */
+#if defined(__BYTE_ORDER__) && (__ORDER_BIG_ENDIAN__ == __BYTE_ORDER__)
+#define CFG_TBL_BYTE_SWAP (0U)
+#else
+#define CFG_TBL_BYTE_SWAP (1U)
+#endif
+
 /*******************************************************************************
  * Enumerations
  ******************************************************************************/
@@ -276,8 +741,11 @@ typedef enum flash_read_state_e
     FLASH_READ_STATE_IDLE = 0U,
     FLASH_READ_STATE_INIT = 1U,
     FLASH_READ_STATE_CFG_TBL = 2U,
-    FLASH_READ_STATE_CURR_AUDIO_BUFF = 3U,
-    FLASH_READ_STATE_SPARE_AUDIO_BUFF = 4U,
+    FLASH_READ_STATE_AUDIO_BUFF = 3U,
+    FLASH_READ_STATE_XFADE_TAIL = 4U,
+    FLASH_READ_STATE_XFADE_HEAD = 5U,
+    FLASH_READ_STATE_CHAIN = 6U,
+    FLASH_READ_STATE_CURVE = 7U,
 
 } flash_read_state_t;
 
@@ -299,6 +767,18 @@ typedef enum buffer_state_e
 
 } buffer_state_t;
 
+/**
+ * @brief List of the audio formats of the audio slots.
+ *
+ */
+typedef enum audio_format_e
+{
+    AUDIO_FORMAT_PCM = 0U,
+    AUDIO_FORMAT_ADPCM = 1U,
+    AUDIO_FORMAT_SYNTH = 2U,
+
+} audio_format_t;
+
 /*******************************************************************************
  * Structs
  ******************************************************************************/
@@ -312,43 +792,311 @@ typedef enum buffer_state_e
  */
 typedef struct audio_param_s
 {
-    uint8_t curr_audio;
-
     bool mute;
 
     bool play;
 
     audio_state_t state;
 
-    uint32_t cursor;
-    uint32_t size;
+    uint16_t speed;
 
-    uint32_t audio_addr;
-    uint32_t cfg_tbl_addr;
+    uint32_t fill_cnt;
 
-    uint16_t curr_gain;
-    uint16_t max_sample_cnt;
+    uint32_t read_block;
+
+    uint32_t job_layer;
+    uint32_t job_mask;
+    uint32_t mix_slot;
+
+    uint32_t load_layer;
+
+    bool swap;
+    bool swap_fade;
+    bool swap_head;
+    bool mix_head;
+
+    bool job_silent;
+    uint32_t mix_fade;
+    uint32_t mix_fade_end;
+
+    uint32_t sample_rate;
+    uint32_t frame_cnt;
+
+    bool ring_run;
+    bool ring_silent;
+    uint32_t silent_cnt;
 
 } audio_param_t;
 
 /**
- * @brief Data structure corresponds to the audio buffer related parameters.
- *
- * https://codebeamer.daiichi.com/issue/194338
- * https://codebeamer.daiichi.com/issue/194343
+ * @brief Data structure corresponds to one breakpoint of the decoded curve.
+ *        The speed is in 1/256 km/h, the gain is in Q15 format and the rate
+ *        is the signed shifting rate of the table.
  *
  */
-typedef struct audio_buff_s
+typedef struct audio_curve_point_s
 {
-    uint8_t *p_buff;
-    uint32_t max_size;
-    uint32_t cur_size;
-    uint16_t shifting_rate;
-    buffer_state_t buff_state;
+    uint16_t speed;
+    uint16_t gain_q15;
+    int16_t rate;
 
-} audio_buff_t;
+} audio_curve_point_t;
 
-// PRQA S 3108 --
+/**
+ * @brief Data structure corresponds to the decoded audio configuration table.
+ *        The table is decoded once when it is read, so the speed path only
+ *        searches the breakpoints of the curve.
+ *
+ */
+typedef struct audio_cfg_s
+{
+    audio_format_t format;
+
+    uint32_t bit_depth;
+    uint32_t ch_cnt;
+    uint32_t frame_size;
+
+    uint32_t size;
+
+    uint32_t loop_start;
+    uint32_t loop_end;
+    uint32_t xfade_start;
+
+    uint32_t chain_offset;
+
+    audio_curve_point_t curve[AUDIO_CURVE_POINT_MAX];
+    uint32_t curve_cnt;
+    uint32_t curve_offset;
+
+    uint32_t step_max;
+
+    uint32_t sample_rate;
+
+    uint16_t max_sample_cnt;
+
+    bool standstill;
+
+} audio_cfg_t;
+
+/**
+ * @brief Data structure corresponds to the audio read in progress. The stored
+ *        frames are converted to 32-bit stereo frames once the flash read
+ *        ends. The raw bytes and their offset in the stored audio are kept
+ *        for the CRC check until then.
+ *
+ */
+typedef struct audio_read_s
+{
+    struct audio_layer_s *p_layer;
+
+    int32_t *p_out;
+
+    const uint8_t *p_in;
+
+    uint32_t cnt;
+
+    bool pending;
+
+    const uint8_t *p_raw;
+    uint32_t raw_offset;
+    uint32_t raw_size;
+
+} audio_read_t;
+
+/**
+ * @brief Data structure corresponds to the ADPCM decoding of the audio. The
+ *        coded frames are read to the staging buffer.
+ *
+ */
+typedef struct audio_adpcm_s
+{
+    dsp_adpcm_t dec;
+
+    uint32_t pos;
+    uint32_t skip;
+
+    bool hdr;
+
+} audio_adpcm_t;
+
+/**
+ * @brief Data structure corresponds to the CRC check of a sampled audio. Each
+ *        part is taken on from its position in the stored audio, so the bytes
+ *        read again after a seek are skipped and a part is complete once its
+ *        bytes have been read in order. The audio is checked once when both
+ *        parts are complete.
+ *
+ */
+typedef struct audio_crc_s
+{
+    uint32_t expect;
+
+    uint32_t crc[AUDIO_CRC_PART_CNT];
+    uint32_t pos[AUDIO_CRC_PART_CNT];
+    uint32_t end[AUDIO_CRC_PART_CNT];
+
+    bool done;
+
+} audio_crc_t;
+
+/**
+ * @brief Data structure corresponds to one layer of the mixer. Each layer
+ *        plays its own audio slot with its own pitch and gain curves.
+ *
+ */
+typedef struct audio_layer_s
+{
+    audio_cfg_t cfg;
+
+    audio_crc_t crc;
+
+    dsp_resampler_t resampler;
+
+    audio_adpcm_t adpcm;
+
+    dsp_osc_t osc[AUDIO_CONF_OSC_CNT];
+
+    int32_t xfade_buff[AUDIO_CONF_XFADE_FRAME_CNT * DSP_RESAMPLER_CH_CNT];
+
+    flash_read_state_t state;
+
+    uint8_t audio;
+
+    bool ready;
+
+    uint32_t audio_addr;
+    uint32_t cfg_tbl_addr;
+    uint32_t slot_size;
+
+    uint32_t cursor;
+
+    uint32_t step;
+    uint32_t gain;
+    uint32_t level;
+
+    uint32_t plan_step;
+    uint32_t plan_phase;
+    uint32_t plan_gain;
+
+    uint32_t xfade_fill;
+
+} audio_layer_t;
+
+/**
+ * @brief Data structure corresponds to the standby layer. It holds the audio
+ *        loaded by api_audio_prefetch() and its speaker chain table until it
+ *        is swapped with layer 0.
+ *
+ */
+typedef struct audio_standby_s
+{
+    audio_layer_t layer;
+
+    uint8_t chain_tbl[CHAIN_TBL_SIZE];
+
+    bool chain;
+
+} audio_standby_t;
+
+/**
+ * @brief Data structure corresponds to the amplifier diagnostics feeding the
+ *        limiters. The flags are collected until the next report ends.
+ *
+ */
+typedef struct audio_amp_s
+{
+    uint32_t backoff;
+    uint32_t tw_ceil;
+    uint32_t clean_cnt;
+
+    bool clip;
+
+} audio_amp_t;
+
+/**
+ * @brief Data structure corresponds to the playback diagnostics. The underrun
+ *        count of the ring restarts with the ring, so the counts of the
+ *        stopped rings are kept in the base. The headroom is in microseconds.
+ *        A switch is timed from its tick while it waits for its first slot,
+ *        the latencies are in milliseconds. The I2S interrupt counts of the
+ *        stopped rings are kept in the bases as well, the silence time is in
+ *        milliseconds.
+ *
+ */
+typedef struct audio_diag_s
+{
+    uint32_t underrun_base;
+    uint32_t late_cnt;
+    uint32_t refill_cnt;
+    uint32_t headroom_min;
+
+    uint32_t switch_tick;
+    uint32_t switch_cnt;
+    uint32_t switch_fast_cnt;
+    uint32_t switch_last;
+    uint32_t switch_max;
+
+    bool switch_wait;
+    bool switch_fast;
+
+    uint32_t irq_base[BSP_I2S_MODE_CNT];
+    uint32_t silence_tick;
+    uint32_t silence_cnt;
+    uint32_t silence_time;
+
+    uint32_t crc_ok_cnt;
+    uint32_t crc_fail_cnt;
+
+    uint32_t block_direct_cnt;
+    uint32_t block_edit_cnt;
+
+} audio_diag_t;
+
+/**
+ * @brief Data structure corresponds to the gain envelope of the output. The
+ *        gain in Q15 format is reached at the end of the last planned slot,
+ *        the attack and the release times are in milliseconds.
+ *
+ */
+typedef struct audio_fade_s
+{
+    uint32_t gain;
+    uint32_t attack;
+    uint32_t release;
+
+} audio_fade_t;
+
+/**
+ * @brief Data structure corresponds to the audio buffer related parameters.
+ *
+ * https://codebeamer.daiichi.com/issue/194338
+ * https://codebeamer.daiichi.com/issue/194343
+ *
+ */
+typedef struct audio_buff_s
+{
+    uint8_t *p_buff;
+    uint32_t slot;
+    uint32_t layer;
+    bool last;
+    bool head;
+    uint32_t max_size;
+    uint32_t cur_size;
+    uint32_t step;
+    int32_t step_inc;
+    uint32_t phase;
+    uint32_t in_cnt;
+    uint32_t fill;
+    uint32_t gain;
+    uint32_t gain_end;
+    uint32_t fade;
+    uint32_t fade_end;
+    bool direct;
+    buffer_state_t buff_state;
+
+} audio_buff_t;
+
+// PRQA S 3108 --
 
 /*******************************************************************************
  * Private Variables
@@ -356,29 +1104,33 @@ typedef struct audio_buff_s
 
 /**
  * @brief Holds the sample of the audio file in the External Flash up to
- *        AUDIO_BUFF_SIZE.
+ *        AUDIO_BUFF_SIZE. Each input block is the resampler input of one slot.
  *
  * https://codebeamer.daiichi.com/issue/194344
  *
  */
-static uint8_t m_audio_buff_1[AUDIO_BUFF_SIZE] = {0U};
+static uint32_t
+    m_audio_in_buff[AUDIO_CONF_BLOCK_CNT][AUDIO_BUFF_WORD_CNT] = {0U};
 
 /**
- * @brief Holds the sample of the audio file in the External Flash up to
- *        AUDIO_BUFF_SIZE.
- *
- * https://codebeamer.daiichi.com/issue/194345
+ * @brief Holds the slots of the playback ring. They are played in order by
+ *        the eDMA and refilled once played.
  *
  */
-static uint8_t m_audio_buff_2[AUDIO_BUFF_SIZE] = {0U};
+static uint32_t
+    m_audio_slot_buff[AUDIO_CONF_RING_SLOT_CNT][AUDIO_SLOT_WORD_CNT] = {0U};
 
 /**
- * @brief Holds the zeros to be played in mute state.
+ * @brief Holds the coded frames of one ADPCM read, at most one block.
  *
- * https://codebeamer.daiichi.com/issue/194346
+ */
+static uint32_t m_audio_adpcm_buff[(DSP_ADPCM_BLOCK_SIZE + 3U) / 4U] = {0};
+
+/**
+ * @brief Holds the audio read in progress.
  *
  */
-static uint8_t m_audio_mute_buff[AUDIO_MUTE_BUFF_SIZE] = {0U};
+static audio_read_t m_audio_read = {0};
 
 /**
  * @brief Holds parameters of the configuration table.
@@ -388,43 +1140,156 @@ static uint8_t m_audio_mute_buff[AUDIO_MUTE_BUFF_SIZE] = {0U};
  */
 static uint8_t m_audio_cfg_tbl[API_DATA_AUDIO_CFG_TBL_SIZE] = {0U};
 
+/**
+ * @brief Holds the configuration table of the layer being loaded. The table
+ *        is only read to be decoded, then the buffer receives the start of the
+ *        loop for the crossfade.
+ *
+ */
+#if (1U == AUDIO_LAYER_LOAD)
+static uint32_t
+    m_audio_layer_tbl[(API_DATA_AUDIO_CFG_TBL_SIZE + 3U) / 4U] = {0U};
+#endif
+
+/**
+ * @brief Holds the layers of the mixer. The crossfade buffer of a layer holds
+ *        the end of its loop crossfaded with the start of the loop, and the
+ *        oscillators render a synthesized audio instead of the flash.
+ *
+ */
+static audio_layer_t m_audio_layer[AUDIO_CONF_LAYER_CNT] = {0U};
+
+/**
+ * @brief Holds the standby layer. It is loaded after the layers of the mixer
+ *        and is not mixed, a switch to its audio swaps it with layer 0.
+ *
+ */
+#if (1U == AUDIO_CONF_STANDBY)
+static audio_standby_t m_audio_standby = {0U};
+#endif
+
+/**
+ * @brief Holds the processing chains of the speakers. They are set by the
+ *        table of the played audio and run on the mix of the layers.
+ *
+ */
+static dsp_chain_t m_audio_chain = {0U};
+
+/**
+ * @brief Holds the limiter thresholds of the speakers set by the table of the
+ *        played audio in Q15 format.
+ *
+ */
+static uint32_t m_audio_limit[DSP_CHAIN_CH_CNT] = {0U};
+
+/**
+ * @brief Holds the gain envelope of the output. It is applied after the
+ *        speaker chains, a silenced output is not read from the flash.
+ *
+ */
+static audio_fade_t m_audio_fade = {0U};
+
+/**
+ * @brief Holds the state of the amplifier diagnostics.
+ *
+ */
+static audio_amp_t m_audio_amp = {0U};
+
+/**
+ * @brief Holds the playback diagnostics.
+ *
+ */
+static audio_diag_t m_audio_diag = {0U};
+
+/**
+ * @brief Holds the limiter ceilings of the thermal warnings in Q15 format,
+ *        from DRV_AMPLIFIER_DIAG_ERR_TW_1 (the hottest, -9 dB) to
+ *        DRV_AMPLIFIER_DIAG_ERR_TW_4 (-1 dB).
+ *
+ */
+static const uint32_t m_audio_amp_tw_ceil[] = {11627U, 16423U, 23198U, 29205U};
+
 /**
  * @brief Holds the API audio module parameters.
  *
  * https://codebeamer.daiichi.com/issue/194362
  *
  */
-static audio_param_t m_audio_param = {0U};
+static audio_param_t m_audio_param = {
+    .sample_rate = AUDIO_SAMPLE_RATE,
+    .frame_cnt = AUDIO_BLOCK_FRAME_CNT,
+};
+
+/**
+ * @brief Holds the sample rates supported by the I2S and the amplifiers.
+ *
+ */
+static const uint32_t m_audio_sample_rate[] = {8000U, 16000U, 32000U, 48000U};
 
 /**
- * @brief Holds the current audio related parameters.
+ * @brief Holds the parameters of the input blocks.
  *
  * https://codebeamer.daiichi.com/issue/194348
  *
  */
-static audio_buff_t m_curr_buff = {
+static audio_buff_t m_audio_block[AUDIO_CONF_BLOCK_CNT] = {0U};
 
-    .p_buff = m_audio_buff_1,
-    .max_size = AUDIO_BUFF_SIZE,
-    .cur_size = AUDIO_BUFF_SIZE,
-    .shifting_rate = AUDIO_SHIFTING_RATE,
-    .buff_state = BUFFER_STATE_IDLE,
-};
+/**
+ * @brief Holds the storage of the read queue.
+ *
+ */
+static volatile uint32_t
+    m_audio_read_item[SPSC_QUEUE_STORAGE_SIZE(AUDIO_CONF_BLOCK_CNT)] = {0U};
 
 /**
- * @brief Holds the spare audio buffer related parameters.
+ * @brief Holds the storage of the edit queue.
  *
- * https://codebeamer.daiichi.com/issue/194349
+ */
+static volatile uint32_t
+    m_audio_edit_item[SPSC_QUEUE_STORAGE_SIZE(AUDIO_CONF_BLOCK_CNT)] = {0U};
+
+/**
+ * @brief Holds the storage of the slot queue.
  *
  */
-static audio_buff_t m_spare_buff = {
+static volatile uint32_t
+    m_audio_slot_item[SPSC_QUEUE_STORAGE_SIZE(AUDIO_CONF_RING_SLOT_CNT)] = {0U};
 
-    .p_buff = m_audio_buff_2,
-    .max_size = AUDIO_BUFF_SIZE,
-    .cur_size = AUDIO_BUFF_SIZE,
-    .shifting_rate = AUDIO_SHIFTING_RATE,
-    .buff_state = BUFFER_STATE_IDLE,
-};
+/**
+ * @brief Holds the input blocks waiting for a flash read. The edit stage
+ *        produces, the read stage consumes.
+ *
+ */
+static spsc_queue_t m_audio_read_queue = {0U};
+
+/**
+ * @brief Holds the input blocks read from the flash. The read stage produces,
+ *        the edit stage consumes.
+ *
+ */
+static spsc_queue_t m_audio_edit_queue = {0U};
+
+/**
+ * @brief Holds the played ring slots. The I2S interrupt produces, the edit
+ *        stage consumes.
+ *
+ */
+static spsc_queue_t m_audio_slot_queue = {0U};
+
+/**
+ * @brief Holds the flags of the ring slots owned by the slot queue or by the
+ *        edit stage. The I2S interrupt sets a flag when it queues the slot and
+ *        the edit stage clears it when the slot is committed.
+ *
+ */
+static volatile bool m_audio_slot_queued[AUDIO_CONF_RING_SLOT_CNT] = {false};
+
+/**
+ * @brief Holds the index of the ring slot being played. It is written by the
+ *        I2S interrupt only while the ring is running.
+ *
+ */
+static volatile uint32_t m_audio_play_slot = 0U;
 
 /**
  * @brief Holds the External flash read states.
@@ -455,7 +1320,8 @@ static bool m_api_audio_init = false;
  ******************************************************************************/
 
 /**
- * @brief This function returns the uint16_t variable from the given array.
+ * @brief This function returns the big-endian uint16_t variable of the
+ *        configuration table from the given array.
  *
  * @param[out] p_data Variable starting address inside of an array.
  *
@@ -467,7 +1333,8 @@ static bool m_api_audio_init = false;
 static inline uint16_t uint16_convert(const uint8_t *p_data);
 
 /**
- * @brief This function returns the uint32_t variable from the given array.
+ * @brief This function returns the big-endian uint32_t variable of the
+ *        configuration table from the given array.
 
  *
  * @param[out] p_data Variable starting address inside of an array.
@@ -480,761 +1347,4241 @@ static inline uint16_t uint16_convert(const uint8_t *p_data);
 static uint32_t uint32_convert(const uint8_t *p_data);
 
 /**
- * @brief This function provides to update the shifting rate according to the
- *        vehicle speed.
+ * @brief This function decodes the audio configuration table into the native
+ *        parameter structure. The gains are converted to Q15 and the shifting
+ *        rates to resampler steps here, once per table.
  *
- * @param[in] speed The vehicle speed.
- *
- * https://codebeamer.daiichi.com/issue/194435
+ * @param[out] p_layer Layer of the audio.
+ * @param[in]  p_tbl   Configuration table of the audio.
  *
  */
-static inline void shifting_rate_update(uint16_t speed);
+static void cfg_tbl_decode(audio_layer_t *p_layer, const uint8_t *p_tbl);
 
 /**
- * @brief This function provides to calculate the removed sample address in the
- *        audio buffer.
+ * @brief This function decodes the storage format of the audio and converts
+ *        the audio size to the size of the 32-bit stereo audio.
  *
- * @param[in] max_sample_cnt  The number of maximum edit parts of the buffer.
- * @param[in] shifting_rate The shifting rate.
+ * @param[out] p_layer Layer of the audio.
+ * @param[in]  p_tbl   Configuration table of the audio.
  *
- * @return uint32_t The to-be-removed sample address is in the audio buffer.
+ */
+static void cfg_tbl_format_decode(audio_layer_t *p_layer,
+                                  const uint8_t *p_tbl);
+
+/**
+ * @brief This function decodes the oscillators of a synthesized audio.
  *
- * https://codebeamer.daiichi.com/issue/194436
+ * @param[out] p_layer Layer of the audio.
+ * @param[in]  p_tbl   Configuration table of the audio.
  *
  */
-static inline uint32_t sample_pos_get(uint16_t max_sample_cnt,
-                                      uint16_t shifting_rate);
+static void cfg_tbl_osc_decode(audio_layer_t *p_layer, const uint8_t *p_tbl);
 
 /**
- * @brief This function provides to shift of the audio buffer.
+ * @brief This function decodes the sample rate of the audio.
  *
- * @param[in] p_audio Audio buffer structure.
- *
- * @return uint32_t The total number of samples to be removed.
+ * @param[in] p_tbl Configuration table of the audio.
  *
- * https://codebeamer.daiichi.com/issue/194261
+ * @return uint32_t Sample rate in Hz, AUDIO_SAMPLE_RATE for an unknown rate.
  *
  */
-static uint32_t audio_buff_freq_shift(const audio_buff_t *p_audio);
+static uint32_t cfg_tbl_rate_decode(const uint8_t *p_tbl);
 
 /**
- * @brief This function provides to edit dB of the audio buffer.
+ * @brief This function provides to update the shifting rate according to the
+ *        vehicle speed.
  *
- * @param[out] p_buff The audio buffer pointer.
- * @param[in]  size   The audio buffer size.
- * @param[in]  gain   The audio gain.
+ * @param[in,out] p_layer Layer of the audio.
+ * @param[in]     rate    The shifting rate interpolated at the vehicle speed.
  *
- * https://codebeamer.daiichi.com/issue/194437
+ * https://codebeamer.daiichi.com/issue/194435
  *
  */
-static inline void audio_buff_db_edit(uint8_t *p_buff,
-                                      uint32_t size,
-                                      uint16_t gain);
+static inline void shifting_rate_update(audio_layer_t *p_layer,
+                                        int32_t rate);
 
 /**
- * @brief This function provides to edit the audio buffer.
+ * @brief This function converts the shifting rate of the configuration table
+ *        to the resampler step. The legacy format drops "rate" bytes in every
+ *        "max_sample_cnt" bytes, which is a speed-up of cnt / (cnt - rate).
+ *        The rate is signed, a negative rate lowers the pitch.
  *
- * @param[out] p_audio The audio buffer structure pointer.
- * @param[in]  gain    The audio gain.
+ * @param[in] max_sample_cnt The frequency shift denominator.
+ * @param[in] shifting_rate  The frequency shift numerator.
  *
- * https://codebeamer.daiichi.com/issue/194263
+ * @return uint32_t Q16 resampler step.
  *
  */
-static void audio_buff_edit(audio_buff_t *p_audio, uint16_t gain);
+static inline uint32_t audio_step_get(uint16_t max_sample_cnt,
+                                      uint16_t shifting_rate);
 
 /**
- * @brief This function provides to update of the audio sample-related parameter
- *        such as gain and shifting rate.
+ * @brief This function provides to shift the frequency of the audio buffer.
+ *        The input frames stored at the end of the input buffer are resampled
+ *        to AUDIO_BLOCK_FRAME_CNT frames in the ring slot.
  *
- * @param[in] speed The vehicle speed.
+ * @param[in,out] p_layer Layer of the audio buffer.
+ * @param[in,out] p_audio Audio buffer structure.
+ * @param[out]    p_out   Output frames.
  *
- * https://codebeamer.daiichi.com/issue/194264
+ * https://codebeamer.daiichi.com/issue/194261
  *
  */
-static inline void audio_param_update(uint16_t speed);
+static void audio_buff_freq_shift(audio_layer_t *p_layer,
+                                  audio_buff_t *p_audio,
+                                  int32_t *p_out);
 
 /**
- * @brief This function provides the reset private variable.
+ * @brief This function resets the pitch shifter and its block planner.
  *
- * https://codebeamer.daiichi.com/issue/194260
+ * @param[out] p_layer Layer of the pitch shifter.
  *
  */
-static inline void local_var_reset(void);
+static inline void audio_resampler_reset(audio_layer_t *p_layer);
 
 /**
- * @brief This function updates the variable holding the play status of the module.
+ * @brief This function converts the gain of the configuration table to the
+ *        Q15 gain of the buffer.
  *
- * @param[in] status Audio module playing status.
+ * @param[in] gain The audio gain.
  *
- * https://codebeamer.daiichi.com/issue/195191
+ * @return uint32_t Q15 gain.
  *
  */
-static inline void audio_play_set(bool status);
+static inline uint32_t audio_gain_q15_get(uint16_t gain);
 
 /**
- * @brief This function gets the variable holding the play status of the module.
+ * @brief This function provides to edit dB of the audio buffer. The gain
+ *        ramps linearly from the start gain to the end gain over the buffer.
  *
- * @return bool Status of audio module play function.
- *
- * @retval true  The module is playing.
- * @retval false The module is not playing.
+ * @param[out] p_buff     The audio buffer pointer.
+ * @param[in]  size       The audio buffer size.
+ * @param[in]  gain_start The Q15 gain of the first frame.
+ * @param[in]  gain_end   The Q15 gain reached after the last frame.
  *
- * https://codebeamer.daiichi.com/issue/195192
+ * https://codebeamer.daiichi.com/issue/194437
  *
  */
-static inline bool audio_play_get(void);
+static inline void audio_buff_db_edit(uint8_t *p_buff,
+                                      uint32_t size,
+                                      uint32_t gain_start,
+                                      uint32_t gain_end);
 
 /**
- * @brief This function provides to get audio samples from the External Flash
- *        via api_data_read function.
+ * @brief This function provides to edit the audio buffer with the gain and
+ *        step ramps latched when its read was planned. The first layer of a
+ *        slot is written to the slot, the other layers are mixed into it.
  *
- * @param[out] p_buff Audio buffer pointer.
- * @param[in]  offset Specifies the sample which points by cursor parameter.
+ * @param[out] p_audio The audio buffer structure pointer.
  *
- * https://codebeamer.daiichi.com/issue/194262
+ * https://codebeamer.daiichi.com/issue/194263
  *
  */
-static inline void audio_buff_get(uint8_t *p_buff, 
-                                  uint32_t offset, 
-                                  uint32_t size);
+static void audio_buff_edit(audio_buff_t *p_audio);
 
 /**
- * @brief This function provides to manages audio buffers.
+ * @brief This function checks whether a block may be read directly to its
+ *        ring slot: it is the only layer of the slot, its frames are stored
+ *        as they are played and neither its pitch nor its gain is changed.
+ *        The edit stage is then skipped for the block.
  *
- * @param[out] pp_audio Audio buffer structure array pointer.
- * @param[in]  buff_cnt Buffer count.
+ * @param[in] p_layer Layer of the audio buffer.
+ * @param[in] p_audio Audio buffer structure with its latched ramps.
  *
- * https://codebeamer.daiichi.com/issue/194265
+ * @return bool Direct read status.
  *
  */
-static void audio_buff_check(audio_buff_t **pp_audio, uint32_t buff_cnt);
+static inline bool audio_buff_direct_get(const audio_layer_t *p_layer,
+                                         const audio_buff_t *p_audio);
 
 /**
- * @brief This function provides to manages the buffer-filling operations.
+ * @brief This function returns where the input of a block is read to. A
+ *        block read directly takes its ring slot first.
  *
- * https://codebeamer.daiichi.com/issue/194089
+ * @param[in,out] p_audio Audio buffer structure.
+ * @param[in]     size    Byte count of the input.
+ *
+ * @return uint8_t* Input buffer, NULL while the slot of the block is not free.
  *
  */
-static void flash_state_manager(void);
+static uint8_t *audio_buff_in_get(audio_buff_t *p_audio, uint32_t size);
 
 /**
- * @brief This function provides to check the audio buffer and flash are in the
- *        ready state.
- *
- * @return bool Audio init finish status.
- *
- * @retval true  The flash control state is in FLASH_READ_STATE_INIT
- * @return false Buffers are not in BUFFER_STATE_READY
+ * @brief This function checks whether the next block is to be read directly
+ *        to its ring slot while the slot is not free yet. The block is then
+ *        left in the read queue, so the other layers are loaded meanwhile.
  *
- * https://codebeamer.daiichi.com/issue/194439
+ * @return bool The read stage waits for a slot.
  *
  */
-static bool audio_init_state_check(void);
+static bool audio_direct_wait_get(void);
 
 /**
- * @brief This function provides to sends the buffer to the audio amplifier.
+ * @brief This function returns the ring slot of the next block of layer 0.
+ *        The free slots are taken in the order of the blocks of layer 0
+ *        queued for the edit stage.
  *
- * @param[in] p_buff The audio buffer pointer.
- * @param[in] size   The audio buffer size.
+ * @param[out] p_slot Ring slot.
  *
- * https://codebeamer.daiichi.com/issue/194253
+ * @return bool The slot is free.
  *
  */
-static inline bool audio_play(const uint8_t *p_buff, uint32_t size);
+static bool audio_direct_slot_get(uint32_t *p_slot);
 
 /**
- * @brief This function provides to check the buffer state.
+ * @brief This function provides to pass a block read directly to its ring
+ *        slot. Only the resampler history is moved.
  *
- * https://codebeamer.daiichi.com/issue/194259
+ * @param[in] p_audio Audio buffer structure.
  *
  */
-static void audio_run_state_check(void);
+static void audio_buff_bypass(audio_buff_t *p_audio);
 
 /**
- * @brief This function provides to manages the API audio module in the process.
+ * @brief This function provides to move a block read directly to another
+ *        ring slot than the one it is edited to back to its input buffer,
+ *        so it is edited as usual.
  *
- * https://codebeamer.daiichi.com/issue/194087
+ * @param[in,out] p_audio Audio buffer structure.
  *
  */
-static void state_manager(void);
+static void audio_buff_direct_drop(audio_buff_t *p_audio);
 
 /**
- * @brief This function provides to switch current buffer to the spare buffer.
+ * @brief This function provides to restore the planned resampler phase of a
+ *        block when a block has been dropped or its phase has been aligned.
  *
- * https://codebeamer.daiichi.com/issue/194488
+ * @param[in,out] p_layer Layer of the audio buffer.
+ * @param[in]     p_audio Audio buffer structure.
  *
  */
-static inline void audio_buff_curr_to_spare_switch(void);
+static inline void audio_resampler_sync(audio_layer_t *p_layer,
+                                        const audio_buff_t *p_audio);
 
 /**
- * @brief This function provides to switch current buffer to the mute buffer.
+ * @brief This function provides to latch the gain and step ramps of a buffer
+ *        at the block boundary. Each ramp starts where the previous block
+ *        ended and moves to the current target within one block.
  *
- * https://codebeamer.daiichi.com/issue/194486
+ * @param[in,out] p_layer Layer of the audio buffer.
+ * @param[out]    p_audio The audio buffer structure pointer.
  *
  */
-static inline void audio_buff_curr_to_mute_switch(void);
+static inline void audio_buff_ramp_latch(audio_layer_t *p_layer,
+                                         audio_buff_t *p_audio);
 
 /**
- * @brief This function provides to switch the current buffer.
+ * @brief This function provides to latch the output envelope of a slot at the
+ *        first block of the slot. The envelope moves toward silence while the
+ *        audio is muted, paused or stopped at 0 km/h, otherwise toward the
+ *        full scale, by at most one slot of the fade time.
  *
- * @param[in] status Callback event.
+ * @param[out] p_audio The first audio buffer of the slot.
  *
- * https://codebeamer.daiichi.com/issue/194090
+ */
+static void audio_fade_latch(audio_buff_t *p_audio);
+
+/**
+ * @brief This function checks whether the output envelope moves toward
+ *        silence.
  *
  */
-static void audio_write_cb(bsp_i2s_status_t status);
+static inline bool audio_fade_mute_get(void);
 
 /**
- * @brief This function provides to get the Audio module's current state.
- *
- * @return audio_state_t Audio module state.
- *
- * https://codebeamer.daiichi.com/issue/194797
+ * @brief This function gives the envelope step of one slot in Q15 format for
+ *        a fade time in milliseconds.
  *
  */
-static inline audio_state_t curr_audio_state_get(void);
+static inline uint32_t audio_fade_step_get(uint32_t time);
 
 /**
- * @brief This function provides to set the Audio module's current state.
+ * @brief This function provides to update of the audio sample-related parameter
+ *        such as gain and shifting rate. Only the targets are written, they
+ *        are latched by the next planned buffer.
  *
- * @param[in] state Audio module state.
+ * @param[in] speed The vehicle speed in 1/256 km/h.
  *
- * https://codebeamer.daiichi.com/issue/194798
+ * https://codebeamer.daiichi.com/issue/194264
  *
  */
-static inline void curr_audio_state_set(audio_state_t state);
+static inline void audio_param_update(uint16_t speed);
 
 /**
- * @brief This function provides to get the Audio module's current state.
- *
- * @return buffer_state_t Audio module state.
+ * @brief This function provides to update the gain and step targets of a layer
+ *        for the last vehicle speed. The layer level scales the gain curve.
  *
- * https://codebeamer.daiichi.com/issue/194797
+ * @param[in,out] p_layer Layer of the audio.
  *
  */
-static inline buffer_state_t curr_buff_state_get(void);
+static void audio_layer_update(audio_layer_t *p_layer);
 
 /**
- * @brief This function provides to set the current audio buffer's state.
+ * @brief This function searches the curve segment of a speed. Below the first
+ *        and above the last breakpoint the segment is the nearest breakpoint.
  *
- * @param[in] state Current audio buffer state.
+ * @param[in] p_cfg Decoded configuration table of the audio.
+ * @param[in] speed The vehicle speed in 1/256 km/h.
  *
- * https://codebeamer.daiichi.com/issue/194800
+ * @return uint32_t Index of the last breakpoint not above the speed.
  *
  */
-static inline void curr_buff_state_set(buffer_state_t state);
+static uint32_t audio_curve_search(const audio_cfg_t *p_cfg, uint16_t speed);
 
 /**
- * @brief This function provides to get the spare audio buffer's state.
+ * @brief This function interpolates a parameter between two breakpoints.
  *
- * @return buffer_state_t Audio buffer control state.
+ * @param[in] start Parameter at the first breakpoint.
+ * @param[in] end   Parameter at the second breakpoint.
+ * @param[in] frac  Q15 position of the speed between the breakpoints, below
+ *                  unity.
  *
- * https://codebeamer.daiichi.com/issue/194801
+ * @return int32_t Interpolated parameter.
  *
  */
-static inline buffer_state_t spare_buff_state_get(void);
+static inline int32_t audio_curve_lerp(int32_t start,
+                                       int32_t end,
+                                       uint32_t frac);
 
 /**
- * @brief This function provides to set the spare audio buffer's state.
- *
- * @param[in] state Spare audio buffer state.
+ * @brief This function provides to update the highest resampler step of the
+ *        curve. The step grows with the rate, so the highest step of the
+ *        interpolated curve is on a breakpoint.
  *
- * https://codebeamer.daiichi.com/issue/194802
+ * @param[in,out] p_cfg Decoded configuration table of the audio.
  *
  */
-static inline void spare_buff_state_set(buffer_state_t state);
+static void audio_step_max_update(audio_cfg_t *p_cfg);
 
 /**
- * @brief This function provides to get the current external flash control state.
+ * @brief This function provides to start reading the calibration curve of a
+ *        layer.
  *
- * @return flash_read_state_t External Flash control state.
+ * @param[in,out] p_layer Layer of the audio.
+ * @param[out]    p_buff  Buffer of CURVE_TBL_SIZE_MAX bytes.
  *
- * https://codebeamer.daiichi.com/issue/194803
+ * @return bool Read status.
+ *
+ * @retval true  The curve is being read.
+ * @retval false The audio has no curve or it could not be read.
  *
  */
-static inline flash_read_state_t curr_flash_state_get(void);
+static bool audio_curve_read(audio_layer_t *p_layer, uint8_t *p_buff);
 
 /**
- * @brief This function provides to set the current external flash control state.
- *
- * @param[in] state External Flash control state.
+ * @brief This function decodes the calibration curve. An invalid curve is
+ *        dropped and the parameters of the table are kept.
  *
- * https://codebeamer.daiichi.com/issue/194804
+ * @param[in,out] p_layer Layer of the audio.
+ * @param[in]     p_buff  Calibration curve.
  *
  */
-static inline void curr_flash_state_set(flash_read_state_t state);
+static void audio_curve_decode(audio_layer_t *p_layer, const uint8_t *p_buff);
 
 /**
- * @brief This function provides to get the audio address.
+ * @brief This function returns the load state after the configuration of a
+ *        layer has been decoded.
  *
- * @return uint32_t Audio address.
+ * @param[in] p_cfg Decoded configuration table of the audio.
  *
- * https://codebeamer.daiichi.com/issue/194805
+ * @return flash_read_state_t Next load state.
  *
  */
-static inline uint32_t audio_addr_get(void);
+static inline flash_read_state_t audio_loop_state_get(const audio_cfg_t *p_cfg);
 
 /**
- * @brief This function provides to calculate the given audio address and the
- *        configuration table address.
- *
- * @param[in] curr_audio The current audio number.
+ * @brief This function provides to reset the playback of a layer to the start
+ *        of its audio.
  *
- * https://codebeamer.daiichi.com/issue/194438
+ * @param[out] p_layer Layer of the audio.
  *
  */
-static inline void audio_addr_set(uint8_t curr_audio);
+static void audio_layer_reset(audio_layer_t *p_layer);
 
 /**
- * @brief This function gets the variable holding the address of the
- *        configuration table.
+ * @brief This function provides to load a layer once its configuration table
+ *        is read. The table is decoded, then the calibration curve and the
+ *        crossfade of the loop are read, one flash read per call.
  *
- * @return uint32_t Configuration Table address.
+ * @param[in,out] p_layer Layer of the audio.
+ * @param[in]     state   Load state of the layer.
+ * @param[in]     p_tbl   Configuration table of the layer.
+ * @param[out]    p_head  Buffer of AUDIO_XFADE_SIZE bytes for the curve and
+ *                        the loop start.
  *
- * https://codebeamer.daiichi.com/issue/194807
+ * @return flash_read_state_t New load state, FLASH_READ_STATE_AUDIO_BUFF once
+ *                            the layer can be played.
  *
  */
-static inline uint32_t cfg_tbl_addr_get(void);
+static flash_read_state_t audio_layer_load(audio_layer_t *p_layer,
+                                           flash_read_state_t state,
+                                           const uint8_t *p_tbl,
+                                           uint8_t *p_head);
 
 /**
- * @brief This function updates the variable holding the address of the
- *        configuration table.
+ * @brief This function provides to go on loading the layers set by
+ *        api_audio_layer_set(). One layer is loaded at a time, it is called
+ *        while the flash is not used by the read stage.
+ *
+ */
+#if (1U == AUDIO_LAYER_LOAD)
+static void audio_layer_load_run(void);
+#endif
+
+/**
+ * @brief This function returns the layer of a load layer number, the mixer
+ *        layers or AUDIO_LAYER_STANDBY.
  *
- * @param[in] curr_audio Current audio number.
+ * @param[in] layer Load layer number.
  *
- * https://codebeamer.daiichi.com/issue/194808
+ * @return audio_layer_t* Layer to be loaded.
  *
  */
-static inline void cfg_tbl_addr_set(uint8_t curr_audio);
+static inline audio_layer_t *audio_load_layer_get(uint32_t layer);
 
 /**
- * @brief This function updates the variable holding the current audio.
+ * @brief This function checks whether a switch to an audio can swap the
+ *        standby layer in without stopping the playback. The standby layer
+ *        must hold the loaded audio at the played sample rate.
  *
- * @param[in] audio Current audio number.
+ * @param[in] audio Audio number to be switched to.
  *
- * https://codebeamer.daiichi.com/issue/194809
+ * @return bool The switch is fast.
  *
  */
-static inline void curr_audio_set(uint8_t audio);
+static bool audio_standby_check(uint8_t audio);
 
+#if (1U == AUDIO_CONF_STANDBY)
 /**
- * @brief This function gets the variable holding the current audio value.
+ * @brief This function provides to swap the standby layer with layer 0. The
+ *        resampler and the block planner stay with the played stream, the
+ *        audio played so far is loaded back to the standby layer.
  *
- * @return uint8_t Value of the current audio.
+ */
+static void audio_standby_swap(void);
+#endif
+
+/**
+ * @brief This function provides to read the configuration table of layer 0
+ *        again after a fast switch. The raw table is only used by the getters,
+ *        it is read between the block reads.
  *
- * @retval API_AUDIO_1 Specifies the audio-1.
- * @retval API_AUDIO_2 Specifies the audio-2.
- * @retval API_AUDIO_3 Specifies the audio-3.
+ */
+static void audio_cfg_tbl_reload(void);
+
+/**
+ * @brief This function returns the External Flash bandwidth of a layer at the
+ *        highest pitch of its table.
  *
- * https://codebeamer.daiichi.com/issue/195193
+ * @param[in] p_layer Layer of the audio.
+ *
+ * @return uint32_t Bandwidth in bytes per second.
  *
  */
-static inline uint8_t curr_audio_get(void);
+static uint32_t audio_layer_spi_rate_get(const audio_layer_t *p_layer);
 
 /**
- * @brief This function updates the variable holding the configuration table
- *        status.
+ * @brief This function provides to keep the played layers in the SPI budget.
+ *        The layers are stopped from the last one until the budget is met,
+ *        layer 0 is never stopped.
  *
- * @param[in] status Configuration buffer status.
- *
- * https://codebeamer.daiichi.com/issue/196950
+ */
+static void audio_spi_budget_check(void);
+
+/**
+ * @brief This function provides to flatten the speaker chains until a table is
+ *        decoded.
  *
  */
-static inline void cfg_tbl_state_set(buffer_state_t status);
+static void audio_chain_reset(void);
 
 /**
- * @brief This function gets the variable holding the configuration table
- *        status.
+ * @brief This function provides to flatten the speaker chains while the
+ *        limiter delay lines keep the audio played so far.
  *
- * @return buffer_state_t Value of the current configuration table status.
+ */
+static void audio_chain_flatten(void);
+
+/**
+ * @brief This function provides to start reading the speaker chain table of
+ *        the audio of a layer.
  *
- * @retval BUFFER_STATE_READY
- * @retval BUFFER_STATE_IDLE
+ * @param[in]  p_layer Layer of the audio.
+ * @param[out] p_tbl   Speaker chain table of CHAIN_TBL_SIZE bytes.
  *
- * https://codebeamer.daiichi.com/issue/196951
+ * @return flash_read_state_t FLASH_READ_STATE_CHAIN while the table is read,
+ *                            FLASH_READ_STATE_AUDIO_BUFF otherwise.
  *
  */
-static inline buffer_state_t cfg_tbl_state_get(void);
+static flash_read_state_t audio_chain_read(const audio_layer_t *p_layer,
+                                           uint8_t *p_tbl);
 
 /**
- * @brief This function indicates the completion of the reading audio or
- *        configuration table from External Flash.
+ * @brief This function decodes the speaker chain table.
  *
- * https://codebeamer.daiichi.com/issue/197524
+ * @param[in] p_tbl Speaker chain table.
  *
  */
-static void ext_flash_cb(bool err);
-
-/*******************************************************************************
- * Public Functions
- ******************************************************************************/
+static void audio_chain_decode(const uint8_t *p_tbl);
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194088
+ * @brief This function provides to set the limiter thresholds of the speaker
+ *        chains from the table and the amplifier diagnostics.
  *
  */
-bool api_audio_init(void)
-{
-    local_var_reset();
-
-    uint8_t curr_audio = API_AUDIO_1;
+static void audio_limiter_update(void);
 
-    bool ret = api_data_read(API_DATA_LABEL_CURR_AUDIO,
-                             &curr_audio,
-                             1U,
-                             0U);
+/**
+ * @brief This function is the diagnostic callback of the amplifier driver. The
+ *        clipping and the thermal warnings of a report are collected, then
+ *        handled once the report ends.
+ *
+ * @param[in] diag Diagnostic of the amplifier.
+ *
+ */
+static void audio_amp_diag_cb(drv_amplifier_diag_t diag);
 
-    if (false == ret)
-    {
-        LOG_ERROR("Current audio could not read");
+/**
+ * @brief This function provides to move the limiter thresholds at the end of
+ *        an amplifier report. A clipping lowers them, a thermal warning caps
+ *        them, and they are taken back slowly once the reports are clean.
+ *
+ */
+static void audio_amp_diag_update(void);
 
-        curr_audio_set(API_AUDIO_1);
-    }
-    else
-    {
-        curr_audio_set(curr_audio);
-    }
+/**
+ * @brief This function provides the reset private variable.
+ *
+ * https://codebeamer.daiichi.com/issue/194260
+ *
+ */
+static inline void local_var_reset(void);
 
-    cfg_tbl_addr_set(curr_audio);
+/**
+ * @brief This function updates the variable holding the play status of the module.
+ *
+ * @param[in] status Audio module playing status.
+ *
+ * https://codebeamer.daiichi.com/issue/195191
+ *
+ */
+static inline void audio_play_set(bool status);
 
-    audio_addr_set(curr_audio);
+/**
+ * @brief This function gets the variable holding the play status of the module.
+ *
+ * @return bool Status of audio module play function.
+ *
+ * @retval true  The module is playing.
+ * @retval false The module is not playing.
+ *
+ * https://codebeamer.daiichi.com/issue/195192
+ *
+ */
+static inline bool audio_play_get(void);
 
-    uint32_t addr = cfg_tbl_addr_get();
+/**
+ * @brief This function provides to get audio samples from the External Flash
+ *        via api_data_read function.
+ *
+ * @param[in]  p_layer Layer of the audio.
+ * @param[out] p_buff  Audio buffer pointer.
+ * @param[in]  offset  Specifies the sample which points by cursor parameter.
+ * @param[in]  size    Byte count to be read.
+ *
+ * @return bool Read request status.
+ *
+ * https://codebeamer.daiichi.com/issue/194262
+ *
+ */
+static inline bool audio_buff_get(const audio_layer_t *p_layer,
+                                  uint8_t *p_buff,
+                                  uint32_t offset,
+                                  uint32_t size);
 
-    ret = api_data_read(addr,
-                        m_audio_cfg_tbl,
-                        API_DATA_AUDIO_CFG_TBL_SIZE,
-                        0U);
+/**
+ * @brief This function provides to fill the input of the audio buffer from the
+ *        loop. The input is split at the crossfade start and at the loop end,
+ *        so at most one flash read is started per call.
+ *
+ * @param[in,out] p_layer Layer of the audio buffer.
+ * @param[in,out] p_audio Audio buffer structure pointer.
+ *
+ * @return bool Fill status.
+ *
+ * @retval true  The input is complete.
+ * @retval false A flash read has been started, the fill goes on once the
+ *               flash is not busy.
+ *
+ */
+static bool audio_buff_fill(audio_layer_t *p_layer, audio_buff_t *p_audio);
 
-    if (false == ret)
-    {
-        LOG_ERROR("Audio cfg table could not read");
+/**
+ * @brief This function provides to move the audio cursor. The cursor wraps
+ *        from the loop end to the end of the crossfade after the loop start.
+ *
+ * @param[in,out] p_layer Layer of the audio.
+ * @param[in]     size    Byte count played.
+ *
+ */
+static inline void audio_cursor_move(audio_layer_t *p_layer, uint32_t size);
 
-        return false;
-    }
+/**
+ * @brief This function provides to start reading the audio samples in the
+ *        format of the audio slot. A compressed read is limited to one block,
+ *        the caller goes on with the rest.
+ *
+ * @param[in,out] p_layer Layer of the audio.
+ * @param[out]    p_buff  Audio buffer pointer.
+ * @param[in]     offset  Byte offset of the first sample in the decoded audio.
+ * @param[in]     size    Byte count of the samples.
+ *
+ * @return uint32_t Byte count of the samples covered by the read.
+ *
+ */
+static uint32_t audio_data_read(audio_layer_t *p_layer,
+                                uint8_t *p_buff,
+                                uint32_t offset,
+                                uint32_t size);
 
-    (void)bsp_i2s_cb_set(audio_write_cb);
+/**
+ * @brief This function provides to start reading the ADPCM frames of one
+ *        block to the staging buffer.
+ *
+ * @param[in,out] p_layer Layer of the audio.
+ * @param[out]    p_buff  Audio buffer pointer.
+ * @param[in]     offset  Byte offset of the first sample in the decoded audio.
+ * @param[in]     size    Byte count of the samples.
+ *
+ * @return uint32_t Byte count of the samples covered by the read.
+ *
+ */
+static uint32_t audio_adpcm_read(audio_layer_t *p_layer,
+                                 uint8_t *p_buff,
+                                 uint32_t offset,
+                                 uint32_t size);
 
-    (void)api_data_cb_set(ext_flash_cb);
+/**
+ * @brief This function provides to start reading the compact PCM frames to
+ *        the end of the audio buffer.
+ *
+ * @param[in,out] p_layer Layer of the audio.
+ * @param[out]    p_buff  Audio buffer pointer.
+ * @param[in]     offset  Byte offset of the first sample in the expanded audio.
+ * @param[in]     size    Byte count of the samples.
+ *
+ * @return uint32_t Byte count of the samples covered by the read.
+ *
+ */
+static uint32_t audio_pcm_read(audio_layer_t *p_layer,
+                               uint8_t *p_buff,
+                               uint32_t offset,
+                               uint32_t size);
 
-    cfg_tbl_state_set(BUFFER_STATE_READ);
+/**
+ * @brief This function provides to decode the pending ADPCM frames.
+ *
+ */
+static void audio_adpcm_decode(void);
 
-    curr_flash_state_set(FLASH_READ_STATE_CFG_TBL);
+/**
+ * @brief This function provides to finish the last audio read. The pending
+ *        ADPCM frames are decoded, it is called once the flash is not busy.
+ *
+ */
+static void audio_read_finish(void);
 
-    m_api_audio_init = true;
+/**
+ * @brief This function provides to start a flash read of the stored audio. The
+ *        read is kept for the CRC check until it ends.
+ *
+ * @param[in]  p_layer Layer of the audio.
+ * @param[out] p_buff  Buffer of the stored bytes.
+ * @param[in]  offset  Byte offset in the stored audio.
+ * @param[in]  size    Byte count to be read.
+ *
+ * @return bool Read request status.
+ *
+ */
+static bool audio_raw_read(const audio_layer_t *p_layer,
+                           uint8_t *p_buff,
+                           uint32_t offset,
+                           uint32_t size);
 
-    LOG_INFO("Initialized");
+/**
+ * @brief This function returns the offset in the stored audio of a frame.
+ *
+ * @param[in] p_cfg  Configuration of the audio.
+ * @param[in] offset Byte offset of the frame in the 32-bit stereo audio.
+ *
+ * @return uint32_t Byte offset of the frame in the stored audio.
+ *
+ */
+static uint32_t audio_store_offset_get(const audio_cfg_t *p_cfg,
+                                       uint32_t offset);
 
-    return true;
-}
+/**
+ * @brief This function provides to set the CRC check of a layer from its
+ *        configuration table, once the loop points are decoded.
+ *
+ * @param[out] p_layer Layer of the audio.
+ * @param[in]  p_tbl   Configuration table of the audio.
+ *
+ */
+static void audio_crc_reset(audio_layer_t *p_layer, const uint8_t *p_tbl);
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/195210
+ * @brief This function provides to add the bytes of the last ended read to the
+ *        CRC check of its layer, it is called once the flash is not busy.
  *
  */
-void api_audio_deinit(void)
-{
-    local_var_reset();
+static void audio_crc_update(void);
 
-    m_api_audio_init = false;
+/**
+ * @brief This function provides to check the audio of a layer against its
+ *        CRC once both parts are complete. A mismatch sets the checksum DTC.
+ *
+ * @param[in,out] p_crc CRC check of the layer.
+ * @param[in]     audio Audio number of the layer.
+ *
+ */
+static void audio_crc_check(audio_crc_t *p_crc, uint8_t audio);
 
-    LOG_INFO("Denitialized");
-}
+/**
+ * @brief This function provides to read the crossfade part of the loop up to
+ *        AUDIO_XFADE_SIZE, one read per call.
+ *
+ * @param[in,out] p_layer Layer of the audio.
+ * @param[out]    p_buff  Crossfade buffer pointer.
+ * @param[in]     offset  Byte offset of the crossfade part.
+ *
+ * @return bool Read status.
+ *
+ * @retval true  The whole part has been read.
+ * @retval false A flash read has been started.
+ *
+ */
+static bool audio_xfade_read(audio_layer_t *p_layer,
+                             uint8_t *p_buff,
+                             uint32_t offset);
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194092
+ * @brief This function provides the read stage of the pipeline. It plans the
+ *        next free input block for the next layer of the slot and reads its
+ *        samples from the External Flash. The layers take turns, so their
+ *        reads are interleaved. It is called while the flash is not busy.
+ *
+ * https://codebeamer.daiichi.com/issue/194265
  *
  */
-void api_audio_process(void)
-{
-    if (false == m_api_audio_init)
-    {
-        LOG_ERROR("API_AUDIO not initilized");
+static void audio_read_stage(void);
 
-        return;
-    }
+/**
+ * @brief This function provides the edit stage of the pipeline. It resamples
+ *        the oldest read input block into a played ring slot and queues the
+ *        slot to the play stage once its last layer is mixed.
+ *
+ */
+static void audio_edit_stage(void);
 
-    if (false == drv_flash_is_busy()) // TODO
-    {
-        state_manager();
-    }
+/**
+ * @brief This function provides to queue the filled ring slot to the play
+ *        stage.
+ *
+ * @param[in] slot Ring slot index.
+ *
+ */
+static void audio_slot_commit(uint32_t slot);
 
-    if (false == drv_flash_is_busy()) // TODO
-    {
-        flash_state_manager();
-    }
-}
+/**
+ * @brief This function provides to count the margin of a refilled ring slot
+ *        before the I2S starts it.
+ *
+ * @param[in] slot Ring slot index.
+ *
+ */
+static void audio_diag_refill(uint32_t slot);
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194086
+ * @brief This function provides to end the timing of the switch once the
+ *        first ring slot of the new audio is given to the I2S.
+ *
+ */
+static void audio_diag_switch_end(void);
+
+/**
+ * @brief This function provides to stop the playback ring and to empty the
+ *        pipeline. All the input blocks and ring slots are given back to their
+ *        free queues.
+ *
+ */
+static void audio_ring_reset(void);
+
+/**
+ * @brief This function provides to manages the buffer-filling operations.
+ *
+ * https://codebeamer.daiichi.com/issue/194089
+ *
+ */
+static void flash_state_manager(void);
+
+/**
+ * @brief This function provides to check the ring slots and flash are in the
+ *        ready state.
+ *
+ * @return bool Audio init finish status.
+ *
+ * @retval true  All the ring slots are filled.
+ * @return false The flash control state is in FLASH_READ_STATE_INIT or the
+ *               ring slots are being filled.
+ *
+ * https://codebeamer.daiichi.com/issue/194439
+ *
+ */
+static bool audio_init_state_check(void);
+
+/**
+ * @brief This function provides to start the playback ring to the audio
+ *        amplifier.
+ *
+ * @return bool Ring start status.
+ *
+ * https://codebeamer.daiichi.com/issue/194253
+ *
+ */
+static inline bool audio_play(void);
+
+/**
+ * @brief This function provides to play the audio at the sample rate of its
+ *        configuration table. The I2S and the amplifiers are set while the
+ *        ring is stopped, and the slot frame count is scaled to the rate.
+ *
+ * @param[in] sample_rate Sample rate in Hz.
+ *
+ */
+static void audio_rate_set(uint32_t sample_rate);
+
+/**
+ * @brief This function returns the byte count played from one ring slot.
+ *
+ * @return uint32_t Slot size in bytes.
+ *
+ */
+static inline uint32_t audio_block_size_get(void);
+
+/**
+ * @brief This function provides to start the playback once the ring is
+ *        filled.
+ *
+ * https://codebeamer.daiichi.com/issue/194259
+ *
+ */
+static void audio_run_state_check(void);
+
+/**
+ * @brief This function provides to switch the I2S to the silence once each
+ *        ring slot has been refilled silent by the faded out output, and back
+ *        to the ring once the output fades in.
+ *
+ */
+static void audio_silence_check(void);
+
+/**
+ * @brief This function provides to mute the amplifier once the output is
+ *        silent.
+ *
+ * @return bool Mute status.
+ *
+ * @retval true  Mute is successfully done.
+ * @retval false Amplifier communication error.
+ *
+ */
+static bool audio_amplifier_mute(void);
+
+/**
+ * @brief This function provides to end the silence of the I2S and to count
+ *        its time.
+ *
+ */
+static void audio_silence_end(void);
+
+/**
+ * @brief This function provides to manages the API audio module in the process.
+ *
+ * https://codebeamer.daiichi.com/issue/194087
+ *
+ */
+static void state_manager(void);
+
+/**
+ * @brief This function provides to handle the playback ring events.
+ *
+ * @param[in] status Callback event.
+ *
+ * https://codebeamer.daiichi.com/issue/194090
+ *
+ */
+static void audio_write_cb(bsp_i2s_status_t status);
+
+/**
+ * @brief This function provides to get the Audio module's current state.
+ *
+ * @return audio_state_t Audio module state.
+ *
+ * https://codebeamer.daiichi.com/issue/194797
+ *
+ */
+static inline audio_state_t curr_audio_state_get(void);
+
+/**
+ * @brief This function provides to set the Audio module's current state.
+ *
+ * @param[in] state Audio module state.
+ *
+ * https://codebeamer.daiichi.com/issue/194798
+ *
+ */
+static inline void curr_audio_state_set(audio_state_t state);
+
+/**
+ * @brief This function provides to get the current external flash control state.
+ *
+ * @return flash_read_state_t External Flash control state.
+ *
+ * https://codebeamer.daiichi.com/issue/194803
+ *
+ */
+static inline flash_read_state_t curr_flash_state_get(void);
+
+/**
+ * @brief This function provides to set the current external flash control state.
+ *
+ * @param[in] state External Flash control state.
+ *
+ * https://codebeamer.daiichi.com/issue/194804
+ *
+ */
+static inline void curr_flash_state_set(flash_read_state_t state);
+
+/**
+ * @brief This function provides to get the audio address.
+ *
+ * @param[in] p_layer Layer of the audio.
+ *
+ * @return uint32_t Audio address.
+ *
+ * https://codebeamer.daiichi.com/issue/194805
+ *
+ */
+static inline uint32_t audio_addr_get(const audio_layer_t *p_layer);
+
+/**
+ * @brief This function provides to calculate the given audio address and the
+ *        configuration table address.
+ *
+ * @param[out] p_layer    Layer of the audio.
+ * @param[in]  curr_audio The current audio number.
+ *
+ * https://codebeamer.daiichi.com/issue/194438
+ *
+ */
+static inline void audio_addr_set(audio_layer_t *p_layer, uint8_t curr_audio);
+
+/**
+ * @brief This function resolves an audio number to its slot through the audio
+ *        directory of api_data. An invalid number resolves to API_AUDIO_1.
+ *
+ * @param[in]  audio       Audio number.
+ * @param[out] p_data_size Size of the audio data area of the slot.
+ *
+ * @return uint32_t Configuration table address of the slot.
+ *
+ */
+static uint32_t audio_slot_get(uint8_t audio, uint32_t *p_data_size);
+
+/**
+ * @brief This function gets the variable holding the address of the
+ *        configuration table.
+ *
+ * @param[in] p_layer Layer of the audio.
+ *
+ * @return uint32_t Configuration Table address.
+ *
+ * https://codebeamer.daiichi.com/issue/194807
+ *
+ */
+static inline uint32_t cfg_tbl_addr_get(const audio_layer_t *p_layer);
+
+/**
+ * @brief This function updates the variable holding the address of the
+ *        configuration table.
+ *
+ * @param[out] p_layer    Layer of the audio.
+ * @param[in]  curr_audio Current audio number.
+ *
+ * https://codebeamer.daiichi.com/issue/194808
+ *
+ */
+static inline void cfg_tbl_addr_set(audio_layer_t *p_layer,
+                                    uint8_t curr_audio);
+
+/**
+ * @brief This function updates the variable holding the current audio.
+ *
+ * @param[in] audio Current audio number.
+ *
+ * https://codebeamer.daiichi.com/issue/194809
+ *
+ */
+static inline void curr_audio_set(uint8_t audio);
+
+/**
+ * @brief This function gets the variable holding the current audio value.
+ *
+ * @return uint8_t Value of the current audio, a slot number of the audio
+ *                 directory.
+ *
+ * https://codebeamer.daiichi.com/issue/195193
+ *
+ */
+static inline uint8_t curr_audio_get(void);
+
+/**
+ * @brief This function updates the variable holding the configuration table
+ *        status.
+ *
+ * @param[in] status Configuration buffer status.
+ *
+ * https://codebeamer.daiichi.com/issue/196950
+ *
+ */
+static inline void cfg_tbl_state_set(buffer_state_t status);
+
+/**
+ * @brief This function gets the variable holding the configuration table
+ *        status.
+ *
+ * @return buffer_state_t Value of the current configuration table status.
+ *
+ * @retval BUFFER_STATE_READY
+ * @retval BUFFER_STATE_IDLE
+ *
+ * https://codebeamer.daiichi.com/issue/196951
+ *
+ */
+static inline buffer_state_t cfg_tbl_state_get(void);
+
+/**
+ * @brief This function indicates the completion of the reading audio or
+ *        configuration table from External Flash.
+ *
+ * https://codebeamer.daiichi.com/issue/197524
+ *
+ */
+static void ext_flash_cb(bool err);
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194088
+ *
+ */
+bool api_audio_init(void)
+{
+    local_var_reset();
+
+    uint8_t curr_audio = API_AUDIO_1;
+
+    bool ret = api_data_read(API_DATA_LABEL_CURR_AUDIO,
+                             &curr_audio,
+                             1U,
+                             0U);
+
+    if (false == ret)
+    {
+        LOG_ERROR("Current audio could not read");
+
+        curr_audio_set(API_AUDIO_1);
+    }
+    else
+    {
+        curr_audio_set(curr_audio);
+    }
+
+    cfg_tbl_addr_set(&m_audio_layer[0U], curr_audio);
+
+    audio_addr_set(&m_audio_layer[0U], curr_audio);
+
+    uint32_t addr = cfg_tbl_addr_get(&m_audio_layer[0U]);
+
+    ret = api_data_read(addr,
+                        m_audio_cfg_tbl,
+                        API_DATA_AUDIO_CFG_TBL_SIZE,
+                        0U);
+
+    if (false == ret)
+    {
+        LOG_ERROR("Audio cfg table could not read");
+
+        return false;
+    }
+
+    (void)bsp_i2s_cb_set(audio_write_cb);
+
+    (void)api_data_cb_set(ext_flash_cb);
+
+    drv_amplifier_diag_cb_set(audio_amp_diag_cb);
+
+    cfg_tbl_state_set(BUFFER_STATE_READ);
+
+    curr_flash_state_set(FLASH_READ_STATE_CFG_TBL);
+
+    m_api_audio_init = true;
+
+    LOG_INFO("Initialized");
+
+    return true;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/195210
+ *
+ */
+void api_audio_deinit(void)
+{
+    local_var_reset();
+
+    m_api_audio_init = false;
+
+    LOG_INFO("Denitialized");
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194092
+ *
+ */
+void api_audio_process(void)
+{
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return;
+    }
+
+    // The stages run in reverse order, so a slot freed by the play stage is
+    // filled by the edit stage before the read stage takes the flash again.
+    state_manager();
+
+    audio_edit_stage();
+
+    if (false == drv_flash_is_busy())
+    {
+        flash_state_manager();
+    }
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194086
  *
  */
 bool api_audio_mute(void)
 {
-    if (false == m_api_audio_init)
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return false;
+    }
+
+    // The next filled slots fade out, the queued slots are still played.
+    m_audio_param.mute = true;
+
+    // A playing output is muted once it has faded out to the silence.
+    if ((true == m_audio_param.ring_run) &&
+        (false == m_audio_param.ring_silent))
+    {
+        return true;
+    }
+
+    return audio_amplifier_mute();
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194091
+ *
+ */
+bool api_audio_unmute(void)
+{
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return false;
+    }
+
+    bool ret = drv_amplifier_unmute();
+
+    if (false == ret)
+    {
+        LOG_ERROR("Amplifier unmute error");
+
+        return false;
+    }
+    else
+    {
+        LOG_INFO("Amplifier unmute");
+    }
+
+    m_audio_param.mute = false;
+
+    return true;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194095
+ *
+ */
+bool api_audio_play(void)
+{
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return false;
+    }
+
+    bool ret = false;
+
+    audio_play_set(true);
+
+    LOG_INFO("Audio play");
+
+    if (AUDIO_STATE_READY == curr_audio_state_get())
+    {
+        curr_audio_state_set(AUDIO_STATE_RUN);
+
+        ret = true;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/197386
+ *
+ */
+bool api_audio_pause(void)
+{
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return false;
+    }
+
+    audio_play_set(false);
+
+    LOG_INFO("Audio pause");
+
+    return true;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/197387
+ *
+ */
+bool api_audio_status_get(void)
+{
+    bool status = audio_play_get();
+
+    return status;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194093
+ *
+ */
+void api_audio_param_update(uint16_t speed)
+{
+    uint32_t speed_fp = (uint32_t)speed << API_AUDIO_SPEED_SHIFT;
+
+    if (UINT16_MAX < speed_fp)
+    {
+        speed_fp = UINT16_MAX;
+    }
+
+    api_audio_speed_update((uint16_t)speed_fp);
+}
+
+/**
+ * @brief This function provides to update the parameters for a fractional
+ *        vehicle speed.
+ *
+ */
+void api_audio_speed_update(uint16_t speed)
+{
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return;
+    }
+
+    audio_param_update(speed);
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194094
+ *
+ */
+bool api_audio_switch(uint8_t audio_num)
+{
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return false;
+    }
+
+    uint8_t curr_audio = curr_audio_get();
+
+#if (1U == AUDIO_CONF_STANDBY)
+    if (true == m_audio_param.swap)
+    {
+        if (audio_num == m_audio_standby.layer.audio)
+        {
+            return true;
+        }
+
+        // The fast switch has not been done yet, it is dropped.
+        m_audio_param.swap = false;
+
+        m_audio_diag.switch_wait = false;
+    }
+#endif
+
+    if (audio_num == curr_audio)
+    {
+        return true;
+    }
+
+    uint8_t slot_cnt = api_data_audio_slot_cnt_get();
+
+    if ((slot_cnt <= curr_audio) || (slot_cnt <= audio_num))
+    {
+        LOG_ERROR("Invalid audio number for switching: %u to %u",
+                  curr_audio,
+                  audio_num);
+
+        return false;
+    }
+
+    LOG_INFO("Switch Audio-%u to Audio-%u", curr_audio, audio_num);
+
+    m_audio_diag.switch_tick = bsp_mcu_tick_get();
+
+    m_audio_diag.switch_wait = true;
+
+    m_audio_diag.switch_fast = audio_standby_check(audio_num);
+
+    if (true == m_audio_diag.switch_fast)
+    {
+        // The standby layer is swapped in by the flash state manager between
+        // two blocks.
+        m_audio_param.swap = true;
+
+        return true;
+    }
+
+    curr_audio_set(audio_num);
+
+    cfg_tbl_addr_set(&m_audio_layer[0U], audio_num);
+
+    audio_addr_set(&m_audio_layer[0U], audio_num);
+
+    curr_audio_state_set(AUDIO_STATE_SWITCH);
+
+    return true;
+}
+
+/**
+ * @brief This function provides to load an audio slot to the standby layer.
+ *
+ */
+bool api_audio_prefetch(uint8_t audio_num)
+{
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return false;
+    }
+
+    if (api_data_audio_slot_cnt_get() <= audio_num)
+    {
+        LOG_ERROR("Invalid audio number for prefetch: %u", audio_num);
+
+        return false;
+    }
+
+#if (1U == AUDIO_CONF_STANDBY)
+    audio_layer_t *p_layer = &m_audio_standby.layer;
+
+    // The standby layer is kept until it is swapped in.
+    if (true == m_audio_param.swap)
+    {
+        LOG_WARNING("Prefetch during switch; audio:%u", audio_num);
+
+        return false;
+    }
+
+    if ((FLASH_READ_STATE_IDLE != p_layer->state) &&
+        (audio_num == p_layer->audio))
+    {
+        return true;
+    }
+
+    p_layer->ready = false;
+
+    m_audio_standby.chain = false;
+
+    cfg_tbl_addr_set(p_layer, audio_num);
+
+    audio_addr_set(p_layer, audio_num);
+
+    p_layer->audio = audio_num;
+
+    // The table is read by the flash state manager between the block reads.
+    p_layer->state = FLASH_READ_STATE_INIT;
+
+    LOG_INFO("Prefetch; audio:%u", audio_num);
+
+    return true;
+#else
+    // Without the standby layer the switch reads the audio from the flash.
+    return false;
+#endif
+}
+
+/**
+ * @brief This function gives whether the build has the standby layer.
+ *
+ */
+bool api_audio_standby_get(void)
+{
+    return (1U == AUDIO_CONF_STANDBY);
+}
+
+/**
+ * @brief This function provides to play an audio slot on a mixer layer.
+ *
+ */
+bool api_audio_layer_set(uint8_t layer, uint8_t audio_num, uint16_t gain)
+{
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return false;
+    }
+
+    if ((0U == layer) || (AUDIO_CONF_LAYER_CNT <= layer) ||
+        (api_data_audio_slot_cnt_get() <= audio_num))
+    {
+        LOG_ERROR("Invalid layer; layer:%u, audio:%u", layer, audio_num);
+
+        return false;
+    }
+
+    audio_layer_t *p_layer = &m_audio_layer[layer];
+
+    p_layer->level = dsp_gain_q15_get(gain, AUDIO_GAIN_CALC_RATE);
+
+    // Only the level changes while the same audio is loaded or played.
+    if ((FLASH_READ_STATE_IDLE != p_layer->state) &&
+        (audio_num == p_layer->audio))
+    {
+        audio_layer_update(p_layer);
+
+        return true;
+    }
+
+    p_layer->ready = false;
+
+    cfg_tbl_addr_set(p_layer, audio_num);
+
+    audio_addr_set(p_layer, audio_num);
+
+    p_layer->audio = audio_num;
+
+    // The table is read by the flash state manager between the block reads.
+    p_layer->state = FLASH_READ_STATE_INIT;
+
+    LOG_INFO("Layer set; layer:%u, audio:%u, gain:%u", layer, audio_num, gain);
+
+    return true;
+}
+
+/**
+ * @brief This function provides to stop a mixer layer.
+ *
+ */
+bool api_audio_layer_stop(uint8_t layer)
+{
+    if (false == m_api_audio_init)
+    {
+        LOG_ERROR("API_AUDIO not initilized");
+
+        return false;
+    }
+
+    if ((0U == layer) || (AUDIO_CONF_LAYER_CNT <= layer))
+    {
+        LOG_ERROR("Invalid layer; layer:%u", layer);
+
+        return false;
+    }
+
+    // The blocks already read for the layer are still mixed.
+    m_audio_layer[layer].ready = false;
+
+    m_audio_layer[layer].state = FLASH_READ_STATE_IDLE;
+
+    LOG_INFO("Layer stopped; layer:%u", layer);
+
+    return true;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194477
+ *
+ */
+bool api_audio_name_get(char_t *p_name)
+{
+    if (NULL == p_name)
+    {
+        LOG_ERROR("Invalid argument in api_audio_name_get");
+
+        return false;
+    }
+
+    if ((true == m_api_audio_init) &&
+        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    {
+        const char_t *p_tmp =
+            (char_t *)&m_audio_cfg_tbl[CFG_TBL_AUDIO_NAME_OFFSET];
+
+        (void)strncpy(p_name, p_tmp, CFG_TBL_NAME_PARAM_SIZE);
+
+        p_name[CFG_TBL_NAME_PARAM_SIZE] = '\0';
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194478
+ *
+ */
+bool api_audio_size_get(uint32_t *p_size)
+{
+    if (NULL == p_size)
+    {
+        LOG_ERROR("Invalid argument in api_audio_size_get");
+
+        return false;
+    }
+
+    if ((true == m_api_audio_init) &&
+        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    {
+        *p_size = m_audio_layer[0U].cfg.size;
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194479
+ *
+ */
+bool api_audio_calib_date_get(char_t *p_calib_date)
+{
+    if (NULL == p_calib_date)
+    {
+        LOG_ERROR("Invalid argument in api_audio_calib_date_get");
+
+        return false;
+    }
+
+    if ((true == m_api_audio_init) &&
+        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    {
+        const char_t *p_tmp =
+            (char_t *)&m_audio_cfg_tbl[CFG_TBL_CALIB_DATE_OFFSET];
+
+        (void)strncpy(p_calib_date,
+                      p_tmp,
+                      CFG_TBL_CALIB_DATE_PARAM_SIZE);
+
+        p_calib_date[CFG_TBL_CALIB_DATE_PARAM_SIZE] = '\0';
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194480
+ *
+ */
+bool api_audio_calib_tool_get(char_t *p_tool_version)
+{
+    if (NULL == p_tool_version)
+    {
+        LOG_ERROR("Invalid argument in api_audio_calib_tool_get");
+
+        return false;
+    }
+
+    if ((true == m_api_audio_init) &&
+        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    {
+        const char_t *p_addr =
+            (char_t *)&m_audio_cfg_tbl[CFG_TBL_CALIB_TOOL_VER_OFFSET];
+
+        (void)strncpy(p_tool_version,
+                      p_addr,
+                      CFG_TBL_CALIB_TOOL_VER_PARAM_SIZE);
+
+        p_tool_version[CFG_TBL_CALIB_TOOL_VER_PARAM_SIZE] = '\0';
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194481
+ *
+ */
+bool api_audio_calib_ver_get(char_t *p_calib_version)
+{
+    if (NULL == p_calib_version)
+    {
+        LOG_ERROR("Invalid argument in api_audio_calib_ver_get");
+
+        return false;
+    }
+
+    if ((true == m_api_audio_init) &&
+        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    {
+        const char_t *p_addr =
+            (char_t *)&m_audio_cfg_tbl[CFG_TBL_CALIB_VER_OFFSET];
+
+        (void)strncpy(p_calib_version,
+                      p_addr,
+                      CFG_TBL_CALIB_VER_PARAM_SIZE);
+
+        p_calib_version[CFG_TBL_CALIB_VER_PARAM_SIZE] = '\0';
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194482
+ *
+ */
+bool api_audio_freq_get(uint16_t *p_freq, uint32_t offset)
+{
+    if (NULL == p_freq)
+    {
+        LOG_ERROR("Invalid argument in api_audio_freq_get");
+
+        return false;
+    }
+
+    if ((true == m_api_audio_init) &&
+        (BUFFER_STATE_READY == cfg_tbl_state_get()) &&
+        (CFG_TBL_ENTRY_CNT > offset))
+    {
+        uint32_t idx =
+            (uint32_t)(CFG_TBL_FREQ_OFFSET + (offset * sizeof(uint16_t)));
+
+        *p_freq = uint16_convert(&m_audio_cfg_tbl[idx]);
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194483
+ *
+ */
+bool api_audio_gain_get(uint16_t *p_gain, uint32_t offset)
+{
+    if (NULL == p_gain)
+    {
+        LOG_ERROR("Invalid argument in api_audio_gain_get");
+
+        return false;
+    }
+
+    if ((true == m_api_audio_init) &&
+        (BUFFER_STATE_READY == cfg_tbl_state_get()) &&
+        (CFG_TBL_ENTRY_CNT > offset))
+    {
+        uint32_t idx =
+            (uint32_t)(CFG_TBL_GAIN_OFFSET + (offset * sizeof(uint16_t)));
+
+        *p_gain = uint16_convert(&m_audio_cfg_tbl[idx]);
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194484
+ *
+ */
+bool api_audio_ver_get(char_t *p_version)
+{
+    if (NULL == p_version)
+    {
+        LOG_ERROR("Invalid argument in api_audio_ver_get");
+
+        return false;
+    }
+
+    if ((true == m_api_audio_init) &&
+        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    {
+        const char_t *p_addr = (char_t *)&m_audio_cfg_tbl[CFG_TBL_VER_OFFSET];
+
+        (void)strncpy(p_version,
+                      p_addr,
+                      CFG_TBL_VER_PARAM_SIZE);
+
+        p_version[CFG_TBL_VER_PARAM_SIZE] = '\0';
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief This function provides to give the playback diagnostics.
+ *
+ */
+bool api_audio_diag_get(api_audio_diag_t *p_diag)
+{
+    if (NULL == p_diag)
+    {
+        LOG_ERROR("Invalid argument in api_audio_diag_get");
+
+        return false;
+    }
+
+    if (false == m_api_audio_init)
+    {
+        return false;
+    }
+
+    uint32_t underrun = m_audio_diag.underrun_base;
+
+    if (true == m_audio_param.ring_run)
+    {
+        underrun += bsp_i2s_underrun_cnt_get();
+    }
+
+    p_diag->underrun_cnt = underrun;
+    p_diag->late_cnt = m_audio_diag.late_cnt;
+    p_diag->refill_cnt = m_audio_diag.refill_cnt;
+    p_diag->headroom_min_us = m_audio_diag.headroom_min;
+
+    p_diag->switch_cnt = m_audio_diag.switch_cnt;
+    p_diag->switch_fast_cnt = m_audio_diag.switch_fast_cnt;
+    p_diag->switch_last_ms = m_audio_diag.switch_last;
+    p_diag->switch_max_ms = m_audio_diag.switch_max;
+
+    uint32_t irq_ring = m_audio_diag.irq_base[BSP_I2S_MODE_RING];
+    uint32_t irq_silence = m_audio_diag.irq_base[BSP_I2S_MODE_SILENCE];
+
+    if (true == m_audio_param.ring_run)
+    {
+        irq_ring += bsp_i2s_irq_cnt_get(BSP_I2S_MODE_RING);
+        irq_silence += bsp_i2s_irq_cnt_get(BSP_I2S_MODE_SILENCE);
+    }
+
+    uint32_t silence_time = m_audio_diag.silence_time;
+
+    if (true == m_audio_param.ring_silent)
+    {
+        silence_time += bsp_mcu_tick_get() - m_audio_diag.silence_tick;
+    }
+
+    p_diag->silence_cnt = m_audio_diag.silence_cnt;
+    p_diag->silence_ms = silence_time;
+    p_diag->irq_ring_cnt = irq_ring;
+    p_diag->irq_silence_cnt = irq_silence;
+
+    p_diag->crc_ok_cnt = m_audio_diag.crc_ok_cnt;
+    p_diag->crc_fail_cnt = m_audio_diag.crc_fail_cnt;
+
+    p_diag->block_direct_cnt = m_audio_diag.block_direct_cnt;
+    p_diag->block_edit_cnt = m_audio_diag.block_edit_cnt;
+
+    return true;
+}
+
+/**
+ * @brief This function provides to restart the playback diagnostics.
+ *
+ */
+void api_audio_diag_reset(void)
+{
+    uint32_t underrun = 0U;
+
+    if ((true == m_api_audio_init) && (true == m_audio_param.ring_run))
+    {
+        underrun = bsp_i2s_underrun_cnt_get();
+    }
+
+    // The count of the running ring is added back by api_audio_diag_get().
+    m_audio_diag.underrun_base = 0U - underrun;
+    m_audio_diag.late_cnt = 0U;
+    m_audio_diag.refill_cnt = 0U;
+    m_audio_diag.headroom_min = API_AUDIO_HEADROOM_NONE;
+
+    // A switch waiting for its first slot is still counted.
+    m_audio_diag.switch_cnt = 0U;
+    m_audio_diag.switch_fast_cnt = 0U;
+    m_audio_diag.switch_last = 0U;
+    m_audio_diag.switch_max = 0U;
+
+    for (uint32_t mode = 0U; mode < (uint32_t)BSP_I2S_MODE_CNT; mode++)
+    {
+        uint32_t irq = 0U;
+
+        if ((true == m_api_audio_init) && (true == m_audio_param.ring_run))
+        {
+            irq = bsp_i2s_irq_cnt_get((bsp_i2s_mode_t)mode);
+        }
+
+        m_audio_diag.irq_base[mode] = 0U - irq;
+    }
+
+    // A running silence is counted from now on.
+    m_audio_diag.silence_cnt = 0U;
+    m_audio_diag.silence_time = 0U;
+
+    if (true == m_audio_param.ring_silent)
+    {
+        m_audio_diag.silence_tick = bsp_mcu_tick_get();
+    }
+
+    m_audio_diag.crc_ok_cnt = 0U;
+    m_audio_diag.crc_fail_cnt = 0U;
+
+    m_audio_diag.block_direct_cnt = 0U;
+    m_audio_diag.block_edit_cnt = 0U;
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194850
+ *
+ */
+static inline uint16_t uint16_convert(const uint8_t *p_data)
+{
+    uint16_t val = 0U;
+
+    (void)memcpy(&val, p_data, sizeof(val));
+
+#if (1U == CFG_TBL_BYTE_SWAP)
+    val = __builtin_bswap16(val);
+#endif
+
+    return val;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194851
+ *
+ */
+static uint32_t uint32_convert(const uint8_t *p_data)
+{
+    uint32_t val = 0U;
+
+    (void)memcpy(&val, p_data, sizeof(val));
+
+#if (1U == CFG_TBL_BYTE_SWAP)
+    val = __builtin_bswap32(val);
+#endif
+
+    return val;
+}
+
+/**
+ * @brief This function decodes the audio configuration table.
+ *
+ */
+static void cfg_tbl_decode(audio_layer_t *p_layer, const uint8_t *p_tbl)
+{
+    audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    p_cfg->size = uint32_convert(&p_tbl[CFG_TBL_SIZE_OFFSET]);
+
+    if (p_layer->slot_size < p_cfg->size)
+    {
+        LOG_ERROR("Audio is out of the slot; size:%u, slot:%u",
+                  p_cfg->size,
+                  p_layer->slot_size);
+
+        p_cfg->size = p_layer->slot_size;
+    }
+
+    p_cfg->max_sample_cnt =
+        uint16_convert(&p_tbl[CFG_TBL_MAX_SAMPLE_CNT_OFFSET]);
+
+    // The parameters of the table are a breakpoint per km/h, they are used
+    // unless the audio has its own calibration curve.
+    for (uint32_t idx = 0U; idx < CFG_TBL_ENTRY_CNT; idx++)
+    {
+        uint32_t offset = idx * sizeof(uint16_t);
+
+        uint16_t gain = uint16_convert(&p_tbl[CFG_TBL_GAIN_OFFSET + offset]);
+
+        uint16_t freq = uint16_convert(&p_tbl[CFG_TBL_FREQ_OFFSET + offset]);
+
+        audio_curve_point_t *p_point = &p_cfg->curve[idx];
+
+        p_point->speed = (uint16_t)(idx << API_AUDIO_SPEED_SHIFT);
+        p_point->gain_q15 = (uint16_t)audio_gain_q15_get(gain);
+
+        if (0U == idx)
+        {
+            p_cfg->standstill = (0U == gain);
+        }
+
+        // PRQA S 4394 ++ # The table value is a two's complement rate.
+        p_point->rate = (int16_t)freq;
+        // PRQA S 4394 --
+    }
+
+    p_cfg->curve_cnt = CFG_TBL_ENTRY_CNT;
+
+    audio_step_max_update(p_cfg);
+
+    // The oscillators of a synthesized audio are set for the sample rate.
+    p_cfg->sample_rate = cfg_tbl_rate_decode(p_tbl);
+
+    cfg_tbl_format_decode(p_layer, p_tbl);
+
+    // The loop points are kept on the frame boundaries, so a read never
+    // splits a frame.
+    uint32_t size = (p_cfg->size / AUDIO_FRAME_SIZE) * AUDIO_FRAME_SIZE;
+
+    uint32_t loop_start = uint32_convert(&p_tbl[CFG_TBL_LOOP_START_OFFSET]);
+
+    uint32_t loop_end = uint32_convert(&p_tbl[CFG_TBL_LOOP_END_OFFSET]);
+
+    loop_start = (loop_start / AUDIO_FRAME_SIZE) * AUDIO_FRAME_SIZE;
+    loop_end = (loop_end / AUDIO_FRAME_SIZE) * AUDIO_FRAME_SIZE;
+
+    if ((0U == loop_end) || (size < loop_end))
+    {
+        loop_end = size;
+    }
+
+    if (loop_start >= loop_end)
+    {
+        loop_start = 0U;
+    }
+
+    uint32_t xfade_size = AUDIO_XFADE_SIZE;
+
+    if ((loop_end - loop_start) < (2U * AUDIO_XFADE_SIZE))
+    {
+        xfade_size = 0U;
+    }
+
+    p_cfg->loop_start = loop_start;
+    p_cfg->loop_end = loop_end;
+    p_cfg->xfade_start = loop_end - xfade_size;
+
+    p_cfg->chain_offset = uint32_convert(&p_tbl[CFG_TBL_CHAIN_OFFSET]);
+
+    p_cfg->curve_offset = uint32_convert(&p_tbl[CFG_TBL_CURVE_OFFSET]);
+
+    LOG_INFO("Audio loop; format:%u, start:%u, end:%u, xfade:%u",
+             p_cfg->format,
+             loop_start,
+             loop_end,
+             xfade_size);
+
+    audio_crc_reset(p_layer, p_tbl);
+}
+
+/**
+ * @brief This function decodes the sample rate of the audio.
+ *
+ */
+static uint32_t cfg_tbl_rate_decode(const uint8_t *p_tbl)
+{
+    uint32_t rate = uint16_convert(&p_tbl[CFG_TBL_RATE_OFFSET]);
+
+    // The calibration tool writes zero, which is the default rate.
+    if (0U == rate)
+    {
+        return AUDIO_SAMPLE_RATE;
+    }
+
+    uint32_t cnt = sizeof(m_audio_sample_rate) / sizeof(uint32_t);
+
+    for (uint32_t idx = 0U; idx < cnt; idx++)
+    {
+        if (m_audio_sample_rate[idx] == rate)
+        {
+            return rate;
+        }
+    }
+
+    LOG_ERROR("Audio sample rate is unknown; rate:%u", rate);
+
+    return AUDIO_SAMPLE_RATE;
+}
+
+/**
+ * @brief This function decodes the storage format of the audio.
+ *
+ */
+static void cfg_tbl_format_decode(audio_layer_t *p_layer,
+                                  const uint8_t *p_tbl)
+{
+    audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    uint8_t format = p_tbl[CFG_TBL_FORMAT_OFFSET];
+
+    uint32_t bit_depth = p_tbl[CFG_TBL_BIT_DEPTH_OFFSET];
+
+    uint32_t ch_cnt = p_tbl[CFG_TBL_CH_CNT_OFFSET];
+
+    // The calibration tool writes zeros, which is the 32-bit stereo audio.
+    bit_depth = (0U == bit_depth) ? DSP_PCM_BIT_DEPTH : bit_depth;
+
+    ch_cnt = (0U == ch_cnt) ? DSP_PCM_CH_CNT : ch_cnt;
+
+    uint32_t frame_size = dsp_pcm_frame_size_get(bit_depth, ch_cnt);
+
+    if (0U == frame_size)
+    {
+        LOG_ERROR("Audio storage is unknown; bit:%u, ch:%u", bit_depth, ch_cnt);
+
+        bit_depth = DSP_PCM_BIT_DEPTH;
+
+        ch_cnt = DSP_PCM_CH_CNT;
+
+        frame_size = AUDIO_FRAME_SIZE;
+    }
+
+    p_cfg->format = AUDIO_FORMAT_PCM;
+
+    p_cfg->bit_depth = bit_depth;
+
+    p_cfg->ch_cnt = ch_cnt;
+
+    p_cfg->frame_size = frame_size;
+
+    // The audio is addressed by the offset in the 32-bit stereo audio from
+    // here on.
+    if ((uint8_t)AUDIO_FORMAT_ADPCM == format)
+    {
+        p_cfg->format = AUDIO_FORMAT_ADPCM;
+
+        p_cfg->size = dsp_adpcm_frame_cnt_get(p_cfg->size) * AUDIO_FRAME_SIZE;
+    }
+    else if ((uint8_t)AUDIO_FORMAT_SYNTH == format)
+    {
+        p_cfg->format = AUDIO_FORMAT_SYNTH;
+
+        // Nothing is read from the audio file of a synthesized audio.
+        p_cfg->size = 0U;
+
+        cfg_tbl_osc_decode(p_layer, p_tbl);
+    }
+    else
+    {
+        if ((uint8_t)AUDIO_FORMAT_PCM != format)
+        {
+            LOG_ERROR("Audio format is unknown; format:%u", format);
+        }
+
+        p_cfg->size = (p_cfg->size / frame_size) * AUDIO_FRAME_SIZE;
+    }
+}
+
+/**
+ * @brief This function decodes the oscillators of a synthesized audio.
+ *
+ */
+static void cfg_tbl_osc_decode(audio_layer_t *p_layer, const uint8_t *p_tbl)
+{
+    for (uint32_t idx = 0U; idx < AUDIO_CONF_OSC_CNT; idx++)
+    {
+        const uint8_t *p_osc =
+            &p_tbl[CFG_TBL_OSC_OFFSET + (idx * CFG_TBL_OSC_SIZE)];
+
+        uint32_t level = ((uint32_t)p_osc[1U] * DSP_GAIN_UNITY_Q15) /
+                         CFG_TBL_OSC_LEVEL_MAX;
+
+        uint16_t freq = uint16_convert(&p_osc[2U]);
+
+        // An unused entry is left with a zero level, it renders silence.
+        bool ret = dsp_osc_init(&p_layer->osc[idx],
+                                (dsp_osc_wave_t)p_osc[0U],
+                                freq,
+                                p_layer->cfg.sample_rate,
+                                level);
+
+        if ((false == ret) && (0U != level))
+        {
+            LOG_ERROR("Oscillator is invalid; idx:%u, wave:%u, freq:%u",
+                      idx,
+                      p_osc[0U],
+                      freq);
+        }
+    }
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194260
+ *
+ */
+static inline void local_var_reset(void)
+{
+    audio_play_set(false);
+
+    curr_flash_state_set(FLASH_READ_STATE_INIT);
+
+    curr_audio_state_set(AUDIO_STATE_INIT);
+
+    cfg_tbl_state_set(BUFFER_STATE_IDLE);
+
+    audio_ring_reset();
+
+    dsp_chain_init(&m_audio_chain);
+
+    m_audio_amp.backoff = DSP_LIMITER_THR_UNITY;
+    m_audio_amp.tw_ceil = DSP_LIMITER_THR_UNITY;
+    m_audio_amp.clean_cnt = 0U;
+    m_audio_amp.clip = false;
+
+    m_audio_diag.underrun_base = 0U;
+    m_audio_diag.late_cnt = 0U;
+    m_audio_diag.refill_cnt = 0U;
+    m_audio_diag.headroom_min = API_AUDIO_HEADROOM_NONE;
+
+    m_audio_diag.switch_tick = 0U;
+    m_audio_diag.switch_cnt = 0U;
+    m_audio_diag.switch_fast_cnt = 0U;
+    m_audio_diag.switch_last = 0U;
+    m_audio_diag.switch_max = 0U;
+    m_audio_diag.switch_wait = false;
+    m_audio_diag.switch_fast = false;
+
+    for (uint32_t mode = 0U; mode < (uint32_t)BSP_I2S_MODE_CNT; mode++)
+    {
+        m_audio_diag.irq_base[mode] = 0U;
+    }
+
+    m_audio_diag.silence_tick = 0U;
+    m_audio_diag.silence_cnt = 0U;
+    m_audio_diag.silence_time = 0U;
+
+    m_audio_diag.crc_ok_cnt = 0U;
+    m_audio_diag.crc_fail_cnt = 0U;
+
+    m_audio_diag.block_direct_cnt = 0U;
+    m_audio_diag.block_edit_cnt = 0U;
+
+    // The output fades in from silence once the audio starts.
+    m_audio_fade.gain = 0U;
+    m_audio_fade.attack = AUDIO_CONF_FADE_ATTACK_MS;
+    m_audio_fade.release = AUDIO_CONF_FADE_RELEASE_MS;
+
+    m_audio_param.job_silent = false;
+    m_audio_param.mix_fade = 0U;
+    m_audio_param.mix_fade_end = 0U;
+
+    for (uint32_t idx = 0U; idx < AUDIO_CONF_BLOCK_CNT; idx++)
+    {
+        m_audio_block[idx].p_buff = (uint8_t *)m_audio_in_buff[idx];
+        m_audio_block[idx].max_size = AUDIO_BUFF_SIZE;
+        m_audio_block[idx].cur_size = audio_block_size_get();
+        m_audio_block[idx].step = DSP_RESAMPLER_STEP_UNITY;
+        m_audio_block[idx].step_inc = 0;
+        m_audio_block[idx].phase = 0U;
+        m_audio_block[idx].in_cnt = 0U;
+        m_audio_block[idx].gain = DSP_GAIN_UNITY_Q15;
+        m_audio_block[idx].gain_end = DSP_GAIN_UNITY_Q15;
+        m_audio_block[idx].fade = 0U;
+        m_audio_block[idx].fade_end = 0U;
+        m_audio_block[idx].head = false;
+    }
+
+    (void)memset(m_audio_in_buff, 0, sizeof(m_audio_in_buff));
+
+    (void)memset(m_audio_adpcm_buff, 0, sizeof(m_audio_adpcm_buff));
+
+    (void)memset(m_audio_slot_buff, 0, sizeof(m_audio_slot_buff));
+
+    (void)memset(m_audio_cfg_tbl, 0, API_DATA_AUDIO_CFG_TBL_SIZE);
+
+#if (1U == AUDIO_LAYER_LOAD)
+    (void)memset(m_audio_layer_tbl, 0, sizeof(m_audio_layer_tbl));
+#endif
+
+    (void)memset(m_audio_layer, 0, sizeof(m_audio_layer));
+
+#if (1U == AUDIO_CONF_STANDBY)
+    (void)memset(&m_audio_standby, 0, sizeof(m_audio_standby));
+#endif
+
+    m_audio_param.load_layer = AUDIO_LAYER_NONE;
+
+    m_audio_param.swap = false;
+
+    m_audio_param.swap_fade = false;
+
+    for (uint32_t idx = 0U;
+         idx < (AUDIO_CONF_LAYER_CNT + AUDIO_CONF_STANDBY);
+         idx++)
+    {
+        // The standby layer follows the layers of the mixer.
+        audio_layer_t *p_layer = audio_load_layer_get(idx);
+
+        if (AUDIO_CONF_LAYER_CNT <= idx)
+        {
+            p_layer = audio_load_layer_get(AUDIO_LAYER_STANDBY);
+        }
+
+        p_layer->state = FLASH_READ_STATE_IDLE;
+
+        p_layer->step = DSP_RESAMPLER_STEP_UNITY;
+
+        p_layer->gain = DSP_GAIN_UNITY_Q15;
+
+        p_layer->level = DSP_GAIN_UNITY_Q15;
+
+        audio_layer_reset(p_layer);
+    }
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194805
+ *
+ */
+static inline uint32_t audio_addr_get(const audio_layer_t *p_layer)
+{
+    return p_layer->audio_addr;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194438
+ *
+ */
+static inline void audio_addr_set(audio_layer_t *p_layer, uint8_t curr_audio)
+{
+    uint32_t addr = audio_slot_get(curr_audio, &p_layer->slot_size);
+
+    p_layer->audio_addr = addr + API_DATA_AUDIO_CFG_TBL_SIZE;
+
+    LOG_INFO("Audio File Selected; id:%u, address:%u, ", 
+             curr_audio,
+             p_layer->audio_addr);
+}
+
+/**
+ * @brief This function resolves an audio number to its slot.
+ *
+ */
+static uint32_t audio_slot_get(uint8_t audio, uint32_t *p_data_size)
+{
+    uint32_t label = 0U;
+    uint32_t size = 0U;
+
+    if (false == api_data_audio_slot_get(audio, &label, &size))
+    {
+        LOG_ERROR("Invalid audio slot; id:%u", audio);
+
+        (void)api_data_audio_slot_get(API_AUDIO_1, &label, &size);
+    }
+
+    *p_data_size = 0U;
+
+    if (API_DATA_AUDIO_CFG_TBL_SIZE < size)
+    {
+        *p_data_size = size - API_DATA_AUDIO_CFG_TBL_SIZE;
+    }
+
+    return label;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194807
+ *
+ */
+static inline uint32_t cfg_tbl_addr_get(const audio_layer_t *p_layer)
+{
+    return p_layer->cfg_tbl_addr;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194808
+ *
+ */
+static inline void cfg_tbl_addr_set(audio_layer_t *p_layer,
+                                    uint8_t curr_audio)
+{
+    p_layer->cfg_tbl_addr = audio_slot_get(curr_audio, &p_layer->slot_size);
+
+    LOG_INFO("Config File Selected; id:%u, address:%u", 
+             curr_audio,
+             p_layer->cfg_tbl_addr);
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194435
+ *
+ */
+static inline void shifting_rate_update(audio_layer_t *p_layer,
+                                        int32_t rate)
+{
+    // PRQA S 4394 ++ # The rate is passed as a two's complement value.
+    uint16_t shifting_rate = (uint16_t)(int16_t)rate;
+    // PRQA S 4394 --
+
+    // The step is a target, it is latched by the next planned buffer.
+    p_layer->step = audio_step_get(p_layer->cfg.max_sample_cnt,
+                                   shifting_rate);
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194436
+ *
+ */
+static inline uint32_t audio_step_get(uint16_t max_sample_cnt,
+                                      uint16_t shifting_rate)
+{
+    // PRQA S 4394 ++ # The table value is a two's complement rate.
+    int32_t rate = (int32_t)(int16_t)shifting_rate;
+    // PRQA S 4394 --
+
+    if ((0U == max_sample_cnt) || (0 == rate))
+    {
+        return DSP_RESAMPLER_STEP_UNITY;
+    }
+
+    int32_t kept = (int32_t)max_sample_cnt - rate;
+
+    if (0 >= kept)
+    {
+        return DSP_RESAMPLER_STEP_MAX;
+    }
+
+    uint32_t step = ((uint32_t)max_sample_cnt << DSP_RESAMPLER_STEP_SHIFT) /
+                    (uint32_t)kept;
+
+    return dsp_resampler_step_clamp(step);
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194264
+ *
+ */
+static inline void audio_param_update(uint16_t speed)
+{
+    // The speed is kept to apply the tables once they have been decoded.
+    m_audio_param.speed = speed;
+
+    for (uint32_t idx = 0U; idx < AUDIO_CONF_LAYER_CNT; idx++)
+    {
+        audio_layer_update(&m_audio_layer[idx]);
+    }
+}
+
+/**
+ * @brief This function provides to update the targets of a layer.
+ *
+ */
+static void audio_layer_update(audio_layer_t *p_layer)
+{
+    if (false == p_layer->ready)
+    {
+        p_layer->gain = DSP_GAIN_UNITY_Q15;
+        p_layer->step = DSP_RESAMPLER_STEP_UNITY;
+
+        return;
+    }
+
+    const audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    uint16_t speed = m_audio_param.speed;
+
+    uint32_t idx = audio_curve_search(p_cfg, speed);
+
+    const audio_curve_point_t *p_start = &p_cfg->curve[idx];
+
+    int32_t curve_gain = (int32_t)p_start->gain_q15;
+    int32_t rate = (int32_t)p_start->rate;
+
+    if (((idx + 1U) < p_cfg->curve_cnt) && (p_start->speed < speed))
+    {
+        const audio_curve_point_t *p_end = &p_cfg->curve[idx + 1U];
+
+        uint32_t frac = ((uint32_t)(speed - p_start->speed) <<
+                         DSP_GAIN_Q15_SHIFT) /
+                        (uint32_t)(p_end->speed - p_start->speed);
+
+        curve_gain = audio_curve_lerp(curve_gain,
+                                      (int32_t)p_end->gain_q15,
+                                      frac);
+
+        rate = audio_curve_lerp(rate, (int32_t)p_end->rate, frac);
+    }
+
+    uint32_t gain = ((uint32_t)curve_gain * p_layer->level) >>
+                    DSP_GAIN_Q15_SHIFT;
+
+    // The gain is a target, it is latched by the next planned buffer.
+    p_layer->gain = (DSP_GAIN_MAX_Q15 < gain) ? DSP_GAIN_MAX_Q15 : gain;
+
+    shifting_rate_update(p_layer, rate);
+}
+
+/**
+ * @brief This function searches the curve segment of a speed.
+ *
+ */
+static uint32_t audio_curve_search(const audio_cfg_t *p_cfg, uint16_t speed)
+{
+    uint32_t low = 0U;
+    uint32_t high = p_cfg->curve_cnt;
+
+    // The first breakpoint above the speed is searched, the segment starts
+    // at the breakpoint before it.
+    while (low < high)
+    {
+        uint32_t mid = (low + high) >> 1U;
+
+        if (p_cfg->curve[mid].speed <= speed)
+        {
+            low = mid + 1U;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return (0U == low) ? 0U : (low - 1U);
+}
+
+/**
+ * @brief This function interpolates a parameter between two breakpoints.
+ *
+ */
+static inline int32_t audio_curve_lerp(int32_t start,
+                                       int32_t end,
+                                       uint32_t frac)
+{
+    // The parameters are 16-bit and the fraction is below unity, so the
+    // product fits.
+    int32_t delta = (end - start) * (int32_t)frac;
+
+    // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed delta is intended.
+    return start + (delta >> DSP_GAIN_Q15_SHIFT);
+    // PRQA S 3101, 4532 --
+}
+
+/**
+ * @brief This function provides to update the highest step of the curve.
+ *
+ */
+static void audio_step_max_update(audio_cfg_t *p_cfg)
+{
+    p_cfg->step_max = DSP_RESAMPLER_STEP_UNITY;
+
+    for (uint32_t idx = 0U; idx < p_cfg->curve_cnt; idx++)
+    {
+        // PRQA S 4394 ++ # The rate is passed as a two's complement value.
+        uint16_t rate = (uint16_t)p_cfg->curve[idx].rate;
+        // PRQA S 4394 --
+
+        uint32_t step = audio_step_get(p_cfg->max_sample_cnt, rate);
+
+        if (p_cfg->step_max < step)
+        {
+            p_cfg->step_max = step;
+        }
+    }
+}
+
+/**
+ * @brief This function provides to start reading the calibration curve.
+ *
+ */
+static bool audio_curve_read(audio_layer_t *p_layer, uint8_t *p_buff)
+{
+    uint32_t offset = p_layer->cfg.curve_offset;
+
+    if (0U == offset)
+    {
+        return false;
+    }
+
+    if ((p_layer->slot_size < CURVE_TBL_SIZE_MAX) ||
+        ((p_layer->slot_size - CURVE_TBL_SIZE_MAX) < offset))
+    {
+        LOG_ERROR("Curve is out of the slot; offset:%u", offset);
+
+        return false;
+    }
+
+    if (false == audio_buff_get(p_layer, p_buff, offset, CURVE_TBL_SIZE_MAX))
+    {
+        LOG_ERROR("Curve could not read; offset:%u", offset);
+
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief This function decodes the calibration curve.
+ *
+ */
+static void audio_curve_decode(audio_layer_t *p_layer, const uint8_t *p_buff)
+{
+    audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    uint32_t cnt = uint16_convert(&p_buff[CURVE_TBL_CNT_OFFSET]);
+
+    if ((0U == cnt) || (CURVE_TBL_POINT_MAX < cnt))
+    {
+        LOG_ERROR("Invalid curve; count:%u", cnt);
+
+        return;
+    }
+
+    const uint8_t *p_point = &p_buff[CURVE_TBL_POINT_OFFSET];
+
+    // The search needs strictly increasing speeds, the curve is checked
+    // before the parameters of the table are dropped.
+    for (uint32_t idx = 1U; idx < cnt; idx++)
+    {
+        uint16_t prev = uint16_convert(&p_point[(idx - 1U) *
+                                                CURVE_TBL_POINT_SIZE]);
+
+        uint16_t speed = uint16_convert(&p_point[idx * CURVE_TBL_POINT_SIZE]);
+
+        if (prev >= speed)
+        {
+            LOG_ERROR("Invalid curve; point:%u, speed:%u", idx, speed);
+
+            return;
+        }
+    }
+
+    for (uint32_t idx = 0U; idx < cnt; idx++)
+    {
+        const uint8_t *p_src = &p_point[idx * CURVE_TBL_POINT_SIZE];
+
+        uint16_t gain = uint16_convert(&p_src[sizeof(uint16_t)]);
+
+        uint16_t freq = uint16_convert(&p_src[2U * sizeof(uint16_t)]);
+
+        audio_curve_point_t *p_dst = &p_cfg->curve[idx];
+
+        p_dst->speed = uint16_convert(p_src);
+        p_dst->gain_q15 = (uint16_t)audio_gain_q15_get(gain);
+
+        // PRQA S 4394 ++ # The curve value is a two's complement rate.
+        p_dst->rate = (int16_t)freq;
+        // PRQA S 4394 --
+    }
+
+    p_cfg->curve_cnt = cnt;
+
+    audio_step_max_update(p_cfg);
+
+    LOG_INFO("Audio curve; count:%u", cnt);
+}
+
+/**
+ * @brief This function returns the load state after the configuration.
+ *
+ */
+static inline flash_read_state_t audio_loop_state_get(const audio_cfg_t *p_cfg)
+{
+    if (p_cfg->xfade_start < p_cfg->loop_end)
+    {
+        return FLASH_READ_STATE_XFADE_TAIL;
+    }
+
+    return FLASH_READ_STATE_AUDIO_BUFF;
+}
+
+/**
+ * @brief This function provides to reset the playback of a layer.
+ *
+ */
+static void audio_layer_reset(audio_layer_t *p_layer)
+{
+    p_layer->cursor = 0U;
+
+    p_layer->xfade_fill = 0U;
+
+    p_layer->adpcm.pos = AUDIO_ADPCM_POS_NONE;
+
+    audio_resampler_reset(p_layer);
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/195191
+ *
+ */
+static inline void audio_play_set(bool status)
+{
+    m_audio_param.play = status;
+
+    LOG_INFO("Audio play status changed; status:%u", status);
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/195192
+ *
+ */
+static inline bool audio_play_get(void)
+{
+    return m_audio_param.play;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194437
+ *
+ */
+static inline void audio_buff_db_edit(uint8_t *p_buff,
+                                      uint32_t size,
+                                      uint32_t gain_start,
+                                      uint32_t gain_end)
+{
+    if ((DSP_GAIN_UNITY_Q15 == gain_start) && (DSP_GAIN_UNITY_Q15 == gain_end))
+    {
+        return;
+    }
+
+    // PRQA S 0310, 3305 ++ # The audio buffers are declared as 32-bit words.
+    dsp_gain_s32_ramp((int32_t *)p_buff,
+                      (uint32_t)(size / AUDIO_FRAME_SIZE),
+                      DSP_RESAMPLER_CH_CNT,
+                      gain_start,
+                      gain_end);
+    // PRQA S 0310, 3305 --
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194437
+ *
+ */
+static inline uint32_t audio_gain_q15_get(uint16_t gain)
+{
+    if (0U == gain)
+    {
+        // The 0 km/h entry zero fades the output out, see audio_fade_latch().
+        return DSP_GAIN_UNITY_Q15;
+    }
+
+    return dsp_gain_q15_get(gain, AUDIO_GAIN_CALC_RATE);
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194262
+ *
+ */
+static inline bool audio_buff_get(const audio_layer_t *p_layer,
+                                  uint8_t *p_buff,
+                                  uint32_t offset,
+                                  uint32_t size)
+{
+    uint32_t addr = audio_addr_get(p_layer);
+
+    bool ret = api_data_read(addr,
+                             p_buff,
+                             size,
+                             offset);
+
+    return ret;
+}
+
+/**
+ * @brief This function provides to move the audio cursor.
+ *
+ */
+static inline void audio_cursor_move(audio_layer_t *p_layer, uint32_t size)
+{
+    const audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    p_layer->cursor += size;
+
+    if (p_layer->cursor >= p_cfg->loop_end)
+    {
+        // The loop start has already been played inside the crossfade.
+        p_layer->cursor = p_cfg->loop_start +
+                          (p_cfg->loop_end - p_cfg->xfade_start);
+
+        LOG_VERBOSE("End of loop reached");
+    }
+}
+
+/**
+ * @brief This function provides to start reading the audio samples.
+ *
+ */
+static uint32_t audio_data_read(audio_layer_t *p_layer,
+                                uint8_t *p_buff,
+                                uint32_t offset,
+                                uint32_t size)
+{
+    m_audio_read.p_layer = p_layer;
+
+    if (AUDIO_FORMAT_ADPCM == p_layer->cfg.format)
+    {
+        return audio_adpcm_read(p_layer, p_buff, offset, size);
+    }
+
+    if (AUDIO_FRAME_SIZE != p_layer->cfg.frame_size)
+    {
+        return audio_pcm_read(p_layer, p_buff, offset, size);
+    }
+
+    (void)audio_raw_read(p_layer, p_buff, offset, size);
+
+    return size;
+}
+
+/**
+ * @brief This function provides to start reading the compact PCM frames.
+ *
+ */
+static uint32_t audio_pcm_read(audio_layer_t *p_layer,
+                               uint8_t *p_buff,
+                               uint32_t offset,
+                               uint32_t size)
+{
+    uint32_t cnt = size / AUDIO_FRAME_SIZE;
+
+    uint32_t len = cnt * p_layer->cfg.frame_size;
+
+    uint32_t addr = (offset / AUDIO_FRAME_SIZE) * p_layer->cfg.frame_size;
+
+    // The stored frames are expanded in place towards the buffer start.
+    uint8_t *p_in = &p_buff[size - len];
+
+    // PRQA S 0310 ++ # The audio buffers are declared as 32-bit words.
+    m_audio_read.p_out = (int32_t *)p_buff;
+    // PRQA S 0310 --
+
+    m_audio_read.p_in = p_in;
+
+    m_audio_read.cnt = cnt;
+
+    m_audio_read.pending = audio_raw_read(p_layer, p_in, addr, len);
+
+    if (false == m_audio_read.pending)
+    {
+        (void)memset(p_buff, 0, size);
+    }
+
+    return size;
+}
+
+/**
+ * @brief This function provides to start reading the ADPCM frames.
+ *
+ */
+static uint32_t audio_adpcm_read(audio_layer_t *p_layer,
+                                 uint8_t *p_buff,
+                                 uint32_t offset,
+                                 uint32_t size)
+{
+    uint32_t frame = offset / AUDIO_FRAME_SIZE;
+
+    uint32_t block = frame / DSP_ADPCM_BLOCK_FRAME_CNT;
+
+    uint32_t pos = frame % DSP_ADPCM_BLOCK_FRAME_CNT;
+
+    uint32_t cnt = size / AUDIO_FRAME_SIZE;
+
+    if ((DSP_ADPCM_BLOCK_FRAME_CNT - pos) < cnt)
+    {
+        cnt = DSP_ADPCM_BLOCK_FRAME_CNT - pos;
+    }
+
+    uint32_t addr = (block * DSP_ADPCM_BLOCK_SIZE) + DSP_ADPCM_HDR_SIZE + pos;
+
+    uint32_t len = cnt;
+
+    audio_adpcm_t *p_adpcm = &p_layer->adpcm;
+
+    p_adpcm->skip = 0U;
+
+    p_adpcm->hdr = false;
+
+    // A block is entered through its header, unless the decoder has just
+    // left the previous frame of the same block.
+    if ((0U == pos) || (p_adpcm->pos != frame))
+    {
+        addr -= DSP_ADPCM_HDR_SIZE + pos;
+
+        len += DSP_ADPCM_HDR_SIZE + pos;
+
+        p_adpcm->skip = pos;
+
+        p_adpcm->hdr = true;
+    }
+
+    p_adpcm->pos = frame + cnt;
+
+    // PRQA S 0310 ++ # The audio buffers are declared as 32-bit words.
+    m_audio_read.p_out = (int32_t *)p_buff;
+
+    m_audio_read.p_in = (const uint8_t *)m_audio_adpcm_buff;
+    // PRQA S 0310 --
+
+    m_audio_read.cnt = cnt;
+
+    m_audio_read.pending = audio_raw_read(p_layer,
+                                          (uint8_t *)m_audio_adpcm_buff,
+                                          addr,
+                                          len);
+
+    if (false == m_audio_read.pending)
+    {
+        (void)memset(p_buff, 0, cnt * AUDIO_FRAME_SIZE);
+
+        p_adpcm->pos = AUDIO_ADPCM_POS_NONE;
+    }
+
+    return cnt * AUDIO_FRAME_SIZE;
+}
+
+/**
+ * @brief This function provides to finish the last audio read.
+ *
+ */
+static void audio_read_finish(void)
+{
+    audio_crc_update();
+
+    if (false == m_audio_read.pending)
+    {
+        return;
+    }
+
+    m_audio_read.pending = false;
+
+    const audio_cfg_t *p_cfg = &m_audio_read.p_layer->cfg;
+
+    AUDIO_PROFILE_BEGIN(AUDIO_PROFILE_DECODE);
+
+    if (AUDIO_FORMAT_ADPCM == p_cfg->format)
+    {
+        audio_adpcm_decode();
+    }
+    else
+    {
+        (void)dsp_pcm_expand(m_audio_read.p_out,
+                             m_audio_read.p_in,
+                             m_audio_read.cnt,
+                             p_cfg->bit_depth,
+                             p_cfg->ch_cnt);
+    }
+
+    AUDIO_PROFILE_END(AUDIO_PROFILE_DECODE);
+}
+
+/**
+ * @brief This function provides to decode the pending ADPCM frames.
+ *
+ */
+static void audio_adpcm_decode(void)
+{
+    audio_adpcm_t *p_adpcm = &m_audio_read.p_layer->adpcm;
+
+    const uint8_t *p_code = m_audio_read.p_in;
+
+    if (true == p_adpcm->hdr)
+    {
+        if (false == dsp_adpcm_hdr_load(&p_adpcm->dec, p_code))
+        {
+            LOG_ERROR("ADPCM block header is invalid");
+
+            (void)memset(m_audio_read.p_out,
+                         0,
+                         m_audio_read.cnt * AUDIO_FRAME_SIZE);
+
+            p_adpcm->pos = AUDIO_ADPCM_POS_NONE;
+
+            return;
+        }
+
+        p_code = &p_code[DSP_ADPCM_HDR_SIZE];
+
+        // The frames before the wanted one only advance the decoder.
+        dsp_adpcm_decode(&p_adpcm->dec,
+                         p_code,
+                         NULL,
+                         p_adpcm->skip);
+
+        p_code = &p_code[p_adpcm->skip];
+    }
+
+    dsp_adpcm_decode(&p_adpcm->dec,
+                     p_code,
+                     m_audio_read.p_out,
+                     m_audio_read.cnt);
+}
+
+/**
+ * @brief This function provides to start a flash read of the stored audio.
+ *
+ */
+static bool audio_raw_read(const audio_layer_t *p_layer,
+                           uint8_t *p_buff,
+                           uint32_t offset,
+                           uint32_t size)
+{
+    m_audio_read.raw_size = 0U;
+
+    if (false == audio_buff_get(p_layer, p_buff, offset, size))
+    {
+        return false;
+    }
+
+    m_audio_read.p_raw = p_buff;
+    m_audio_read.raw_offset = offset;
+    m_audio_read.raw_size = size;
+
+    return true;
+}
+
+/**
+ * @brief This function returns the offset in the stored audio of a frame.
+ *
+ */
+static uint32_t audio_store_offset_get(const audio_cfg_t *p_cfg,
+                                       uint32_t offset)
+{
+    uint32_t frame = offset / AUDIO_FRAME_SIZE;
+
+    if (AUDIO_FORMAT_ADPCM != p_cfg->format)
+    {
+        return frame * p_cfg->frame_size;
+    }
+
+    uint32_t pos = frame % DSP_ADPCM_BLOCK_FRAME_CNT;
+
+    uint32_t addr = (frame / DSP_ADPCM_BLOCK_FRAME_CNT) * DSP_ADPCM_BLOCK_SIZE;
+
+    // A frame inside a block follows the header, one byte per frame.
+    if (0U != pos)
+    {
+        addr += DSP_ADPCM_HDR_SIZE + pos;
+    }
+
+    return addr;
+}
+
+/**
+ * @brief This function provides to set the CRC check of a layer.
+ *
+ */
+static void audio_crc_reset(audio_layer_t *p_layer, const uint8_t *p_tbl)
+{
+    const audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    audio_crc_t *p_crc = &p_layer->crc;
+
+    p_crc->expect = uint32_convert(&p_tbl[CFG_TBL_CRC_OFFSET]);
+
+    uint32_t split = audio_store_offset_get(p_cfg, p_cfg->xfade_start);
+
+    p_crc->pos[0U] = 0U;
+    p_crc->end[0U] = split;
+
+    p_crc->pos[1U] = split;
+    p_crc->end[1U] = audio_store_offset_get(p_cfg, p_cfg->loop_end);
+
+    for (uint32_t part = 0U; part < AUDIO_CRC_PART_CNT; part++)
+    {
+        p_crc->crc[part] = CRC32_INIT;
+    }
+
+    // A synthesized audio reads nothing, its oscillators are at the CRC.
+    p_crc->done = ((0U == p_crc->expect) ||
+                   (AUDIO_FORMAT_SYNTH == p_cfg->format) ||
+                   (0U == p_cfg->loop_end));
+}
+
+/**
+ * @brief This function provides to add the last read to the CRC check.
+ *
+ */
+static void audio_crc_update(void)
+{
+    uint32_t size = m_audio_read.raw_size;
+
+    if (0U == size)
+    {
+        return;
+    }
+
+    m_audio_read.raw_size = 0U;
+
+    audio_layer_t *p_layer = m_audio_read.p_layer;
+
+    audio_crc_t *p_crc = &p_layer->crc;
+
+    if (true == p_crc->done)
+    {
+        return;
+    }
+
+    uint32_t start = m_audio_read.raw_offset;
+
+    uint32_t end = start + size;
+
+    for (uint32_t part = 0U; part < AUDIO_CRC_PART_CNT; part++)
+    {
+        uint32_t pos = p_crc->pos[part];
+
+        // Only the bytes going on from the part position are taken.
+        if ((pos < start) || (pos >= end) || (pos >= p_crc->end[part]))
+        {
+            continue;
+        }
+
+        uint32_t last = (end < p_crc->end[part]) ? end : p_crc->end[part];
+
+        AUDIO_PROFILE_BEGIN(AUDIO_PROFILE_CRC);
+
+        p_crc->crc[part] = crc32_update(p_crc->crc[part],
+                                        &m_audio_read.p_raw[pos - start],
+                                        last - pos);
+
+        AUDIO_PROFILE_END(AUDIO_PROFILE_CRC);
+
+        p_crc->pos[part] = last;
+    }
+
+    audio_crc_check(p_crc, p_layer->audio);
+}
+
+/**
+ * @brief This function provides to check the audio against its CRC.
+ *
+ */
+static void audio_crc_check(audio_crc_t *p_crc, uint8_t audio)
+{
+    for (uint32_t part = 0U; part < AUDIO_CRC_PART_CNT; part++)
+    {
+        if (p_crc->pos[part] < p_crc->end[part])
+        {
+            return;
+        }
+    }
+
+    p_crc->done = true;
+
+    uint32_t crc = crc32_combine(p_crc->crc[0U],
+                                 p_crc->crc[1U],
+                                 p_crc->end[1U] - p_crc->end[0U]);
+
+    if (p_crc->expect == crc)
+    {
+        m_audio_diag.crc_ok_cnt++;
+
+        LOG_INFO("Audio CRC is valid; audio:%u", audio);
+
+        return;
+    }
+
+    m_audio_diag.crc_fail_cnt++;
+
+    LOG_ERROR("Audio CRC mismatch; audio:%u, crc:0x%x, expected:0x%x",
+              audio,
+              crc,
+              p_crc->expect);
+
+    if (false == api_data_dtc_set(API_DATA_LABEL_DTC_CSUM_FAIL, AUDIO_CRC_DTC))
+    {
+        LOG_ERROR("Checksum DTC could not be set");
+    }
+}
+
+/**
+ * @brief This function provides to read the crossfade part of the loop.
+ *
+ */
+static bool audio_xfade_read(audio_layer_t *p_layer,
+                             uint8_t *p_buff,
+                             uint32_t offset)
+{
+    uint32_t fill = p_layer->xfade_fill;
+
+    if (AUDIO_XFADE_SIZE <= fill)
+    {
+        return true;
+    }
+
+    p_layer->xfade_fill += audio_data_read(p_layer,
+                                           &p_buff[fill],
+                                           offset + fill,
+                                           AUDIO_XFADE_SIZE - fill);
+
+    return false;
+}
+
+/**
+ * @brief This function provides to fill the input of the audio buffer.
+ *
+ */
+static bool audio_buff_fill(audio_layer_t *p_layer, audio_buff_t *p_audio)
+{
+    const audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    uint32_t size = p_audio->in_cnt * AUDIO_FRAME_SIZE;
+
+    uint8_t *p_in = audio_buff_in_get(p_audio, size);
+
+    // A block read directly waits for its slot.
+    if (NULL == p_in)
+    {
+        return false;
+    }
+
+    while (p_audio->fill < size)
+    {
+        uint32_t cursor = p_layer->cursor;
+
+        uint32_t part = size - p_audio->fill;
+
+        if (cursor >= p_cfg->xfade_start)
+        {
+            uint32_t left = p_cfg->loop_end - cursor;
+
+            part = (part < left) ? part : left;
+
+            // PRQA S 0310 ++ # The crossfade buffer is copied as bytes.
+            const uint8_t *p_xfade = (const uint8_t *)p_layer->xfade_buff;
+            // PRQA S 0310 --
+
+            (void)memcpy(&p_in[p_audio->fill],
+                         &p_xfade[cursor - p_cfg->xfade_start],
+                         part);
+
+            p_audio->fill += part;
+
+            audio_cursor_move(p_layer, part);
+        }
+        else
+        {
+            uint32_t left = p_cfg->xfade_start - cursor;
+
+            part = (part < left) ? part : left;
+
+            // A failed read leaves stale samples, the timing is kept anyway.
+            part = audio_data_read(p_layer,
+                                   &p_in[p_audio->fill],
+                                   cursor,
+                                   part);
+
+            p_audio->fill += part;
+
+            audio_cursor_move(p_layer, part);
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194253
+ *
+ */
+static inline bool audio_play(void)
+{
+    uint8_t *p_slot[AUDIO_CONF_RING_SLOT_CNT];
+
+    for (uint32_t idx = 0U; idx < AUDIO_CONF_RING_SLOT_CNT; idx++)
+    {
+        p_slot[idx] = (uint8_t *)m_audio_slot_buff[idx];
+    }
+
+    if (false == bsp_i2s_ring_start(p_slot,
+                                    AUDIO_CONF_RING_SLOT_CNT,
+                                    (size_t)audio_block_size_get()))
+    {
+        LOG_ERROR("I2S ring start error");
+
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief This function provides to set the sample rate of the playback.
+ *
+ */
+static void audio_rate_set(uint32_t sample_rate)
+{
+    if (m_audio_param.sample_rate == sample_rate)
+    {
+        return;
+    }
+
+    // The table of the first layer is decoded while the ring is stopped.
+    if (false == bsp_i2s_rate_set(sample_rate))
+    {
+        LOG_ERROR("I2S rate could not set; rate:%u", sample_rate);
+
+        return;
+    }
+
+    if (false == drv_amplifier_rate_set(sample_rate))
+    {
+        LOG_ERROR("Amplifier rate could not set; rate:%u", sample_rate);
+    }
+
+    // A slot keeps its length in time up to the frames it can hold.
+    uint32_t frame_cnt = (AUDIO_BLOCK_FRAME_CNT * sample_rate) /
+                         AUDIO_SAMPLE_RATE;
+
+    if (AUDIO_BLOCK_FRAME_CNT < frame_cnt)
+    {
+        frame_cnt = AUDIO_BLOCK_FRAME_CNT;
+    }
+
+    m_audio_param.sample_rate = sample_rate;
+    m_audio_param.frame_cnt = frame_cnt;
+
+    // The loaded layers of the previous rate would play at a wrong pitch.
+    for (uint32_t layer = 1U; layer < AUDIO_CONF_LAYER_CNT; layer++)
+    {
+        audio_layer_t *p_layer = &m_audio_layer[layer];
+
+        if ((FLASH_READ_STATE_IDLE != p_layer->state) &&
+            (FLASH_READ_STATE_INIT != p_layer->state) &&
+            (sample_rate != p_layer->cfg.sample_rate))
+        {
+            p_layer->ready = false;
+
+            p_layer->state = FLASH_READ_STATE_IDLE;
+
+            LOG_WARNING("Layer stopped by rate; layer:%u", layer);
+        }
+    }
+
+    LOG_INFO("Sample rate; rate:%u, frame:%u", sample_rate, frame_cnt);
+}
+
+/**
+ * @brief This function returns the size of a ring slot.
+ *
+ */
+static inline uint32_t audio_block_size_get(void)
+{
+    return m_audio_param.frame_cnt * AUDIO_FRAME_SIZE;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194797
+ *
+ */
+static inline audio_state_t curr_audio_state_get(void)
+{
+    return m_audio_param.state;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194798
+ *
+ */
+static inline void curr_audio_state_set(audio_state_t state)
+{
+    m_audio_param.state = state;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194803
+ *
+ */
+static inline flash_read_state_t curr_flash_state_get(void)
+{
+    return m_flash_read_state;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194804
+ *
+ */
+static inline void curr_flash_state_set(flash_read_state_t state)
+{
+    m_flash_read_state = state;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194809
+ *
+ */
+static inline void curr_audio_set(uint8_t audio)
+{
+    m_audio_layer[0U].audio = audio;
+
+    LOG_INFO("Audio id selected; id:%u", audio);
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/195193
+ *
+ */
+static inline uint8_t curr_audio_get(void)
+{
+    return m_audio_layer[0U].audio;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/196950
+ *
+ */
+static inline void cfg_tbl_state_set(buffer_state_t status)
+{
+    m_cfg_tbl_state = status;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/196951
+ *
+ */
+static inline buffer_state_t cfg_tbl_state_get(void)
+{
+    return m_cfg_tbl_state;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194261
+ *
+ */
+static void audio_buff_freq_shift(audio_layer_t *p_layer,
+                                  audio_buff_t *p_audio,
+                                  int32_t *p_out)
+{
+    uint32_t in_size = p_audio->in_cnt * AUDIO_FRAME_SIZE;
+
+    audio_resampler_sync(p_layer, p_audio);
+
+    // PRQA S 0310, 3305 ++ # The audio buffers are declared as 32-bit words.
+    const int32_t *p_in =
+        (const int32_t *)&p_audio->p_buff[p_audio->max_size - in_size];
+
+    bool ret = dsp_resampler_process(&p_layer->resampler,
+                                     p_in,
+                                     p_audio->in_cnt,
+                                     p_out,
+                                     m_audio_param.frame_cnt,
+                                     p_audio->step,
+                                     p_audio->step_inc);
+    // PRQA S 0310, 3305 --
+
+    if (false == ret)
+    {
+        LOG_ERROR("Resampler error");
+    }
+
+    p_audio->cur_size = audio_block_size_get();
+}
+
+/**
+ * @brief This function resets the pitch shifter and its block planner.
+ *
+ */
+static inline void audio_resampler_reset(audio_layer_t *p_layer)
+{
+    dsp_resampler_init(&p_layer->resampler, AUDIO_CONF_RESAMPLER_MODE);
+
+    p_layer->plan_phase = dsp_resampler_phase_init_get();
+
+    p_layer->plan_step = DSP_RESAMPLER_STEP_UNITY;
+
+    p_layer->plan_gain = DSP_GAIN_UNITY_Q15;
+}
+
+/**
+ * @brief This function provides to latch the gain and step ramps of a buffer.
+ *
+ */
+static inline void audio_buff_ramp_latch(audio_layer_t *p_layer,
+                                         audio_buff_t *p_audio)
+{
+    // The targets may be rewritten by api_audio_param_update() and
+    // api_audio_layer_set() at any time, they are sampled once here so a
+    // block never sees a half update.
+    uint32_t step_target = p_layer->step;
+
+    uint32_t gain_target = p_layer->gain;
+
+    p_audio->step = p_layer->plan_step;
+    p_audio->step_inc = dsp_resampler_ramp_get(&p_audio->step,
+                                               step_target,
+                                               m_audio_param.frame_cnt);
+
+    // PRQA S 4394 ++ # The ramp never leaves the clamped step range.
+    p_layer->plan_step =
+        p_audio->step +
+        (uint32_t)(p_audio->step_inc * (int32_t)m_audio_param.frame_cnt);
+    // PRQA S 4394 --
+
+    p_audio->gain = p_layer->plan_gain;
+    p_audio->gain_end = gain_target;
+
+    p_layer->plan_gain = p_audio->gain_end;
+}
+
+/**
+ * @brief This function provides to latch the output envelope of a slot.
+ *
+ */
+static void audio_fade_latch(audio_buff_t *p_audio)
+{
+    uint32_t gain = m_audio_fade.gain;
+
+    uint32_t target = DSP_GAIN_UNITY_Q15;
+
+    uint32_t time = m_audio_fade.attack;
+
+    if (true == audio_fade_mute_get())
     {
-        LOG_ERROR("API_AUDIO not initilized");
+        target = 0U;
+
+        time = m_audio_fade.release;
+    }
+
+    p_audio->fade = gain;
+
+    if (gain < target)
+    {
+        uint32_t step = audio_fade_step_get(time);
+
+        gain = ((target - gain) > step) ? (gain + step) : target;
+    }
+    else if (gain > target)
+    {
+        uint32_t step = audio_fade_step_get(time);
+
+        gain = ((gain - target) > step) ? (gain - step) : target;
+    }
+    else
+    {
+        // Placeholder
+    }
+
+    p_audio->fade_end = gain;
+
+    m_audio_fade.gain = gain;
+
+    // The slot after the end of a fade-out is silent, so its blocks are not
+    // read and the audio resumes where it faded out.
+    m_audio_param.job_silent = ((0U == p_audio->fade) && (0U == gain));
+}
+
+/**
+ * @brief This function checks whether the output envelope moves toward
+ *        silence.
+ *
+ */
+static inline bool audio_fade_mute_get(void)
+{
+    // The audio is paused once it runs, so the ring is filled before play.
+    bool pause = ((false == audio_play_get()) &&
+                  (AUDIO_STATE_RUN == curr_audio_state_get()));
+
+    bool standstill = ((true == m_audio_layer[0U].cfg.standstill) &&
+                       (0U == m_audio_param.speed));
+
+    return ((true == m_audio_param.mute) || (true == pause) ||
+            (true == standstill));
+}
+
+/**
+ * @brief This function gives the envelope step of one slot.
+ *
+ */
+static inline uint32_t audio_fade_step_get(uint32_t time)
+{
+    // The fade is counted in frames, so it takes the same time at each
+    // sample rate.
+    uint32_t fade_cnt = (time * m_audio_param.sample_rate) / 1000U;
+
+    if (fade_cnt <= m_audio_param.frame_cnt)
+    {
+        return DSP_GAIN_UNITY_Q15;
+    }
+
+    uint32_t step = (DSP_GAIN_UNITY_Q15 * m_audio_param.frame_cnt) / fade_cnt;
+
+    return (0U == step) ? 1U : step;
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194263
+ *
+ */
+static void audio_buff_edit(audio_buff_t *p_audio)
+{
+    audio_layer_t *p_layer = &m_audio_layer[p_audio->layer];
+
+    // PRQA S 0310, 3305 ++ # The audio buffers are declared as 32-bit words.
+    int32_t *p_slot = (int32_t *)m_audio_slot_buff[p_audio->slot];
+
+    int32_t *p_out = (int32_t *)p_audio->p_buff;
+    // PRQA S 0310, 3305 --
+
+    // The first layer is resampled to the slot, the others in place, the
+    // input buffer is large enough for DSP_RESAMPLER_INPLACE_FRAME_CNT.
+    if (0U == p_audio->layer)
+    {
+        p_out = p_slot;
+    }
+
+    // The resampler runs on every buffer to keep its history continuous.
+    audio_buff_freq_shift(p_layer, p_audio, p_out);
+
+    // PRQA S 0310 ++ # The audio buffers are declared as 32-bit words.
+    audio_buff_db_edit((uint8_t *)p_out,
+                       p_audio->cur_size,
+                       p_audio->gain,
+                       p_audio->gain_end);
+    // PRQA S 0310 --
+
+    if (p_out != p_slot)
+    {
+        dsp_gain_s32_mix(p_slot, p_out, p_audio->cur_size / AUDIO_SAMPLE_SIZE);
+    }
+}
+
+/**
+ * @brief This function checks whether a block may be read to its ring slot.
+ *
+ */
+static inline bool audio_buff_direct_get(const audio_layer_t *p_layer,
+                                         const audio_buff_t *p_audio)
+{
+    const audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    // Only the frames stored in the slot format are played as they are read.
+    bool native = ((AUDIO_FORMAT_PCM == p_cfg->format) &&
+                   (AUDIO_FRAME_SIZE == p_cfg->frame_size));
+
+    bool unity = ((DSP_GAIN_UNITY_Q15 == p_audio->gain) &&
+                  (DSP_GAIN_UNITY_Q15 == p_audio->gain_end));
+
+    return ((0U == p_audio->layer) && (true == p_audio->last) &&
+            (true == native) && (true == unity) &&
+            (true == dsp_resampler_bypass_get(p_audio->phase,
+                                              p_audio->step,
+                                              p_audio->step_inc)));
+}
+
+/**
+ * @brief This function returns where the input of a block is read to.
+ *
+ */
+static uint8_t *audio_buff_in_get(audio_buff_t *p_audio, uint32_t size)
+{
+    if (false == p_audio->direct)
+    {
+        // The input is read to the end of the buffer for the resampler.
+        return &p_audio->p_buff[p_audio->max_size - size];
+    }
+
+    if ((AUDIO_SLOT_NONE == p_audio->slot) &&
+        (false == audio_direct_slot_get(&p_audio->slot)))
+    {
+        return NULL;
+    }
+
+    // PRQA S 0310 ++ # The ring slots are declared as 32-bit words.
+    return (uint8_t *)&m_audio_slot_buff[p_audio->slot]
+                                        [DSP_RESAMPLER_DELAY_CNT *
+                                         DSP_RESAMPLER_CH_CNT];
+    // PRQA S 0310 --
+}
+
+/**
+ * @brief This function checks whether the read stage waits for a slot.
+ *
+ */
+static bool audio_direct_wait_get(void)
+{
+    const audio_layer_t *p_layer = &m_audio_layer[0U];
+
+    const audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    if ((0U != m_audio_param.job_layer) || (false == p_layer->ready) ||
+        (AUDIO_FORMAT_PCM != p_cfg->format) ||
+        (AUDIO_FRAME_SIZE != p_cfg->frame_size))
+    {
+        return false;
+    }
+
+    for (uint32_t next = 1U; next < AUDIO_CONF_LAYER_CNT; next++)
+    {
+        if (true == m_audio_layer[next].ready)
+        {
+            return false;
+        }
+    }
+
+    uint32_t phase = p_layer->plan_phase;
+
+    uint32_t step = p_layer->plan_step;
+
+    // The ramps latched from a flat plan stay at unity, see
+    // audio_buff_ramp_latch(), and the phase is aligned as by the read stage.
+    (void)dsp_resampler_phase_align(&phase,
+                                    &step,
+                                    0,
+                                    m_audio_param.frame_cnt);
+
+    if ((DSP_RESAMPLER_STEP_UNITY != p_layer->step) ||
+        (DSP_GAIN_UNITY_Q15 != p_layer->plan_gain) ||
+        (DSP_GAIN_UNITY_Q15 != p_layer->gain) ||
+        (false == dsp_resampler_bypass_get(phase, step, 0)))
+    {
+        return false;
+    }
+
+    uint32_t slot = 0U;
+
+    return (false == audio_direct_slot_get(&slot));
+}
+
+/**
+ * @brief This function returns the ring slot of the next block of layer 0.
+ *
+ */
+static bool audio_direct_slot_get(uint32_t *p_slot)
+{
+    uint32_t pos = 0U;
+
+    uint32_t cnt = spsc_queue_cnt_get(&m_audio_edit_queue);
+
+    // Each queued block of layer 0 takes a free slot before this block.
+    for (uint32_t item = 0U; item < cnt; item++)
+    {
+        uint32_t idx = 0U;
+
+        if ((true == spsc_queue_peek_at(&m_audio_edit_queue, item, &idx)) &&
+            (0U == m_audio_block[idx].layer))
+        {
+            pos++;
+        }
+    }
+
+    return spsc_queue_peek_at(&m_audio_slot_queue, pos, p_slot);
+}
+
+/**
+ * @brief This function provides to pass a block read to its ring slot.
+ *
+ */
+static void audio_buff_bypass(audio_buff_t *p_audio)
+{
+    audio_layer_t *p_layer = &m_audio_layer[p_audio->layer];
+
+    // PRQA S 0310, 3305 ++ # The ring slots are declared as 32-bit words.
+    int32_t *p_slot = (int32_t *)m_audio_slot_buff[p_audio->slot];
+    // PRQA S 0310, 3305 --
+
+    audio_resampler_sync(p_layer, p_audio);
+
+    if (false == dsp_resampler_bypass(&p_layer->resampler,
+                                      p_slot,
+                                      m_audio_param.frame_cnt))
+    {
+        LOG_ERROR("Resampler bypass error");
+    }
+
+    p_audio->cur_size = audio_block_size_get();
+}
+
+/**
+ * @brief This function provides to move a block read to another ring slot
+ *        back to its input buffer.
+ *
+ */
+static void audio_buff_direct_drop(audio_buff_t *p_audio)
+{
+    LOG_ERROR("Direct slot mismatch; slot:%u, expected:%u",
+              m_audio_param.mix_slot,
+              p_audio->slot);
+
+    uint32_t size = p_audio->in_cnt * AUDIO_FRAME_SIZE;
+
+    // The slot read is still intact, it is taken by the next block only.
+    (void)memcpy(&p_audio->p_buff[p_audio->max_size - size],
+                 &m_audio_slot_buff[p_audio->slot]
+                                   [DSP_RESAMPLER_DELAY_CNT *
+                                    DSP_RESAMPLER_CH_CNT],
+                 size);
+
+    p_audio->direct = false;
+}
+
+/**
+ * @brief This function provides to restore the planned resampler phase.
+ *
+ */
+static inline void audio_resampler_sync(audio_layer_t *p_layer,
+                                        const audio_buff_t *p_audio)
+{
+    // The planned phase is restored when a buffer has been dropped and taken
+    // when it has been aligned by the read stage.
+    if (p_layer->resampler.phase != p_audio->phase)
+    {
+        LOG_DEBUG("Resampler phase resync");
+
+        p_layer->resampler.phase = p_audio->phase;
+    }
+}
+
+/**
+ * @brief https://codebeamer.daiichi.com/issue/194265
+ *
+ */
+static void audio_read_stage(void)
+{
+    uint32_t idx = m_audio_param.read_block;
+
+    // The flash is not busy here, so the pending read has been finished.
+    if (AUDIO_BLOCK_NONE != idx)
+    {
+        audio_buff_t *p_read = &m_audio_block[idx];
+
+        if (false == audio_buff_fill(&m_audio_layer[p_read->layer], p_read))
+        {
+            return;
+        }
+
+        p_read->buff_state = BUFFER_STATE_EDIT;
+
+        (void)spsc_queue_push(&m_audio_edit_queue, idx);
+
+        m_audio_param.read_block = AUDIO_BLOCK_NONE;
+    }
+
+    if (true == audio_direct_wait_get())
+    {
+        return;
+    }
+
+    if (false == spsc_queue_pop(&m_audio_read_queue, &idx))
+    {
+        return;
+    }
+
+    audio_buff_t *p_audio = &m_audio_block[idx];
+
+    uint32_t layer = m_audio_param.job_layer;
+
+    p_audio->head = false;
+
+    p_audio->direct = false;
+
+    // The layers of a slot are taken from the same snapshot, so a layer set
+    // meanwhile joins at the next slot.
+    if (0U == layer)
+    {
+        m_audio_param.job_mask = 1U;
+
+        for (uint32_t next = 1U; next < AUDIO_CONF_LAYER_CNT; next++)
+        {
+            if (true == m_audio_layer[next].ready)
+            {
+                m_audio_param.job_mask |= (1UL << next);
+            }
+        }
+
+        // The first block of a swapped audio ends the switch timing.
+        p_audio->head = m_audio_param.swap_head;
+
+        m_audio_param.swap_head = false;
+
+        // A pending swap waits for this block, which fades the old audio out.
+        m_audio_param.swap_fade = m_audio_param.swap;
+
+        audio_fade_latch(p_audio);
+    }
+
+    p_audio->layer = layer;
+
+    do
+    {
+        layer++;
+    } while ((AUDIO_CONF_LAYER_CNT > layer) &&
+             (0U == (m_audio_param.job_mask & (1UL << layer))));
+
+    p_audio->last = (AUDIO_CONF_LAYER_CNT <= layer);
+
+    m_audio_param.job_layer = (true == p_audio->last) ? 0U : layer;
+
+    audio_layer_t *p_layer = &m_audio_layer[p_audio->layer];
+
+    bool synth = (AUDIO_FORMAT_SYNTH == p_layer->cfg.format);
+
+    if ((true == m_audio_param.job_silent) || (false == p_layer->ready) ||
+        ((false == synth) && (0U == p_layer->cfg.loop_end)))
+    {
+        // A silent block is not read, so the audio resumes where it was
+        // muted.
+        p_audio->in_cnt = 0U;
+
+        p_audio->buff_state = BUFFER_STATE_EDIT;
+
+        (void)spsc_queue_push(&m_audio_edit_queue, idx);
+
+        return;
+    }
+
+    p_audio->buff_state = BUFFER_STATE_READ_WAIT;
+
+    // The ramps are latched here, so the resampler consumes exactly the
+    // frames read for this block.
+    audio_buff_ramp_latch(p_layer, p_audio);
+
+    if ((0U == p_audio->layer) && (true == m_audio_param.swap_fade))
+    {
+        // The swapped audio ramps up from silence over its first block.
+        p_audio->gain_end = 0U;
+
+        p_layer->plan_gain = 0U;
+    }
+
+    // A pitch ramp leaves a fraction in the phase, it is moved out once the
+    // step has settled at unity so layer 0 may be read directly again. The
+    // planned step stays at unity.
+    (void)dsp_resampler_phase_align(&p_layer->plan_phase,
+                                    &p_audio->step,
+                                    p_audio->step_inc,
+                                    m_audio_param.frame_cnt);
+
+    p_audio->phase = p_layer->plan_phase;
+    p_audio->in_cnt = dsp_resampler_plan(&p_layer->plan_phase,
+                                         m_audio_param.frame_cnt,
+                                         p_audio->step,
+                                         p_audio->step_inc);
+
+    p_audio->cur_size = audio_block_size_get();
+
+    p_audio->fill = 0U;
+
+    if (true == synth)
+    {
+        uint32_t size = p_audio->in_cnt * AUDIO_FRAME_SIZE;
+
+        // PRQA S 0310 ++ # The audio buffers are declared as 32-bit words.
+        int32_t *p_in = (int32_t *)&p_audio->p_buff[p_audio->max_size - size];
+        // PRQA S 0310 --
+
+        // The pitch and the gain curves are applied by the edit stage as for
+        // the flash audio.
+        AUDIO_PROFILE_BEGIN(AUDIO_PROFILE_SYNTH);
+
+        dsp_osc_render(p_layer->osc, AUDIO_CONF_OSC_CNT, p_in, p_audio->in_cnt);
+
+        AUDIO_PROFILE_END(AUDIO_PROFILE_SYNTH);
+
+        p_audio->buff_state = BUFFER_STATE_EDIT;
+
+        (void)spsc_queue_push(&m_audio_edit_queue, idx);
+
+        return;
+    }
+
+    p_audio->direct = audio_buff_direct_get(p_layer, p_audio);
+
+    p_audio->slot = AUDIO_SLOT_NONE;
+
+    m_audio_param.read_block = idx;
+
+    if (true == audio_buff_fill(p_layer, p_audio))
+    {
+        // The whole input has been copied from the crossfade buffer.
+        p_audio->buff_state = BUFFER_STATE_EDIT;
+
+        (void)spsc_queue_push(&m_audio_edit_queue, idx);
+
+        m_audio_param.read_block = AUDIO_BLOCK_NONE;
+    }
+}
+
+/**
+ * @brief This function provides the edit stage of the pipeline.
+ *
+ */
+static void audio_edit_stage(void)
+{
+    uint32_t idx = 0U;
 
-        return false;
+    if (false == spsc_queue_peek(&m_audio_edit_queue, &idx))
+    {
+        return;
     }
 
-    bool ret = drv_amplifier_mute();
+    audio_buff_t *p_audio = &m_audio_block[idx];
 
-    if (false == ret)
+    // The first layer takes a played slot, the other layers are mixed into
+    // the same slot.
+    if (0U == p_audio->layer)
     {
-        LOG_ERROR("Amplifier mute error");
+        uint32_t slot = 0U;
 
-        return false;
-    }
-    else
-    {
-        LOG_INFO("Amplifier mute");
+        if (false == spsc_queue_pop(&m_audio_slot_queue, &slot))
+        {
+            return;
+        }
+
+        m_audio_param.mix_slot = slot;
+
+        m_audio_param.mix_head = p_audio->head;
+
+        m_audio_param.mix_fade = p_audio->fade;
+        m_audio_param.mix_fade_end = p_audio->fade_end;
     }
 
-    m_audio_param.mute = true;
+    (void)spsc_queue_pop(&m_audio_edit_queue, &idx);
 
-    if (BUFFER_STATE_READY == curr_buff_state_get())
+    uint32_t slot = m_audio_param.mix_slot;
+
+    if ((true == p_audio->direct) && (slot != p_audio->slot))
     {
-        audio_buff_curr_to_mute_switch();
+        audio_buff_direct_drop(p_audio);
     }
 
-    return true;
-}
+    p_audio->slot = slot;
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194091
- *
- */
-bool api_audio_unmute(void)
-{
-    if (false == m_api_audio_init)
+    if (true == p_audio->direct)
     {
-        LOG_ERROR("API_AUDIO not initilized");
+        audio_buff_bypass(p_audio);
 
-        return false;
+        m_audio_diag.block_direct_cnt++;
     }
+    else if (0U != p_audio->in_cnt)
+    {
+        AUDIO_PROFILE_BEGIN(AUDIO_PROFILE_EDIT);
 
-    bool ret = drv_amplifier_unmute();
+        audio_buff_edit(p_audio);
 
-    if (false == ret)
-    {
-        LOG_ERROR("Amplifier unmute error");
+        AUDIO_PROFILE_END(AUDIO_PROFILE_EDIT);
 
-        return false;
+        m_audio_diag.block_edit_cnt++;
+    }
+    else if (0U == p_audio->layer)
+    {
+        (void)memset(m_audio_slot_buff[slot], 0, AUDIO_BLOCK_SIZE);
     }
     else
     {
-        LOG_INFO("Amplifier unmute");
+        // Placeholder
     }
 
-    m_audio_param.mute = false;
+    // A slot silenced by the envelope is already zero, so the chains are
+    // skipped with the reads.
+    if ((true == p_audio->last) &&
+        ((0U != m_audio_param.mix_fade) || (0U != m_audio_param.mix_fade_end)))
+    {
+        AUDIO_PROFILE_BEGIN(AUDIO_PROFILE_CHAIN);
+
+        // PRQA S 0310 ++ # The ring slots are declared as 32-bit words.
+        dsp_chain_process(&m_audio_chain,
+                          (int32_t *)m_audio_slot_buff[slot],
+                          m_audio_param.frame_cnt);
+
+        // The envelope follows the limiters, so a fade ends at silence.
+        audio_buff_db_edit((uint8_t *)m_audio_slot_buff[slot],
+                           m_audio_param.frame_cnt * AUDIO_FRAME_SIZE,
+                           m_audio_param.mix_fade,
+                           m_audio_param.mix_fade_end);
+        // PRQA S 0310 --
 
-    if (BUFFER_STATE_READY == curr_buff_state_get())
+        AUDIO_PROFILE_END(AUDIO_PROFILE_CHAIN);
+    }
+
+    if (true == p_audio->last)
     {
-        audio_buff_curr_to_spare_switch();
+        audio_slot_commit(slot);
     }
 
-    return true;
+    p_audio->buff_state = BUFFER_STATE_IDLE;
+
+    (void)spsc_queue_push(&m_audio_read_queue, idx);
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194095
+ * @brief This function provides to queue the filled ring slot.
  *
  */
-bool api_audio_play(void)
+static void audio_slot_commit(uint32_t slot)
 {
-    if (false == m_api_audio_init)
-    {
-        LOG_ERROR("API_AUDIO not initilized");
+    // The flag is cleared before the commit. A slot replayed by an underrun
+    // is then queued again by the interrupt once it ends.
+    m_audio_slot_queued[slot] = false;
 
-        return false;
+    if ((0U != m_audio_param.mix_fade) || (0U != m_audio_param.mix_fade_end))
+    {
+        m_audio_param.silent_cnt = 0U;
+    }
+    else if (AUDIO_CONF_RING_SLOT_CNT > m_audio_param.silent_cnt)
+    {
+        m_audio_param.silent_cnt++;
+    }
+    else
+    {
+        // Placeholder
     }
 
-    bool ret = false;
-
-    audio_play_set(true);
+    if (true == m_audio_param.mix_head)
+    {
+        m_audio_param.mix_head = false;
 
-    LOG_INFO("Audio play");
+        audio_diag_switch_end();
+    }
 
-    if (AUDIO_STATE_READY == curr_audio_state_get())
+    if (true == m_audio_param.ring_run)
     {
-        curr_audio_state_set(AUDIO_STATE_RUN);
+        audio_diag_refill(slot);
 
-        ret = true;
+        if (false == bsp_i2s_slot_commit(slot))
+        {
+            LOG_ERROR("Slot commit error; slot:%u", slot);
+        }
+    }
+    else
+    {
+        m_audio_param.fill_cnt++;
     }
-
-    return ret;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/197386
+ * @brief This function provides to count the margin of a refilled slot.
  *
  */
-bool api_audio_pause(void)
+static void audio_diag_refill(uint32_t slot)
 {
-    if (false == m_api_audio_init)
-    {
-        LOG_ERROR("API_AUDIO not initilized");
+    // The slots ahead of the refilled one are played first. The playing slot
+    // may be about to end, so it does not count.
+    uint32_t ahead = ((slot + AUDIO_CONF_RING_SLOT_CNT) - m_audio_play_slot) %
+                     AUDIO_CONF_RING_SLOT_CNT;
 
-        return false;
-    }
+    uint32_t headroom = 0U;
 
-    audio_play_set(false);
+    if (1U < ahead)
+    {
+        headroom = ((ahead - 1U) * m_audio_param.frame_cnt * 1000000U) /
+                   m_audio_param.sample_rate;
+    }
+    else
+    {
+        m_audio_diag.late_cnt++;
+    }
 
-    LOG_INFO("Audio pause");
+    if (headroom < m_audio_diag.headroom_min)
+    {
+        m_audio_diag.headroom_min = headroom;
+    }
 
-    return true;
+    m_audio_diag.refill_cnt++;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/197387
+ * @brief This function provides to count the latency of a switch.
  *
  */
-bool api_audio_status_get(void)
+static void audio_diag_switch_end(void)
 {
-    bool status = audio_play_get();
+    if (false == m_audio_diag.switch_wait)
+    {
+        return;
+    }
 
-    return status;
-}
+    m_audio_diag.switch_wait = false;
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194093
- *
- */
-void api_audio_param_update(uint16_t speed)
-{
-    if (false == m_api_audio_init)
+    uint32_t latency = bsp_mcu_tick_get() - m_audio_diag.switch_tick;
+
+    m_audio_diag.switch_cnt++;
+
+    if (true == m_audio_diag.switch_fast)
     {
-        LOG_ERROR("API_AUDIO not initilized");
+        m_audio_diag.switch_fast_cnt++;
+    }
 
-        return;
+    m_audio_diag.switch_last = latency;
+
+    if (latency > m_audio_diag.switch_max)
+    {
+        m_audio_diag.switch_max = latency;
     }
 
-    audio_param_update(speed);
+    LOG_INFO("Switch done; fast:%u, latency:%u ms",
+             m_audio_diag.switch_fast,
+             latency);
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194094
+ * @brief This function provides to stop the playback ring.
  *
  */
-bool api_audio_switch(uint8_t audio_num)
+static void audio_ring_reset(void)
 {
-    if (false == m_api_audio_init)
+    if (true == m_audio_param.ring_run)
     {
-        LOG_ERROR("API_AUDIO not initilized");
+        uint32_t underrun = bsp_i2s_underrun_cnt_get();
 
-        return false;
-    }
+        LOG_INFO("Ring stopped; underrun:%u", underrun);
 
-    uint8_t curr_audio = curr_audio_get();
+        m_audio_diag.underrun_base += underrun;
 
-    if (audio_num == curr_audio)
-    {
-        return true;
-    }
+        for (uint32_t mode = 0U; mode < (uint32_t)BSP_I2S_MODE_CNT; mode++)
+        {
+            m_audio_diag.irq_base[mode] +=
+                bsp_i2s_irq_cnt_get((bsp_i2s_mode_t)mode);
+        }
 
-    if (API_AUDIO_3 < curr_audio)
-    {
-        LOG_ERROR("Invalid audio number for switching: %u", curr_audio);
+        if (true == m_audio_param.ring_silent)
+        {
+            audio_silence_end();
+        }
 
-        return false;
+        (void)bsp_i2s_ring_stop();
+
+        m_audio_param.ring_run = false;
     }
 
-    curr_audio_set(audio_num);
+    m_audio_param.silent_cnt = 0U;
 
-    cfg_tbl_addr_set(audio_num);
+    (void)spsc_queue_init(&m_audio_read_queue,
+                          m_audio_read_item,
+                          SPSC_QUEUE_STORAGE_SIZE(AUDIO_CONF_BLOCK_CNT));
 
-    audio_addr_set(audio_num);
+    (void)spsc_queue_init(&m_audio_edit_queue,
+                          m_audio_edit_item,
+                          SPSC_QUEUE_STORAGE_SIZE(AUDIO_CONF_BLOCK_CNT));
 
-    curr_audio_state_set(AUDIO_STATE_SWITCH);
+    (void)spsc_queue_init(&m_audio_slot_queue,
+                          m_audio_slot_item,
+                          SPSC_QUEUE_STORAGE_SIZE(AUDIO_CONF_RING_SLOT_CNT));
 
-    LOG_INFO("Switch Audio-%u to Audio-%u",
-             (m_audio_param.curr_audio),
-             (audio_num));
+    for (uint32_t idx = 0U; idx < AUDIO_CONF_BLOCK_CNT; idx++)
+    {
+        m_audio_block[idx].buff_state = BUFFER_STATE_IDLE;
 
-    return true;
-}
+        (void)spsc_queue_push(&m_audio_read_queue, idx);
+    }
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194477
- *
- */
-bool api_audio_name_get(char_t *p_name)
-{
-    if (NULL == p_name)
+    for (uint32_t slot = 0U; slot < AUDIO_CONF_RING_SLOT_CNT; slot++)
     {
-        LOG_ERROR("Invalid argument in api_audio_name_get");
+        m_audio_slot_queued[slot] = true;
 
-        return false;
+        (void)spsc_queue_push(&m_audio_slot_queue, slot);
     }
 
-    if ((true == m_api_audio_init) &&
-        (BUFFER_STATE_READY == cfg_tbl_state_get()))
-    {
-        const char_t *p_tmp =
-            (char_t *)&m_audio_cfg_tbl[CFG_TBL_AUDIO_NAME_OFFSET];
+    m_audio_play_slot = 0U;
 
-        (void)strncpy(p_name, p_tmp, CFG_TBL_NAME_PARAM_SIZE);
+    m_audio_param.fill_cnt = 0U;
 
-        p_name[CFG_TBL_NAME_PARAM_SIZE] = '\0';
+    m_audio_param.read_block = AUDIO_BLOCK_NONE;
 
-        return true;
-    }
+    m_audio_param.job_layer = 0U;
 
-    return false;
-}
+    m_audio_param.swap_fade = false;
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194478
- *
- */
-bool api_audio_size_get(uint32_t *p_size)
-{
-    if (NULL == p_size)
-    {
-        LOG_ERROR("Invalid argument in api_audio_size_get");
+    m_audio_param.swap_head = false;
 
-        return false;
-    }
+    m_audio_param.mix_head = false;
 
-    if ((true == m_api_audio_init) &&
-        (BUFFER_STATE_READY == cfg_tbl_state_get()))
-    {
-        const uint8_t *p_addr = &m_audio_cfg_tbl[CFG_TBL_SIZE_OFFSET];
+    m_audio_read.pending = false;
 
-        *p_size = uint32_convert(p_addr);
+    m_audio_read.raw_size = 0U;
 
-        return true;
+    // The reads of the dropped blocks have moved the decoders.
+    for (uint32_t layer = 0U; layer < AUDIO_CONF_LAYER_CNT; layer++)
+    {
+        m_audio_layer[layer].adpcm.pos = AUDIO_ADPCM_POS_NONE;
     }
-
-    return false;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194479
+ * @brief https://codebeamer.daiichi.com/issue/194439
  *
  */
-bool api_audio_calib_date_get(char_t *p_calib_date)
+static bool audio_init_state_check(void)
 {
-    if (NULL == p_calib_date)
+    if (FLASH_READ_STATE_INIT == curr_flash_state_get())
     {
-        LOG_ERROR("Invalid argument in api_audio_calib_date_get");
+        uint32_t addr = cfg_tbl_addr_get(&m_audio_layer[0U]);
+
+        bool ret = api_data_read(addr,
+                                 m_audio_cfg_tbl,
+                                 API_DATA_AUDIO_CFG_TBL_SIZE,
+                                 0U);
+
+        if (true == ret)
+        {
+            curr_flash_state_set(FLASH_READ_STATE_CFG_TBL);
+        }
 
         return false;
     }
 
-    if ((true == m_api_audio_init) &&
-        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    if (AUDIO_CONF_RING_SLOT_CNT <= m_audio_param.fill_cnt)
     {
-        const char_t *p_tmp =
-            (char_t *)&m_audio_cfg_tbl[CFG_TBL_CALIB_DATE_OFFSET];
-
-        (void)strncpy(p_calib_date,
-                      p_tmp,
-                      CFG_TBL_CALIB_DATE_PARAM_SIZE);
-
-        p_calib_date[CFG_TBL_CALIB_DATE_PARAM_SIZE] = '\0';
-
         return true;
     }
 
@@ -1242,814 +5589,863 @@ bool api_audio_calib_date_get(char_t *p_calib_date)
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194480
+ * @brief https://codebeamer.daiichi.com/issue/194259
  *
  */
-bool api_audio_calib_tool_get(char_t *p_tool_version)
+static void audio_run_state_check(void)
 {
-    if (NULL == p_tool_version)
+    if (false == m_audio_param.ring_run)
     {
-        LOG_ERROR("Invalid argument in api_audio_calib_tool_get");
+        m_audio_param.ring_run = audio_play();
 
-        return false;
+        // The first slot of a slow switch is played once the ring starts.
+        if ((true == m_audio_param.ring_run) &&
+            (false == m_audio_diag.switch_fast))
+        {
+            audio_diag_switch_end();
+        }
     }
-
-    if ((true == m_api_audio_init) &&
-        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    else
     {
-        const char_t *p_addr =
-            (char_t *)&m_audio_cfg_tbl[CFG_TBL_CALIB_TOOL_VER_OFFSET];
-
-        (void)strncpy(p_tool_version,
-                      p_addr,
-                      CFG_TBL_CALIB_TOOL_VER_PARAM_SIZE);
-
-        p_tool_version[CFG_TBL_CALIB_TOOL_VER_PARAM_SIZE] = '\0';
-
-        return true;
+        audio_silence_check();
     }
-
-    return false;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194481
+ * @brief This function provides to switch the I2S to the silence and back.
  *
  */
-bool api_audio_calib_ver_get(char_t *p_calib_version)
+static void audio_silence_check(void)
 {
-    if (NULL == p_calib_version)
-    {
-        LOG_ERROR("Invalid argument in api_audio_calib_ver_get");
-
-        return false;
-    }
+    bool mute = audio_fade_mute_get();
 
-    if ((true == m_api_audio_init) &&
-        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    if ((false == m_audio_param.ring_silent) && (true == mute) &&
+        (AUDIO_CONF_RING_SLOT_CNT <= m_audio_param.silent_cnt))
     {
-        const char_t *p_addr =
-            (char_t *)&m_audio_cfg_tbl[CFG_TBL_CALIB_VER_OFFSET];
+        // Each slot is silent, so the playing one can be cut.
+        if (true == bsp_i2s_silence_set(true))
+        {
+            m_audio_param.ring_silent = true;
 
-        (void)strncpy(p_calib_version,
-                      p_addr,
-                      CFG_TBL_CALIB_VER_PARAM_SIZE);
+            m_audio_diag.silence_tick = bsp_mcu_tick_get();
+            m_audio_diag.silence_cnt++;
 
-        p_calib_version[CFG_TBL_CALIB_VER_PARAM_SIZE] = '\0';
+            if (true == m_audio_param.mute)
+            {
+                (void)audio_amplifier_mute();
+            }
+        }
+    }
+    else if ((true == m_audio_param.ring_silent) && (false == mute))
+    {
+        // The cut slot is queued by the callback, the ring goes on with the
+        // silent slots and then with the fade-in.
+        if (false == bsp_i2s_silence_set(false))
+        {
+            LOG_ERROR("Ring could not resume");
+        }
 
-        return true;
+        audio_silence_end();
+    }
+    else
+    {
+        // Placeholder
     }
-
-    return false;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194482
+ * @brief This function provides to mute the amplifier.
  *
  */
-bool api_audio_freq_get(uint16_t *p_freq, uint32_t offset)
+static bool audio_amplifier_mute(void)
 {
-    if (NULL == p_freq)
-    {
-        LOG_ERROR("Invalid argument in api_audio_freq_get");
+    bool ret = drv_amplifier_mute();
 
-        return false;
+    if (false == ret)
+    {
+        LOG_ERROR("Amplifier mute error");
     }
-
-    if ((true == m_api_audio_init) &&
-        (BUFFER_STATE_READY == cfg_tbl_state_get()))
+    else
     {
-        const uint8_t *p_addr = &m_audio_cfg_tbl[CFG_TBL_FREQ_OFFSET + offset];
-
-        *p_freq = uint16_convert(p_addr);
-
-        return true;
+        LOG_INFO("Amplifier mute");
     }
 
-    return false;
+    return ret;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194483
+ * @brief This function provides to end the silence of the I2S.
  *
  */
-bool api_audio_gain_get(uint16_t *p_gain, uint32_t offset)
+static void audio_silence_end(void)
 {
-    if (NULL == p_gain)
-    {
-        LOG_ERROR("Invalid argument in api_audio_gain_get");
+    m_audio_param.ring_silent = false;
 
-        return false;
-    }
-
-    if ((true == m_api_audio_init) &&
-        (BUFFER_STATE_READY == cfg_tbl_state_get()))
-    {
-        const uint8_t *p_addr = &m_audio_cfg_tbl[CFG_TBL_GAIN_OFFSET + offset];
-
-        *p_gain = uint16_convert(p_addr);
-
-        return true;
-    }
+    m_audio_param.silent_cnt = 0U;
 
-    return false;
+    m_audio_diag.silence_time += bsp_mcu_tick_get() -
+                                 m_audio_diag.silence_tick;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194484
+ * @brief https://codebeamer.daiichi.com/issue/194089
  *
  */
-bool api_audio_ver_get(char_t *p_version)
+static void flash_state_manager(void)
 {
-    if (NULL == p_version)
+    flash_read_state_t curr_state = curr_flash_state_get();
+
+    static flash_read_state_t log_state = 0xFFU;
+
+    if (log_state != curr_state)
     {
-        LOG_ERROR("Invalid argument in api_audio_ver_get");
+        LOG_DEBUG("Flash Process, Prev state: %u, New state: %u", 
+                   log_state,
+                   curr_state);
 
-        return false;
+        log_state = curr_state;
     }
 
-    if ((true == m_api_audio_init) &&
-        (BUFFER_STATE_READY == cfg_tbl_state_get()))
-    {
-        const char_t *p_addr = (char_t *)&m_audio_cfg_tbl[CFG_TBL_VER_OFFSET];
+    // The flash is not busy here, so the last read has been finished.
+    audio_read_finish();
 
-        (void)strncpy(p_version,
-                      p_addr,
-                      CFG_TBL_VER_PARAM_SIZE);
+    if ((FLASH_READ_STATE_CFG_TBL == curr_state) ||
+        (FLASH_READ_STATE_CURVE == curr_state) ||
+        (FLASH_READ_STATE_XFADE_TAIL == curr_state) ||
+        (FLASH_READ_STATE_XFADE_HEAD == curr_state))
+    {
+        bool decode = (FLASH_READ_STATE_CFG_TBL == curr_state);
 
-        p_version[CFG_TBL_VER_PARAM_SIZE] = '\0';
+        // The input blocks are not in use before the layer is loaded.
+        // PRQA S 0310 ++ # The audio buffers are declared as 32-bit words.
+        curr_state = audio_layer_load(&m_audio_layer[0U],
+                                      curr_state,
+                                      m_audio_cfg_tbl,
+                                      (uint8_t *)m_audio_in_buff[0U]);
+        // PRQA S 0310 --
 
-        return true;
-    }
+        if (true == decode)
+        {
+            cfg_tbl_state_set(BUFFER_STATE_READY);
 
-    return false;
-}
+            audio_rate_set(m_audio_layer[0U].cfg.sample_rate);
+        }
 
-/*******************************************************************************
- * Private Functions
- ******************************************************************************/
+        if (FLASH_READ_STATE_AUDIO_BUFF == curr_state)
+        {
+            audio_spi_budget_check();
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194850
- *
- */
-static inline uint16_t uint16_convert(const uint8_t *p_data)
-{
-    uint16_t val = 0U;
+            audio_chain_reset();
 
-    // PRQA S 1863 ++ # The daiichi_types macro is being used.
-    // PRQA S 3396 ++ # The daiichi_types macro is being used. The extra parantheses suggestion cannot be applied.
-    bool endian = IS_LITTLE_ENDIAN;
-    // PRQA S 3396 --
-    // PRQA S 1863 --
+            // PRQA S 0310 ++ # The audio buffers are declared as 32-bit words.
+            curr_state = audio_chain_read(&m_audio_layer[0U],
+                                          (uint8_t *)m_audio_in_buff[0U]);
+            // PRQA S 0310 --
+        }
 
-    if (false == endian)
+        curr_flash_state_set(curr_state);
+    }
+    else if (FLASH_READ_STATE_CHAIN == curr_state)
     {
-        val = val + (uint16_t)((uint16_t)p_data[1U] <<  8U);
-        val = val + (uint16_t)((uint16_t)p_data[0U] <<  0U);
+        // PRQA S 0310 ++ # The audio buffers are declared as 32-bit words.
+        audio_chain_decode((const uint8_t *)m_audio_in_buff[0U]);
+        // PRQA S 0310 --
+
+        curr_state = FLASH_READ_STATE_AUDIO_BUFF;
+
+        curr_flash_state_set(curr_state);
     }
     else
     {
-        val = val + (uint16_t)((uint16_t)p_data[0U] <<  8U);
-        val = val + (uint16_t)((uint16_t)p_data[1U] <<  0U);
+        // Placeholder
     }
 
-    return val;
+    if (FLASH_READ_STATE_AUDIO_BUFF == curr_state)
+    {
+#if (1U == AUDIO_CONF_STANDBY)
+        // The standby layer is swapped in before the first layer of a slot
+        // is read, so no block holds parts of both audios. The block read
+        // before has faded layer 0 out.
+        if ((true == m_audio_param.swap) &&
+            (true == m_audio_param.swap_fade) &&
+            (AUDIO_BLOCK_NONE == m_audio_param.read_block) &&
+            (0U == m_audio_param.job_layer))
+        {
+            audio_standby_swap();
+        }
+#endif
+
+        audio_read_stage();
+
+        // The other layers are loaded while the read stage waits for a slot.
+        if (AUDIO_BLOCK_NONE != m_audio_param.read_block)
+        {
+            // Placeholder
+        }
+        else if (BUFFER_STATE_READY != cfg_tbl_state_get())
+        {
+            audio_cfg_tbl_reload();
+        }
+        else
+        {
+#if (1U == AUDIO_LAYER_LOAD)
+            audio_layer_load_run();
+#else
+            // Placeholder
+#endif
+        }
+    }
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194851
+ * @brief This function provides to load a layer.
  *
  */
-static uint32_t uint32_convert(const uint8_t *p_data)
+static flash_read_state_t audio_layer_load(audio_layer_t *p_layer,
+                                           flash_read_state_t state,
+                                           const uint8_t *p_tbl,
+                                           uint8_t *p_head)
 {
-    uint32_t val = 0U;
+    const audio_cfg_t *p_cfg = &p_layer->cfg;
+
+    if (FLASH_READ_STATE_CFG_TBL == state)
+    {
+        cfg_tbl_decode(p_layer, p_tbl);
+
+        // The first layer sets the rate, the other layers are mixed at it.
+        if ((&m_audio_layer[0U] != p_layer) &&
+            (m_audio_param.sample_rate != p_cfg->sample_rate))
+        {
+            LOG_ERROR("Layer rate is not the played rate; rate:%u",
+                      p_cfg->sample_rate);
+
+            return FLASH_READ_STATE_IDLE;
+        }
+
+        audio_layer_reset(p_layer);
+
+        state = FLASH_READ_STATE_CURVE;
+
+        if (false == audio_curve_read(p_layer, p_head))
+        {
+            state = audio_loop_state_get(p_cfg);
+        }
+    }
+    else if (FLASH_READ_STATE_CURVE == state)
+    {
+        audio_curve_decode(p_layer, p_head);
 
-    // PRQA S 1863 ++ # The daiichi_types macro is being used.
-    // PRQA S 3396 ++ # The daiichi_types macro is being used. The extra parantheses suggestion cannot be applied.
-    bool endian = IS_LITTLE_ENDIAN;
-    // PRQA S 3396 --
-    // PRQA S 1863 --
+        state = audio_loop_state_get(p_cfg);
+    }
+    else if (FLASH_READ_STATE_XFADE_TAIL == state)
+    {
+        // PRQA S 0310 ++ # The crossfade buffer is read as bytes.
+        bool ret = audio_xfade_read(p_layer,
+                                    (uint8_t *)p_layer->xfade_buff,
+                                    p_cfg->xfade_start);
+        // PRQA S 0310 --
+
+        if (true == ret)
+        {
+            p_layer->xfade_fill = 0U;
 
-    if (false == endian)
+            state = FLASH_READ_STATE_XFADE_HEAD;
+        }
+    }
+    else if (FLASH_READ_STATE_XFADE_HEAD == state)
     {
-        val = val + ((uint32_t)p_data[3U] << 24U);
-        val = val + ((uint32_t)p_data[2U] << 16U);
-        val = val + ((uint32_t)p_data[1U] <<  8U);
-        val = val + ((uint32_t)p_data[0U] <<  0U);
+        if (true == audio_xfade_read(p_layer, p_head, p_cfg->loop_start))
+        {
+            // PRQA S 0310, 3305 ++ # The buffer is aligned to 32-bit words.
+            dsp_gain_s32_xfade(p_layer->xfade_buff,
+                               (const int32_t *)p_head,
+                               AUDIO_CONF_XFADE_FRAME_CNT,
+                               DSP_RESAMPLER_CH_CNT);
+            // PRQA S 0310, 3305 --
+
+            p_layer->xfade_fill = 0U;
+
+            state = FLASH_READ_STATE_AUDIO_BUFF;
+        }
     }
     else
     {
-        val = val + ((uint32_t)p_data[0U] << 24U);
-        val = val + ((uint32_t)p_data[1U] << 16U);
-        val = val + ((uint32_t)p_data[2U] <<  8U);
-        val = val + ((uint32_t)p_data[3U] <<  0U);
+        // Placeholder
     }
 
-    return val;
+    // The layer is played from the next slot on.
+    if (FLASH_READ_STATE_AUDIO_BUFF == state)
+    {
+        p_layer->ready = true;
+
+        audio_layer_update(p_layer);
+    }
+
+    return state;
 }
 
+#if (1U == AUDIO_LAYER_LOAD)
 /**
- * @brief https://codebeamer.daiichi.com/issue/194260
+ * @brief This function provides to go on loading the layers.
  *
  */
-static inline void local_var_reset(void)
+static void audio_layer_load_run(void)
 {
-    m_audio_param.cursor = 0U;
+    uint32_t layer = m_audio_param.load_layer;
 
-    m_audio_param.cfg_tbl_addr = 0U;
+    if (AUDIO_LAYER_NONE == layer)
+    {
+        for (layer = 1U; layer < AUDIO_CONF_LAYER_CNT; layer++)
+        {
+            if (FLASH_READ_STATE_INIT == m_audio_layer[layer].state)
+            {
+                break;
+            }
+        }
 
-    m_audio_param.audio_addr = 0U;
+        if (AUDIO_CONF_LAYER_CNT <= layer)
+        {
+#if (1U == AUDIO_CONF_STANDBY)
+            // The standby layer is loaded after the layers of the mixer.
+            if (FLASH_READ_STATE_INIT != m_audio_standby.layer.state)
+            {
+                return;
+            }
 
-    m_audio_param.size = 0U;
+            layer = AUDIO_LAYER_STANDBY;
+#else
+            return;
+#endif
+        }
 
-    audio_play_set(false);
+        m_audio_param.load_layer = layer;
+    }
 
-    curr_flash_state_set(FLASH_READ_STATE_INIT);
+    audio_layer_t *p_layer = audio_load_layer_get(layer);
 
-    curr_audio_state_set(AUDIO_STATE_INIT);
+    // PRQA S 0310 ++ # The table buffer is declared as 32-bit words.
+    uint8_t *p_tbl = (uint8_t *)m_audio_layer_tbl;
+    // PRQA S 0310 --
 
-    cfg_tbl_state_set(BUFFER_STATE_IDLE);
+    if (FLASH_READ_STATE_INIT == p_layer->state)
+    {
+        bool ret = api_data_read(cfg_tbl_addr_get(p_layer),
+                                 p_tbl,
+                                 API_DATA_AUDIO_CFG_TBL_SIZE,
+                                 0U);
 
-    m_curr_buff.p_buff = m_audio_buff_1;
-    m_curr_buff.max_size = AUDIO_BUFF_SIZE;
-    m_curr_buff.cur_size = AUDIO_BUFF_SIZE;
-    m_curr_buff.shifting_rate = AUDIO_SHIFTING_RATE;
-    m_curr_buff.buff_state = BUFFER_STATE_IDLE;
+        if (true == ret)
+        {
+            p_layer->state = FLASH_READ_STATE_CFG_TBL;
+        }
 
-    m_spare_buff.p_buff = m_audio_buff_2;
-    m_spare_buff.max_size = AUDIO_BUFF_SIZE;
-    m_spare_buff.cur_size = AUDIO_BUFF_SIZE;
-    m_spare_buff.shifting_rate = AUDIO_SHIFTING_RATE;
-    m_spare_buff.buff_state = BUFFER_STATE_IDLE;
+        return;
+    }
 
-    (void)memset(m_audio_buff_1, 0, AUDIO_BUFF_SIZE);
+#if (1U == AUDIO_CONF_STANDBY)
+    if (FLASH_READ_STATE_CHAIN == p_layer->state)
+    {
+        // Only the standby layer reads its speaker chain table.
+        m_audio_standby.chain = true;
 
-    (void)memset(m_audio_buff_2, 0, AUDIO_BUFF_SIZE);
+        p_layer->state = FLASH_READ_STATE_AUDIO_BUFF;
+    }
+    else
+#endif
+    if (FLASH_READ_STATE_IDLE != p_layer->state)
+    {
+        // The table is decoded before the buffer receives the loop start.
+        p_layer->state = audio_layer_load(p_layer,
+                                          p_layer->state,
+                                          p_tbl,
+                                          p_tbl);
 
-    (void)memset(m_audio_cfg_tbl, 0, API_DATA_AUDIO_CFG_TBL_SIZE);
-}
+        if (FLASH_READ_STATE_AUDIO_BUFF != p_layer->state)
+        {
+            return;
+        }
 
-/**
- * @brief https://codebeamer.daiichi.com/tracker/676656?view_id=-2
- *
- */
-static inline void audio_buff_curr_to_spare_switch(void)
-{
-    audio_buff_t tmp_buff = {
-        .buff_state = m_curr_buff.buff_state,
-        .p_buff = m_curr_buff.p_buff,
-        .shifting_rate = m_curr_buff.shifting_rate,
-        .cur_size = m_curr_buff.cur_size,
-    };
+#if (1U == AUDIO_CONF_STANDBY)
+        if (AUDIO_LAYER_STANDBY == layer)
+        {
+            // The standby layer is not played, the chain table is kept for
+            // the switch.
+            p_layer->state = audio_chain_read(p_layer,
+                                              m_audio_standby.chain_tbl);
 
-    m_curr_buff.buff_state = BUFFER_STATE_READY;
-    m_curr_buff.shifting_rate = m_spare_buff.shifting_rate;
-    m_curr_buff.p_buff = m_spare_buff.p_buff;
-    m_curr_buff.cur_size = m_spare_buff.cur_size;
+            if (FLASH_READ_STATE_CHAIN == p_layer->state)
+            {
+                return;
+            }
+        }
+        else
+#endif
+        {
+            // The layer fades in over its first block instead of clicking
+            // in.
+            p_layer->plan_gain = 0U;
 
-    m_spare_buff.buff_state = BUFFER_STATE_READ;
-    m_spare_buff.shifting_rate = tmp_buff.shifting_rate;
-    m_spare_buff.p_buff = tmp_buff.p_buff;
-    m_spare_buff.cur_size = tmp_buff.cur_size;
+            audio_spi_budget_check();
+        }
+    }
+    else
+    {
+        // Placeholder
+    }
 
-    LOG_VERBOSE("buff:%x", m_curr_buff.p_buff);
+    // The layer is loaded or has been stopped meanwhile.
+    m_audio_param.load_layer = AUDIO_LAYER_NONE;
 }
+#endif
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194486
+ * @brief This function returns the layer of a load layer number.
  *
  */
-static inline void audio_buff_curr_to_mute_switch(void)
+static inline audio_layer_t *audio_load_layer_get(uint32_t layer)
 {
-    m_curr_buff.buff_state = BUFFER_STATE_READY;
-    m_curr_buff.p_buff = m_audio_mute_buff;
-    m_curr_buff.max_size = AUDIO_MUTE_BUFF_SIZE;
-    m_curr_buff.cur_size = AUDIO_MUTE_BUFF_SIZE;
-    m_curr_buff.shifting_rate = 0U;
-
-    LOG_INFO("Buff switch to mute");
-}
+#if (1U == AUDIO_CONF_STANDBY)
+    if (AUDIO_LAYER_STANDBY == layer)
+    {
+        return &m_audio_standby.layer;
+    }
+#endif
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194805
- *
- */
-static inline uint32_t audio_addr_get(void)
-{
-    return m_audio_param.audio_addr;
+    return &m_audio_layer[layer];
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194438
+ * @brief This function checks whether a switch swaps the standby layer in.
  *
  */
-static inline void audio_addr_set(uint8_t curr_audio)
+static bool audio_standby_check(uint8_t audio)
 {
-    uint32_t addr = (AUDIO_OFFSET * curr_audio) + API_DATA_EEPROM_LAST_DATA;
-
-    m_audio_param.audio_addr = addr + API_DATA_AUDIO_CFG_TBL_SIZE;
+#if (1U == AUDIO_CONF_STANDBY)
+    const audio_layer_t *p_layer = &m_audio_standby.layer;
+
+    audio_state_t state = curr_audio_state_get();
+
+    // Layer 0 must be playing from the flash, a switch during its load or at
+    // another sample rate stops the playback.
+    if ((audio != p_layer->audio) ||
+        (FLASH_READ_STATE_AUDIO_BUFF != p_layer->state) ||
+        (m_audio_param.sample_rate != p_layer->cfg.sample_rate) ||
+        (FLASH_READ_STATE_AUDIO_BUFF != curr_flash_state_get()) ||
+        ((AUDIO_STATE_READY != state) && (AUDIO_STATE_RUN != state)))
+    {
+        return false;
+    }
 
-    LOG_INFO("Audio File Selected; id:%u, address:%u, ", 
-             curr_audio,
-             m_audio_param.audio_addr);
-}
+    return true;
+#else
+    (void)audio;
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194807
- *
- */
-static inline uint32_t cfg_tbl_addr_get(void)
-{
-    return m_audio_param.cfg_tbl_addr;
+    return false;
+#endif
 }
 
+#if (1U == AUDIO_CONF_STANDBY)
 /**
- * @brief https://codebeamer.daiichi.com/issue/194808
+ * @brief This function provides to swap the standby layer with layer 0.
  *
  */
-static inline void cfg_tbl_addr_set(uint8_t curr_audio)
+static void audio_standby_swap(void)
 {
-    m_audio_param.cfg_tbl_addr =
-        (AUDIO_OFFSET * curr_audio) + API_DATA_EEPROM_LAST_DATA;
+    audio_layer_t *p_curr = &m_audio_layer[0U];
 
-    LOG_INFO("Config File Selected; id:%u, address:%u", 
-             curr_audio,
-             m_audio_param.cfg_tbl_addr);
-}
+    audio_layer_t *p_prev = &m_audio_standby.layer;
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194435
- *
- */
-static inline void shifting_rate_update(uint16_t speed)
-{
-    uint32_t offset = CFG_TBL_FREQ_OFFSET + ((uint32_t)speed * 2U);
+    // PRQA S 0310 ++ # The layers are swapped as 32-bit words.
+    uint32_t *p_curr_word = (uint32_t *)p_curr;
 
-    const uint8_t *p_addr = &m_audio_cfg_tbl[offset];
+    uint32_t *p_prev_word = (uint32_t *)p_prev;
+    // PRQA S 0310 --
 
-    m_curr_buff.shifting_rate = uint16_convert(p_addr);
-    m_spare_buff.shifting_rate = m_curr_buff.shifting_rate;
-}
+    // The layers are swapped in place, a copy would not fit in the stack.
+    for (uint32_t idx = 0U;
+         idx < (sizeof(audio_layer_t) / sizeof(uint32_t));
+         idx++)
+    {
+        uint32_t word = p_curr_word[idx];
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194264
- *
- */
-static inline void audio_param_update(uint16_t speed)
-{
-    uint32_t offset = CFG_TBL_GAIN_OFFSET + ((uint32_t)speed * 2U);
+        p_curr_word[idx] = p_prev_word[idx];
 
-    const uint8_t *p_addr = &m_audio_cfg_tbl[offset];
+        p_prev_word[idx] = word;
+    }
 
-    m_audio_param.curr_gain = uint16_convert(p_addr);
+    // The stream goes on with the resampler history and the planned phase,
+    // pitch and gain, the new audio ramps to its own pitch and from silence
+    // to its own gain.
+    p_curr->resampler = p_prev->resampler;
 
-    shifting_rate_update(speed);
-}
+    p_curr->plan_step = p_prev->plan_step;
+    p_curr->plan_phase = p_prev->plan_phase;
+    p_curr->plan_gain = p_prev->plan_gain;
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/195191
- *
- */
-static inline void audio_play_set(bool status)
-{
-    m_audio_param.play = status;
+    p_curr->adpcm.pos = AUDIO_ADPCM_POS_NONE;
 
-    LOG_INFO("Audio play status changed; status:%u", status);
-}
+    audio_layer_update(p_curr);
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/195192
- *
- */
-static inline bool audio_play_get(void)
-{
-    return m_audio_param.play;
-}
+    // The limiter delay line still holds the faded end of the old audio.
+    audio_chain_flatten();
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194436
- *
- */
-static inline uint32_t sample_pos_get(uint16_t max_sample_cnt,
-                                      uint16_t shifting_rate)
-{
-    if (max_sample_cnt < shifting_rate)
+    if (true == m_audio_standby.chain)
     {
-        return shifting_rate;
+        audio_chain_decode(m_audio_standby.chain_tbl);
     }
 
-    return ((uint32_t)max_sample_cnt - shifting_rate);
+    audio_spi_budget_check();
+
+    // The audio played so far is loaded back, so switching back is fast too.
+    p_prev->ready = false;
+
+    p_prev->state = FLASH_READ_STATE_INIT;
+
+    m_audio_standby.chain = false;
+
+    // The getters read the raw table, it is read again between the blocks.
+    cfg_tbl_state_set(BUFFER_STATE_READ);
+
+    m_audio_param.swap = false;
+
+    m_audio_param.swap_fade = false;
+
+    m_audio_param.swap_head = true;
+
+    LOG_INFO("Audio swapped; id:%u", p_curr->audio);
 }
+#endif
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194437
+ * @brief This function provides to read the configuration table of layer 0
+ *        again.
  *
  */
-static inline void audio_buff_db_edit(uint8_t *p_buff,
-                                      uint32_t size,
-                                      uint16_t gain)
+static void audio_cfg_tbl_reload(void)
 {
-    da_double_t calculated_gain = (da_double_t)gain / AUDIO_GAIN_CALC_RATE;
-
-    if (1.0 == calculated_gain)
+    if (BUFFER_STATE_READ_WAIT == cfg_tbl_state_get())
     {
+        cfg_tbl_state_set(BUFFER_STATE_READY);
+
         return;
     }
 
-    for (uint32_t idx = 0U; idx < size; idx++)
+    bool ret = api_data_read(cfg_tbl_addr_get(&m_audio_layer[0U]),
+                             m_audio_cfg_tbl,
+                             API_DATA_AUDIO_CFG_TBL_SIZE,
+                             0U);
+
+    if (true == ret)
     {
-        // PRQA S 4395 ++ # Conversion from double data type to unsigned data type is required. Data loss to occur is taken into consideration.
-        p_buff[idx] = (uint8_t)((da_double_t)p_buff[idx] * calculated_gain);
-        // PRQA S 4395 --
+        cfg_tbl_state_set(BUFFER_STATE_READ_WAIT);
     }
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194262
+ * @brief This function returns the External Flash bandwidth of a layer.
  *
  */
-static inline void audio_buff_get(uint8_t *p_buff, 
-                                  uint32_t offset, 
-                                  uint32_t size)
+static uint32_t audio_layer_spi_rate_get(const audio_layer_t *p_layer)
 {
-    uint32_t addr = audio_addr_get();
+    const audio_cfg_t *p_cfg = &p_layer->cfg;
 
-    bool ret = api_data_read(addr,
-                             p_buff,
-                             size,
-                             offset);
-
-    if (ret)
+    if ((false == p_layer->ready) || (AUDIO_FORMAT_SYNTH == p_cfg->format) ||
+        (0U == p_cfg->loop_end))
     {
-        m_audio_param.cursor++;
+        return 0U;
     }
-}
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194253
- *
- */
-static inline bool audio_play(const uint8_t *p_buff, uint32_t size)
-{
-    if (false == bsp_i2s_write(p_buff, (size_t)size))
-    {
-        LOG_ERROR("I2S write error");
+    uint64_t frame_cnt = ((uint64_t)p_cfg->sample_rate * p_cfg->step_max) >>
+                         DSP_RESAMPLER_STEP_SHIFT;
 
-        return false;
+    uint64_t rate = frame_cnt * p_cfg->frame_size;
+
+    if (AUDIO_FORMAT_ADPCM == p_cfg->format)
+    {
+        rate = (frame_cnt * DSP_ADPCM_BLOCK_SIZE) / DSP_ADPCM_BLOCK_FRAME_CNT;
     }
 
-    return true;
+    return (uint32_t)rate;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194797
+ * @brief This function provides to keep the played layers in the SPI budget.
  *
  */
-static inline audio_state_t curr_audio_state_get(void)
+static void audio_spi_budget_check(void)
 {
-    return m_audio_param.state;
-}
+    uint32_t rate = 0U;
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194798
- *
- */
-static inline void curr_audio_state_set(audio_state_t state)
-{
-    m_audio_param.state = state;
-}
+    for (uint32_t layer = 0U; layer < AUDIO_CONF_LAYER_CNT; layer++)
+    {
+        rate += audio_layer_spi_rate_get(&m_audio_layer[layer]);
+    }
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194797
- *
- */
-static inline buffer_state_t curr_buff_state_get(void)
-{
-    return m_curr_buff.buff_state;
-}
+    for (uint32_t layer = AUDIO_CONF_LAYER_CNT - 1U;
+         (AUDIO_CONF_SPI_BUDGET < rate) && (0U < layer);
+         layer--)
+    {
+        audio_layer_t *p_layer = &m_audio_layer[layer];
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194800
- *
- */
-static inline void curr_buff_state_set(buffer_state_t state)
-{
-    m_curr_buff.buff_state = state;
-}
+        uint32_t layer_rate = audio_layer_spi_rate_get(p_layer);
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194801
- *
- */
-static inline buffer_state_t spare_buff_state_get(void)
-{
-    return m_spare_buff.buff_state;
-}
+        if (0U != layer_rate)
+        {
+            LOG_ERROR("Layer over SPI budget; layer:%u, rate:%u, total:%u",
+                      layer,
+                      layer_rate,
+                      rate);
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194802
- *
- */
-static inline void spare_buff_state_set(buffer_state_t state)
-{
-    m_spare_buff.buff_state = state;
-}
+            p_layer->ready = false;
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194803
- *
- */
-static inline flash_read_state_t curr_flash_state_get(void)
-{
-    return m_flash_read_state;
-}
+            p_layer->state = FLASH_READ_STATE_IDLE;
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194804
- *
- */
-static inline void curr_flash_state_set(flash_read_state_t state)
-{
-    m_flash_read_state = state;
+            rate -= layer_rate;
+        }
+    }
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194809
+ * @brief This function provides to flatten the speaker chains.
  *
  */
-static inline void curr_audio_set(uint8_t audio)
+static void audio_chain_reset(void)
 {
-    m_audio_param.curr_audio = audio;
+    dsp_chain_init(&m_audio_chain);
 
-    LOG_INFO("Audio id selected; id:%u", m_audio_param.curr_audio);
+    audio_chain_flatten();
 }
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/195193
- *
- */
-static inline uint8_t curr_audio_get(void)
+static void audio_chain_flatten(void)
 {
-    return m_audio_param.curr_audio;
-}
+    for (uint32_t ch = 0U; ch < DSP_CHAIN_CH_CNT; ch++)
+    {
+        dsp_biquad_init(&m_audio_chain.ch[ch].eq);
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/196950
- *
- */
-static inline void cfg_tbl_state_set(buffer_state_t status)
-{
-    m_cfg_tbl_state = status;
-}
+        (void)dsp_chain_gain_set(&m_audio_chain, ch, DSP_GAIN_UNITY_Q15);
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/196951
- *
- */
-static inline buffer_state_t cfg_tbl_state_get(void)
-{
-    return m_cfg_tbl_state;
+        m_audio_limit[ch] = DSP_LIMITER_THR_UNITY;
+    }
+
+    audio_limiter_update();
+
+    m_audio_fade.attack = AUDIO_CONF_FADE_ATTACK_MS;
+    m_audio_fade.release = AUDIO_CONF_FADE_RELEASE_MS;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194261
+ * @brief This function provides to start reading the speaker chain table.
  *
  */
-static uint32_t audio_buff_freq_shift(const audio_buff_t *p_audio)
+static flash_read_state_t audio_chain_read(const audio_layer_t *p_layer,
+                                           uint8_t *p_tbl)
 {
-    uint16_t edit_cnt = m_audio_param.max_sample_cnt;
-
-    uint32_t removed_sample_cnt = 0U;
+    flash_read_state_t state = FLASH_READ_STATE_AUDIO_BUFF;
 
-    uint32_t src_addr_offset = sample_pos_get(edit_cnt,
-                                              p_audio->shifting_rate);
+    uint32_t offset = p_layer->cfg.chain_offset;
 
-    uint16_t rate = p_audio->shifting_rate;
-
-    if (0U == rate)
+    if (0U == offset)
     {
-        return 0U;
+        // Placeholder
     }
-
-    uint8_t *p_src = p_audio->p_buff;
-
-    size_t remaining_byte = (size_t)(p_audio->max_size - edit_cnt);
-
-    while ((src_addr_offset < p_audio->max_size) &&
-           (0U != remaining_byte))
+    else if ((p_layer->slot_size < CHAIN_TBL_SIZE) ||
+             ((p_layer->slot_size - CHAIN_TBL_SIZE) < offset))
     {
-        (void)memmove(&p_src[src_addr_offset],
-                      &p_src[src_addr_offset + rate],
-                      remaining_byte);
-
-        remaining_byte =
-            (edit_cnt < remaining_byte) ? (remaining_byte - edit_cnt) : 0U;
-
-        src_addr_offset = src_addr_offset + ((uint32_t)edit_cnt - rate);
-
-        removed_sample_cnt += rate;
+        LOG_ERROR("Chain table is out of the slot; offset:%u", offset);
+    }
+    else if (true == audio_buff_get(p_layer, p_tbl, offset, CHAIN_TBL_SIZE))
+    {
+        state = FLASH_READ_STATE_CHAIN;
+    }
+    else
+    {
+        LOG_ERROR("Chain table could not read; offset:%u", offset);
     }
 
-    return removed_sample_cnt;
+    return state;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194263
+ * @brief This function decodes the speaker chain table.
  *
  */
-static void audio_buff_edit(audio_buff_t *p_audio, uint16_t gain)
+static void audio_chain_decode(const uint8_t *p_tbl)
 {
-    if (0U == gain)
+    for (uint32_t ch = 0U; ch < DSP_CHAIN_CH_CNT; ch++)
     {
-        // TODO : 0km'de ses mute olması için burası açılacak
-        //(void)memset(p_audio->p_buff, 0, p_audio->size);
+        uint32_t offset = CHAIN_TBL_GAIN_OFFSET + (ch * sizeof(uint16_t));
 
-        return;
-    }
+        uint16_t gain = uint16_convert(&p_tbl[offset]);
 
-    uint32_t removed_sample_cnt = audio_buff_freq_shift(p_audio);
+        uint32_t gain_q15 = DSP_GAIN_UNITY_Q15;
 
-    p_audio->cur_size -= removed_sample_cnt;
+        if (0U != gain)
+        {
+            gain_q15 = dsp_gain_q15_get(gain, AUDIO_GAIN_CALC_RATE);
+        }
 
-    audio_buff_db_edit(p_audio->p_buff,
-                       p_audio->cur_size,
-                       gain);
-}
+        (void)dsp_chain_gain_set(&m_audio_chain, ch, gain_q15);
 
-/**
- * @brief https://codebeamer.daiichi.com/issue/194265
- *
- */
-// PRQA S 3673 ++ # The pointer 'pp_audio' is modified in function. Can not be 'pointer to const'.
-static void audio_buff_check(audio_buff_t **pp_audio, uint32_t buff_cnt)
-{
-    // PRQA S 3673 --
-    for (uint32_t idx = 0U; idx < buff_cnt; idx++)
-    {
-        buffer_state_t state = pp_audio[idx]->buff_state;
+        int16_t coef[CHAIN_TBL_EQ_COEF_CNT];
 
-        if (BUFFER_STATE_READ == state)
-        {
-            pp_audio[idx]->buff_state = BUFFER_STATE_READ_WAIT;
+        offset = (uint32_t)(CHAIN_TBL_EQ_COEF_OFFSET +
+                            (ch * CHAIN_TBL_EQ_COEF_CNT * sizeof(int16_t)));
 
-            uint32_t audio_size = pp_audio[idx]->max_size;
-            
-            uint32_t audio_offset = m_audio_param.cursor * audio_size;
+        for (uint32_t idx = 0U; idx < CHAIN_TBL_EQ_COEF_CNT; idx++)
+        {
+            // PRQA S 4394 ++ # The coefficients are stored as two's complement.
+            coef[idx] = (int16_t)uint16_convert(&p_tbl[offset]);
+            // PRQA S 4394 --
 
-            if ((audio_offset + audio_size) > m_audio_param.size)
-            {
-                audio_offset = 0;
+            offset += sizeof(int16_t);
+        }
 
-                m_audio_param.cursor = 0;
+        uint8_t eq_cnt = p_tbl[CHAIN_TBL_EQ_CNT_OFFSET + ch];
 
-                LOG_INFO("End of audio reached");
-            }
+        if (false == dsp_chain_eq_set(&m_audio_chain, ch, coef, eq_cnt))
+        {
+            LOG_ERROR("Speaker EQ is invalid; ch:%u, stage:%u", ch, eq_cnt);
+        }
 
-            audio_buff_get(pp_audio[idx]->p_buff, audio_offset, audio_size);
+        offset = (uint32_t)(CHAIN_TBL_LIMIT_OFFSET + (ch * sizeof(uint16_t)));
 
-            pp_audio[idx]->cur_size = pp_audio[idx]->max_size;
-        }
+        uint16_t limit = uint16_convert(&p_tbl[offset]);
 
-        if (BUFFER_STATE_EDIT == state)
+        if ((0U != limit) && (AUDIO_GAIN_CALC_RATE > limit))
         {
-            audio_buff_edit(pp_audio[idx],
-                            m_audio_param.curr_gain);
-
-            pp_audio[idx]->buff_state = BUFFER_STATE_READY;
+            m_audio_limit[ch] = dsp_gain_q15_get(limit, AUDIO_GAIN_CALC_RATE);
         }
+
+        LOG_INFO("Speaker chain; ch:%u, gain:%u, eq:%u, limit:%u",
+                 ch,
+                 gain,
+                 eq_cnt,
+                 limit);
     }
+
+    audio_limiter_update();
+
+    uint16_t attack = uint16_convert(&p_tbl[CHAIN_TBL_FADE_OFFSET]);
+
+    uint16_t release =
+        uint16_convert(&p_tbl[CHAIN_TBL_FADE_OFFSET + sizeof(uint16_t)]);
+
+    m_audio_fade.attack = (0U == attack) ? AUDIO_CONF_FADE_ATTACK_MS : attack;
+    m_audio_fade.release =
+        (0U == release) ? AUDIO_CONF_FADE_RELEASE_MS : release;
+
+    LOG_INFO("Output fade; attack:%u, release:%u", attack, release);
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194439
+ * @brief This function provides to set the limiter thresholds.
  *
  */
-static bool audio_init_state_check(void)
+static void audio_limiter_update(void)
 {
-    if (FLASH_READ_STATE_INIT == curr_flash_state_get())
+    for (uint32_t ch = 0U; ch < DSP_CHAIN_CH_CNT; ch++)
     {
-        uint32_t addr = cfg_tbl_addr_get();
-
-        bool ret = api_data_read(addr,
-                                 m_audio_cfg_tbl,
-                                 API_DATA_AUDIO_CFG_TBL_SIZE,
-                                 0U);
+        uint32_t thr = (m_audio_limit[ch] * m_audio_amp.backoff) >>
+                       DSP_GAIN_Q15_SHIFT;
 
-        if (true == ret)
+        if (0U == thr)
         {
-            curr_flash_state_set(FLASH_READ_STATE_CFG_TBL);
+            thr = 1U;
         }
 
-        return false;
-    }
-
-    if ((BUFFER_STATE_READY == curr_buff_state_get()) &&
-        (BUFFER_STATE_READY == spare_buff_state_get()))
-    {
-        return true;
+        (void)dsp_chain_limiter_set(&m_audio_chain, ch, thr);
     }
-
-    return false;
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194259
+ * @brief This function is the diagnostic callback of the amplifier driver.
  *
  */
-static void audio_run_state_check(void)
+static void audio_amp_diag_cb(drv_amplifier_diag_t diag)
 {
-    if (BUFFER_STATE_READY == curr_buff_state_get())
+    if (DRV_AMPLIFIER_DIAG_CLIPPING_DETECT == diag)
+    {
+        m_audio_amp.clip = true;
+    }
+    else if ((DRV_AMPLIFIER_DIAG_ERR_TW_1 <= diag) &&
+             (DRV_AMPLIFIER_DIAG_ERR_TW_4 >= diag))
     {
-        if (true == audio_play(m_curr_buff.p_buff, m_curr_buff.cur_size))
+        uint32_t ceil =
+            m_audio_amp_tw_ceil[(uint32_t)diag -
+                                (uint32_t)DRV_AMPLIFIER_DIAG_ERR_TW_1];
+
+        if (ceil < m_audio_amp.tw_ceil)
         {
-            curr_buff_state_set(BUFFER_STATE_BUSY);
+            m_audio_amp.tw_ceil = ceil;
         }
     }
+    else if (DRV_AMPLIFIER_DIAG_DATA_VALID == diag)
+    {
+        // Each valid report ends with it, once per amplifier.
+        audio_amp_diag_update();
+    }
+    else
+    {
+        // Placeholder
+    }
 }
 
 /**
- * @brief https://codebeamer.daiichi.com/issue/194089
+ * @brief This function provides to move the limiter thresholds.
  *
  */
-static void flash_state_manager(void)
+static void audio_amp_diag_update(void)
 {
-    audio_buff_t *p_buff = NULL;
-
-    flash_read_state_t curr_state = curr_flash_state_get();
+    uint32_t backoff = m_audio_amp.backoff;
 
-    static flash_read_state_t log_state = 0xFFU;
-
-    if (log_state != curr_state)
+    if (true == m_audio_amp.clip)
     {
-        LOG_DEBUG("Flash Process, Prev state: %u, New state: %u", 
-                   log_state,
-                   curr_state);
+        backoff = (backoff * AUDIO_AMP_CLIP_STEP_Q15) >> DSP_GAIN_Q15_SHIFT;
 
-        log_state = curr_state;
+        if (AUDIO_AMP_BACKOFF_MIN_Q15 > backoff)
+        {
+            backoff = AUDIO_AMP_BACKOFF_MIN_Q15;
+        }
     }
 
-    if (FLASH_READ_STATE_CFG_TBL == curr_state)
+    if (backoff > m_audio_amp.tw_ceil)
     {
-        cfg_tbl_state_set(BUFFER_STATE_READY);
-
-        const uint8_t *p_addr = &m_audio_cfg_tbl[CFG_TBL_SIZE_OFFSET];
-
-        m_audio_param.size = uint32_convert(p_addr);
-
-        p_addr = &m_audio_cfg_tbl[CFG_TBL_MAX_SAMPLE_CNT_OFFSET];
-
-        m_audio_param.max_sample_cnt = uint16_convert(p_addr);
-
-        curr_state = FLASH_READ_STATE_CURR_AUDIO_BUFF;
+        backoff = m_audio_amp.tw_ceil;
     }
 
-    switch (curr_state)
-    {
-    case FLASH_READ_STATE_CURR_AUDIO_BUFF:
+    if ((true == m_audio_amp.clip) ||
+        (DSP_LIMITER_THR_UNITY != m_audio_amp.tw_ceil))
     {
-        p_buff = &m_curr_buff;
-
-        curr_buff_state_set(BUFFER_STATE_READ);
-
-        curr_flash_state_set(FLASH_READ_STATE_SPARE_AUDIO_BUFF);
+        m_audio_amp.clean_cnt = 0U;
     }
-    break;
-
-    case FLASH_READ_STATE_SPARE_AUDIO_BUFF:
+    else if (AUDIO_AMP_RECOVER_CNT <= ++m_audio_amp.clean_cnt)
     {
-        if (BUFFER_STATE_READ_WAIT == curr_buff_state_get())
-        {
-            curr_buff_state_set(BUFFER_STATE_EDIT);
-        }
-
-        p_buff = &m_spare_buff;
-
-        spare_buff_state_set(BUFFER_STATE_READ);
+        m_audio_amp.clean_cnt = 0U;
 
-        curr_flash_state_set(FLASH_READ_STATE_IDLE);
-    }
-    break;
+        backoff = (backoff * AUDIO_AMP_RECOVER_STEP_Q15) >> DSP_GAIN_Q15_SHIFT;
 
-    case FLASH_READ_STATE_IDLE:
-    {
-        if (BUFFER_STATE_READ_WAIT == spare_buff_state_get())
+        if (DSP_LIMITER_THR_UNITY < backoff)
         {
-            spare_buff_state_set(BUFFER_STATE_EDIT);
+            backoff = DSP_LIMITER_THR_UNITY;
         }
     }
-    break;
-
-    default:
+    else
     {
         // Placeholder
     }
-    break;
-    }
 
-    if (NULL != p_buff)
+    m_audio_amp.clip = false;
+    m_audio_amp.tw_ceil = DSP_LIMITER_THR_UNITY;
+
+    if (backoff != m_audio_amp.backoff)
     {
-        audio_buff_check(&p_buff, 1U);
+        LOG_WARNING("Amplifier limiter; prev:%u, new:%u",
+                    m_audio_amp.backoff,
+                    backoff);
+
+        m_audio_amp.backoff = backoff;
+
+        audio_limiter_update();
     }
 }
 
@@ -2059,12 +6455,6 @@ static void flash_state_manager(void)
  */
 static void state_manager(void)
 {
-    audio_buff_t *audio_buff_arr[2U] = {
-        &m_curr_buff,
-        &m_spare_buff,
-
-    };
-
     audio_state_t curr_audio_state = curr_audio_state_get();
 
     static audio_state_t log_state = 0xFFU;
@@ -2082,7 +6472,8 @@ static void state_manager(void)
     {
     case AUDIO_STATE_INIT:
     {
-        if (true == audio_init_state_check())
+        if ((false == drv_flash_is_busy()) &&
+            (true == audio_init_state_check()))
         {
             curr_audio_state_set(AUDIO_STATE_READY);
         }
@@ -2091,9 +6482,15 @@ static void state_manager(void)
 
     case AUDIO_STATE_SWITCH:
     {
+        // The configuration table is read once the pending audio read ends.
+        if (true == drv_flash_is_busy())
+        {
+            return;
+        }
+
         curr_flash_state_set(FLASH_READ_STATE_INIT);
 
-        uint32_t addr = cfg_tbl_addr_get();
+        uint32_t addr = cfg_tbl_addr_get(&m_audio_layer[0U]);
 
         bool ret = api_data_read(addr,
                                  m_audio_cfg_tbl,
@@ -2102,9 +6499,20 @@ static void state_manager(void)
 
         cfg_tbl_state_set(BUFFER_STATE_READ);
 
-        curr_buff_state_set(BUFFER_STATE_IDLE);
+        m_audio_layer[0U].ready = false;
+
+        audio_layer_reset(&m_audio_layer[0U]);
+
+        audio_ring_reset();
 
-        spare_buff_state_set(BUFFER_STATE_IDLE);
+        uint32_t layer = m_audio_param.load_layer;
+
+        // The read of the layer being loaded is dropped, it is loaded again.
+        if ((AUDIO_LAYER_NONE != layer) &&
+            (FLASH_READ_STATE_IDLE != audio_load_layer_get(layer)->state))
+        {
+            audio_load_layer_get(layer)->state = FLASH_READ_STATE_INIT;
+        }
 
         curr_audio_state_set(AUDIO_STATE_INIT);
 
@@ -2134,8 +6542,6 @@ static void state_manager(void)
     }
     break;
     }
-
-    audio_buff_check(audio_buff_arr, 2U);
 }
 
 /**
@@ -2154,17 +6560,6 @@ static void audio_write_cb(bsp_i2s_status_t status)
     if (BSP_I2S_END_TRANSFER == status)
     {
         LOG_VERBOSE("I2S event end transfer");
-
-        if (false == m_audio_param.mute)
-        {
-            audio_buff_curr_to_spare_switch();
-        }
-        else
-        {
-            audio_buff_curr_to_mute_switch();
-        }
-
-        audio_run_state_check();
     }
     else if (BSP_I2S_RX_FULL == status)
     {
@@ -2174,16 +6569,22 @@ static void audio_write_cb(bsp_i2s_status_t status)
     {
         LOG_VERBOSE("I2S event tx empty");
 
-        if (false == m_audio_param.mute)
-        {
-            audio_buff_curr_to_spare_switch();
-        }
-        else
+        // The ring plays the slots in order, so the ended slot is the one
+        // before the slot now playing.
+        uint32_t slot = m_audio_play_slot;
+
+        m_audio_play_slot = ((slot + 1U) < AUDIO_CONF_RING_SLOT_CNT)
+                                ? (slot + 1U)
+                                : 0U;
+
+        // A slot still owned by the pipeline has been replayed by an
+        // underrun, it is not queued twice.
+        if (false == m_audio_slot_queued[slot])
         {
-            audio_buff_curr_to_mute_switch();
-        }
+            m_audio_slot_queued[slot] = true;
 
-        audio_run_state_check();
+            (void)spsc_queue_push(&m_audio_slot_queue, slot);
+        }
     }
     else
     {
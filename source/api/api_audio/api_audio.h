@@ -46,6 +46,77 @@
  */
 #define API_AUDIO_3 (2U)
 
+/**
+ * @brief This macro indicates the highest layer count of the mixer. The layer
+ *        count of the build is set in api_audio.c, the S32K116 build plays
+ *        layer 0 only.
+ *
+ */
+#define API_AUDIO_LAYER_MAX (4U)
+
+/**
+ * @brief This macro indicates the bit count of the fraction of the vehicle
+ *        speed, the resolution of the TCO1 vehicle speed (1/256 km/h).
+ *
+ */
+#define API_AUDIO_SPEED_SHIFT (8U)
+
+/**
+ * @brief This macro indicates the headroom of the playback diagnostics before
+ *        the first ring slot has been refilled.
+ *
+ */
+#define API_AUDIO_HEADROOM_NONE (UINT32_MAX)
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to the playback diagnostics. The underrun
+ *        count is the count of the ring slots started by the I2S before they
+ *        were refilled, so a stale slot was played. A refill is late when it
+ *        has less than one slot of margin before the I2S starts the slot. The
+ *        headroom is the lowest margin of the refills in microseconds, with a
+ *        resolution of one slot. The switch latency is the time from
+ *        api_audio_switch() to the first ring slot of the new audio given to
+ *        the I2S in milliseconds. A fast switch is a switch to the audio
+ *        loaded by api_audio_prefetch(), the playback is not stopped. Once
+ *        the output has faded out, the I2S sends silence without playing the
+ *        ring slots. The I2S interrupts are counted apart in both modes, and
+ *        the time spent in the silence gives their rates. The stored audio is
+ *        checked against the CRC of its configuration table once it has been
+ *        read up to the loop end, the checks are counted by their result.
+ *        A block of the only layer played at unity pitch and gain is read
+ *        directly to its ring slot and skips the edit stage, the blocks are
+ *        counted by the way they have been played.
+ *
+ */
+typedef struct api_audio_diag_s
+{
+    uint32_t underrun_cnt;
+    uint32_t late_cnt;
+    uint32_t refill_cnt;
+    uint32_t headroom_min_us;
+
+    uint32_t switch_cnt;
+    uint32_t switch_fast_cnt;
+    uint32_t switch_last_ms;
+    uint32_t switch_max_ms;
+
+    uint32_t silence_cnt;
+    uint32_t silence_ms;
+    uint32_t irq_ring_cnt;
+    uint32_t irq_silence_cnt;
+
+    uint32_t crc_ok_cnt;
+    uint32_t crc_fail_cnt;
+
+    uint32_t block_direct_cnt;
+    uint32_t block_edit_cnt;
+
+} api_audio_diag_t;
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -83,7 +154,10 @@ void api_audio_deinit(void);
 void api_audio_process(void);
 
 /**
- * @brief This function mutes the sound through the amplifier.
+ * @brief This function mutes the sound through the amplifier. The output
+ *        fades out with the release time of the speaker chain table, then the
+ *        audio is no longer read from the External Flash. A playing output
+ *        mutes the amplifier once it has faded out to the silence.
  *
  * @return bool Mute status.
  *
@@ -98,7 +172,8 @@ void api_audio_process(void);
 bool api_audio_mute(void);
 
 /**
- * @brief This function unmutes the sound through the amplifier.
+ * @brief This function unmutes the sound through the amplifier. The output
+ *        fades in with the attack time of the speaker chain table.
  *
  * @return bool Unmute status.
  *
@@ -129,6 +204,8 @@ bool api_audio_play(void);
 
 /**
  * @brief This function stops sending the audio data to the amplifier via I2S.
+ *        A playing audio fades out as on a mute and resumes with a fade-in on
+ *        api_audio_play().
  *
  * @return bool Function status.
  *
@@ -157,7 +234,7 @@ bool api_audio_status_get(void);
  * @brief This function updates frequency and gain variables from the
  *        configuration table according to speed value.
  *
- * @param[in] speed Indicates vehicle speed.
+ * @param[in] speed Indicates vehicle speed in km/h.
  *
  * https://codebeamer.daiichi.com/issue/192463
  *
@@ -165,12 +242,25 @@ bool api_audio_status_get(void);
 void api_audio_param_update(uint16_t speed);
 
 /**
- * @brief This function switches the audio file to be played.
+ * @brief This function updates frequency and gain variables for a fractional
+ *        speed value. The parameters are interpolated linearly between the
+ *        breakpoints of the calibration curve. At 0 km/h the output fades out
+ *        when the 0 km/h gain of the configuration table is zero.
+ *
+ * @param[in] speed Indicates vehicle speed in 1/256 km/h.
+ *
+ */
+void api_audio_speed_update(uint16_t speed);
+
+/**
+ * @brief This function switches the audio file to be played. The switch to
+ *        the audio loaded by api_audio_prefetch() is done at the next block
+ *        without stopping the playback, otherwise the playback is stopped
+ *        until the new audio is read. The audio played before a fast switch
+ *        is loaded back in the background, so switching back is fast too.
  *
- * @param[in] audio_num Audio number to be selected.
- *                      - API_AUDIO_1
- *                      - API_AUDIO_2
- *                      - API_AUDIO_3
+ * @param[in] audio_num Audio number to be selected, a slot number below
+ *                      api_data_audio_slot_cnt_get().
  *
  * @return bool Function status.
  *
@@ -182,6 +272,78 @@ void api_audio_param_update(uint16_t speed);
  */
 bool api_audio_switch(uint8_t audio_num);
 
+/**
+ * @brief This function loads an audio file in the background, so a later
+ *        api_audio_switch() to it does not stop the playback. The decoded
+ *        configuration table, the curve, the loop crossfade and the speaker
+ *        chain table are kept in RAM. The audio must have the sample rate of
+ *        the played audio, only one audio is loaded at a time. A build without
+ *        the standby layer (see api_audio_standby_get()) loads nothing, the
+ *        switch stops the playback until the audio is read from the flash.
+ *
+ * @param[in] audio_num Audio number to be loaded, a slot number below
+ *                      api_data_audio_slot_cnt_get().
+ *
+ * @return bool Function status.
+ *
+ * @retval true  The audio is loaded or being loaded.
+ * @retval false The module is not initialized, the audio number is invalid,
+ *               a fast switch is in progress or the build has no standby
+ *               layer.
+ *
+ */
+bool api_audio_prefetch(uint8_t audio_num);
+
+/**
+ * @brief This function gives whether the build has the standby layer, which
+ *        is set by AUDIO_CONF_STANDBY in api_audio.c. Without it
+ *        api_audio_prefetch() always fails.
+ *
+ * @return bool Function status.
+ *
+ * @retval true  The audio can be loaded by api_audio_prefetch().
+ * @retval false The build has no standby layer.
+ *
+ */
+bool api_audio_standby_get(void);
+
+/**
+ * @brief This function plays an audio file on a mixer layer together with the
+ *        audio selected by api_audio_switch(), which is played on layer 0.
+ *        The layer follows the pitch and gain curves of its own configuration
+ *        table. It joins the mix once its table is read, the playback is not
+ *        stopped meanwhile. A layer exceeding the External Flash bandwidth
+ *        budget is not played. The layer count is set by AUDIO_CONF_LAYER_CNT
+ *        in api_audio.c, it is 1 by default, so the S32K116 build has no
+ *        layer to set and the function fails.
+ *
+ * @param[in] layer     Layer number, from 1 to the layer count - 1.
+ * @param[in] audio_num Audio number to be played, a slot number below
+ *                      api_data_audio_slot_cnt_get().
+ * @param[in] gain      Gain of the layer, 1000 is 0 dB.
+ *
+ * @return bool Function status.
+ *
+ * @retval true  The layer is set.
+ * @retval false The module is not initialized or an argument is invalid.
+ *
+ */
+bool api_audio_layer_set(uint8_t layer, uint8_t audio_num, uint16_t gain);
+
+/**
+ * @brief This function stops a mixer layer. With the default layer count of 1
+ *        (AUDIO_CONF_LAYER_CNT in api_audio.c) the function fails.
+ *
+ * @param[in] layer Layer number, from 1 to the layer count - 1.
+ *
+ * @return bool Function status.
+ *
+ * @retval true  The layer is stopped.
+ * @retval false The module is not initialized or the layer is invalid.
+ *
+ */
+bool api_audio_layer_stop(uint8_t layer);
+
 /**
  * @brief This function gives the audio name from the audio configuration table.
  *
@@ -262,10 +424,13 @@ bool api_audio_calib_ver_get(char_t *p_calib_version);
 
 /**
  * @brief This function gives the audio frequency from the audio configuration
- *        table.
+ *        table. It reports the raw calibration table entry of the whole km/h,
+ *        not the interpolated rate being played, which follows the audio's own
+ *        calibration curve when it has one.
  *
  * @param[out] p_freq The audio frequency.
- * @param[in] offset The frequency offset value in the configuration table.
+ * @param[in] offset The frequency entry index (vehicle speed in km/h) in the
+ *                   configuration table.
  *
  * @return bool Function status.
  *
@@ -279,9 +444,13 @@ bool api_audio_freq_get(uint16_t *p_freq, uint32_t offset);
 
 /**
  * @brief This function gives the audio gain from the audio configuration table.
+ *        It reports the raw calibration table entry (per mille) of the whole
+ *        km/h, not the interpolated gain being played, which follows the
+ *        audio's own calibration curve when it has one.
  *
  * @param[out] p_gain The audio gain.
- * @param[in] offset The gain offset value in the configuration table.
+ * @param[in] offset The gain entry index (vehicle speed in km/h) in the
+ *                   configuration table.
  *
  * @return bool Function status.
  *
@@ -309,6 +478,26 @@ bool api_audio_gain_get(uint16_t *p_gain, uint32_t offset);
  */
 bool api_audio_ver_get(char_t *p_version);
 
+/**
+ * @brief This function gives the playback diagnostics counted since the
+ *        initialization or the last api_audio_diag_reset() call.
+ *
+ * @param[out] p_diag The playback diagnostics.
+ *
+ * @return bool Function status.
+ *
+ * @retval true  Function successfully done.
+ * @retval false Function failed.
+ *
+ */
+bool api_audio_diag_get(api_audio_diag_t *p_diag);
+
+/**
+ * @brief This function restarts the playback diagnostics.
+ *
+ */
+void api_audio_diag_reset(void);
+
 #endif /* API_AUDIO_H */
 
 // end of file
@@ -64,6 +64,45 @@ extern const uint8_t *p_flash_update_data;
  */
 #define CURR_AUDIO (0U)
 
+/**
+ * @brief This macro indicates the magic value of the audio directory, "ADIR".
+ *
+ */
+#define AUDIO_DIR_MAGIC (0x41444952U)
+
+/**
+ * @brief This macro indicates the size of the audio directory header.
+ *
+ */
+#define AUDIO_DIR_HDR_SIZE (8U)
+
+/**
+ * @brief This macro indicates the size of an audio directory slot entry.
+ *
+ */
+#define AUDIO_DIR_ENTRY_SIZE (4U)
+
+/**
+ * @brief This macro indicates the highest size of the audio directory.
+ *
+ */
+#define AUDIO_DIR_SIZE \
+    (AUDIO_DIR_HDR_SIZE + (AUDIO_DIR_ENTRY_SIZE * API_DATA_AUDIO_SLOT_MAX))
+
+/**
+ * @brief This macro indicates the timeout of the audio directory read in
+ *        milliseconds.
+ *
+ */
+#define AUDIO_DIR_TIMEOUT_MS (100U)
+
+/**
+ * @brief This macro indicates the size of a slot of the fixed layout.
+ *
+ */
+#define AUDIO_SLOT_LEGACY_SIZE \
+    (API_DATA_AUDIO_CFG_TBL_SIZE + API_DATA_AUDIO_DEFAULT_SIZE)
+
 // PRQA S 380 --
 
 /*******************************************************************************
@@ -98,6 +137,21 @@ typedef enum mem_location_e
  */
 static bool m_flash_init = false;
 
+/**
+ * @brief This variable holds the slot count of the audio directory, zero when
+ *        the fixed layout is used.
+ *
+ */
+static uint8_t m_audio_slot_cnt = 0U;
+
+/**
+ * @brief These variables hold the first sector and the sector count of each
+ *        slot of the audio directory.
+ *
+ */
+static uint16_t m_audio_slot_sector[API_DATA_AUDIO_SLOT_MAX] = {0U};
+static uint16_t m_audio_slot_sector_cnt[API_DATA_AUDIO_SLOT_MAX] = {0U};
+
 /*******************************************************************************
  * Private Function Declarations
  ******************************************************************************/
@@ -107,18 +161,20 @@ static bool m_flash_init = false;
  *
  * @param data_label Data label.
  * @param offset     The desired value of the audio file is to be shifted.
+ * @param size       Size of the accessed data.
  * @param p_addr     Calculated external flash address.
  *
  * @return bool
  *
  * @retval true  The calculation is successfully done.
- * @retval false Outside the given data_label and offset audio file limits.
+ * @retval false The accessed data does not end in the external flash.
  *
  * https://codebeamer.daiichi.com/issue/188878
  *
  */
 static bool flash_addr_calc(uint32_t data_label,
                             uint32_t offset,
+                            size_t size,
                             uint32_t *p_addr);
 
 /**
@@ -223,6 +279,30 @@ static bool default_set(void);
  */
 static bool eeprom_auth_check(void);
 
+/**
+ * @brief This function reads the audio directory from the external flash and
+ *        checks its slots. The fixed layout is kept when the directory is
+ *        missing or invalid.
+ *
+ */
+static void audio_dir_load(void);
+
+/**
+ * @brief This function reads the external flash and waits for the completion
+ *        of the read. It is used only during the initialization.
+ *
+ * @param addr   External flash address.
+ * @param p_data Data address to be read.
+ * @param size   Data size.
+ *
+ * @return bool
+ *
+ * @retval true  The data is read.
+ * @retval false The read failed or timed out.
+ *
+ */
+static bool flash_wait_read(uint32_t addr, uint8_t *p_data, uint32_t size);
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -239,6 +319,8 @@ bool api_data_init(void)
 
     if (true == ret)
     {
+        audio_dir_load();
+
         if (false == eeprom_auth_check())
         {
             LOG_WARNING("EEE Auth fail");
@@ -287,23 +369,32 @@ bool api_data_read(uint32_t data_label,
 
         uint32_t addr = 0U;
 
-        if (true == flash_addr_calc(data_label, offset, &addr))
+        if (true == flash_addr_calc(data_label, offset, size, &addr))
         {
             memcpy(p_data, &p_flash_update_data[addr], size);
 
             LOG_VERBOSE("Internal Audio read addr: 0x%x, size: %d", addr, size);
         }
+        else
+        {
+            ret = false;
+        }
 
         #else
 
         uint32_t addr = 0U;
 
-        if (true == flash_addr_calc(data_label, offset, &addr))
+        if (true == flash_addr_calc(data_label, offset, size, &addr))
         {
             ret = drv_flash_read(addr, p_data, size);
 
             LOG_VERBOSE("Flash async read. addr: 0x%x, size: %d", addr, size);
         }
+        else
+        {
+            // The range is beyond the end of the flash, nothing is read.
+            ret = false;
+        }
 
         if (false == ret)
         {
@@ -365,7 +456,7 @@ bool api_data_write(uint32_t data_label,
     {
         uint32_t addr = 0U;
 
-        if (true == flash_addr_calc(data_label, 0U, &addr))
+        if (true == flash_addr_calc(data_label, 0U, size, &addr))
         {
             ret = drv_flash_write(addr, p_data, size);
 
@@ -415,6 +506,16 @@ bool api_data_dtc_set(uint32_t data_label, uint32_t dtc)
         return false;
     }
 
+    if ((API_DATA_LABEL_DTC_SPKR_1_OC > data_label) ||
+        (API_DATA_LABEL_DTC_HIGH_BAT < data_label) ||
+        (0U != ((data_label - API_DATA_LABEL_DTC_SPKR_1_OC) %
+                API_DATA_DTC_SIZE)))
+    {
+        LOG_ERROR("Invalid DTC label: %u", data_label);
+
+        return false;
+    }
+
     uint8_t dtc_arr[API_DATA_DTC_SIZE] = {0U};
 
     uint32_t idx = 0U;
@@ -428,11 +529,30 @@ bool api_data_dtc_set(uint32_t data_label, uint32_t dtc)
         dtc_arr[idx] = p_dtc[idx];
     }
 
-    // TODO - Vehicle speed, current gear, and trans gear -> CAN
-    (void)dtc_arr;
-    (void)data_label;
+    // The vehicle speed, trans gear and current gear follow the DTC number in
+    // the order they are kept in the EEPROM.
+    bool ret = eeprom_read(API_DATA_LABEL_CAR_SPEED,
+                           &dtc_arr[sizeof(uint32_t)],
+                           API_DATA_DTC_SIZE - sizeof(uint32_t));
 
-    return true;
+    if (false == ret)
+    {
+        for (idx = sizeof(uint32_t); API_DATA_DTC_SIZE > idx; idx++)
+        {
+            dtc_arr[idx] = 0U;
+        }
+
+        LOG_WARNING("DTC vehicle state could not be read");
+    }
+
+    ret = eeprom_write(data_label, dtc_arr, API_DATA_DTC_SIZE);
+
+    if (false == ret)
+    {
+        LOG_ERROR("DTC could not be stored; label: %u", data_label);
+    }
+
+    return ret;
 }
 
 /**
@@ -460,6 +580,57 @@ void api_data_process(void)
     drv_flash_process();
 }
 
+/**
+ * @brief This function gives the audio slot count.
+ *
+ */
+uint8_t api_data_audio_slot_cnt_get(void)
+{
+    if (0U == m_audio_slot_cnt)
+    {
+        return (uint8_t)API_DATA_AUDIO_SLOT_LEGACY_CNT;
+    }
+
+    return m_audio_slot_cnt;
+}
+
+/**
+ * @brief This function gives the configuration table label and the size of an
+ *        audio slot.
+ *
+ */
+bool api_data_audio_slot_get(uint8_t audio,
+                             uint32_t *p_label,
+                             uint32_t *p_size)
+{
+    if ((NULL == p_label) || (NULL == p_size) ||
+        (api_data_audio_slot_cnt_get() <= audio))
+    {
+        LOG_ERROR("Invalid argument in api_data_audio_slot_get");
+
+        return false;
+    }
+
+    if (0U == m_audio_slot_cnt)
+    {
+        *p_label = API_DATA_LABEL_AUDIO_1_CFG +
+                   (AUDIO_SLOT_LEGACY_SIZE * (uint32_t)audio);
+
+        *p_size = AUDIO_SLOT_LEGACY_SIZE;
+    }
+    else
+    {
+        *p_label = API_DATA_EEPROM_LAST_DATA +
+                   ((uint32_t)m_audio_slot_sector[audio] *
+                    DRV_FLASH_CFG_SECTOR_SIZE);
+
+        *p_size = (uint32_t)m_audio_slot_sector_cnt[audio] *
+                  DRV_FLASH_CFG_SECTOR_SIZE;
+    }
+
+    return true;
+}
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
@@ -470,11 +641,14 @@ void api_data_process(void)
  */
 static bool flash_addr_calc(uint32_t data_label,
                             uint32_t offset,
+                            size_t size,
                             uint32_t *p_addr)
 {
     *p_addr = (data_label - API_DATA_EEPROM_LAST_DATA) + offset;
 
-    if (*p_addr > (data_label + API_DATA_AUDIO_DEFAULT_SIZE))
+    // The end is checked by the size left, so the sum cannot overflow.
+    if ((API_DATA_FLASH_SIZE <= *p_addr) ||
+        ((API_DATA_FLASH_SIZE - *p_addr) < size))
     {
         LOG_ERROR("EXTFLSH limit access error");
 
@@ -729,4 +903,101 @@ static bool eeprom_auth_check(void)
     return (max_try_cnt > try_idx);
 }
 
+/**
+ * @brief This function reads the audio directory from the external flash.
+ *
+ */
+static void audio_dir_load(void)
+{
+    uint8_t dir[AUDIO_DIR_SIZE] = {0U};
+
+    m_audio_slot_cnt = 0U;
+
+    if (false == flash_wait_read(0U, dir, AUDIO_DIR_SIZE))
+    {
+        LOG_ERROR("Audio directory could not read");
+
+        return;
+    }
+
+    uint32_t magic = ((uint32_t)dir[0U] << 24U) |
+                     ((uint32_t)dir[1U] << 16U) |
+                     ((uint32_t)dir[2U] << 8U) |
+                     (uint32_t)dir[3U];
+
+    if (AUDIO_DIR_MAGIC != magic)
+    {
+        LOG_INFO("No audio directory, fixed slots are used");
+
+        return;
+    }
+
+    uint8_t slot_cnt = dir[4U];
+
+    if ((0U == slot_cnt) || (API_DATA_AUDIO_SLOT_MAX < slot_cnt))
+    {
+        LOG_ERROR("Invalid audio directory; slot cnt:%u", slot_cnt);
+
+        return;
+    }
+
+    for (uint32_t slot = 0U; slot < slot_cnt; slot++)
+    {
+        const uint8_t *p_entry =
+            &dir[AUDIO_DIR_HDR_SIZE + (slot * AUDIO_DIR_ENTRY_SIZE)];
+
+        uint16_t sector = (uint16_t)(((uint32_t)p_entry[0U] << 8U) |
+                                     (uint32_t)p_entry[1U]);
+
+        uint16_t sector_cnt = (uint16_t)(((uint32_t)p_entry[2U] << 8U) |
+                                         (uint32_t)p_entry[3U]);
+
+        // The first sector holds the directory itself.
+        if ((0U == sector) || (0U == sector_cnt) ||
+            (DRV_FLASH_SECTOR_ID_MAX < ((uint32_t)sector + sector_cnt)))
+        {
+            LOG_ERROR("Invalid audio slot; slot:%u, sector:%u, cnt:%u",
+                      slot,
+                      sector,
+                      sector_cnt);
+
+            return;
+        }
+
+        m_audio_slot_sector[slot] = sector;
+        m_audio_slot_sector_cnt[slot] = sector_cnt;
+    }
+
+    m_audio_slot_cnt = slot_cnt;
+
+    LOG_INFO("Audio directory read; slot cnt:%u", slot_cnt);
+}
+
+/**
+ * @brief This function reads the external flash and waits for the completion
+ *        of the read.
+ *
+ */
+static bool flash_wait_read(uint32_t addr, uint8_t *p_data, uint32_t size)
+{
+    bool ret = drv_flash_read(addr, p_data, size);
+
+    uint32_t start_tick = bsp_mcu_tick_get();
+
+    while ((true == ret) && (true == drv_flash_is_busy()))
+    {
+        // The elapsed time is taken modulo 2^32, so the tick may wrap.
+        if ((bsp_mcu_tick_get() - start_tick) > AUDIO_DIR_TIMEOUT_MS)
+        {
+            ret = false;
+        }
+        else
+        {
+            drv_flash_process();
+        }
+    }
+
+    return ret;
+}
+
 // end of file
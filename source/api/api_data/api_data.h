@@ -18,6 +18,7 @@
 #define API_DATA_H
 
 #include "daiichi_types.h"
+#include "drv_flash.h"
 
 /*******************************************************************************
  * Macros
@@ -87,6 +88,28 @@
  */
 #define API_DATA_AUDIO_DEFAULT_SIZE (500U * 1024U)
 
+/**
+ * @brief This macro indicates the size of the external flash, given by the
+ *        sector geometry of the flash driver.
+ *
+ */
+#define API_DATA_FLASH_SIZE \
+    (DRV_FLASH_CFG_SECTOR_SIZE * DRV_FLASH_SECTOR_ID_MAX)
+
+/**
+ * @brief This macro indicates the highest audio slot count of the audio
+ *        directory.
+ *
+ */
+#define API_DATA_AUDIO_SLOT_MAX (32U)
+
+/**
+ * @brief This macro indicates the audio slot count of the fixed layout used
+ *        when the external flash has no audio directory.
+ *
+ */
+#define API_DATA_AUDIO_SLOT_LEGACY_CNT (3U)
+
 /**
  * @brief This macro indicates the EEPROM authentication data address.
  *
@@ -111,6 +134,24 @@
  */
 #define API_DATA_LABEL_RESERVED (API_DATA_LABEL_BOOT_STATUS + API_DATA_BYTE_1)
 
+/**
+ * @brief This macro indicates the reverse gear calibration data address. It
+ *        holds the transmission gear value of the reverse gear on the vehicle
+ *        CAN bus, 0xFF when the vehicle has no reverse sound. It takes the
+ *        last bytes of the reserved data.
+ *
+ */
+#define API_DATA_LABEL_REVERSE_GEAR \
+    (API_DATA_LABEL_RESERVED + (API_DATA_BYTE_1 * 30U))
+
+/**
+ * @brief This macro indicates the reverse audio calibration data address. It
+ *        holds the audio slot played in the reverse gear.
+ *
+ */
+#define API_DATA_LABEL_REVERSE_AUDIO \
+    (API_DATA_LABEL_REVERSE_GEAR + API_DATA_BYTE_1)
+
 /**
  * @brief This macro indicates the pedestrian alert data address.
  *
@@ -463,13 +504,14 @@
     (API_DATA_LABEL_AUDIO_3_CFG + API_DATA_AUDIO_CFG_TBL_SIZE)
 
 /**
- * @brief This macro indicates the last data address of external flash.
+ * @brief This macro indicates the last data address of external flash. The
+ *        audio directory may place the slots anywhere in the external flash.
  *
  * https://codebeamer.daiichi.com/issue/188787
  *
  */
 #define API_DATA_FLASH_LAST_DATA \
-    (API_DATA_LABEL_AUDIO_3 + API_DATA_AUDIO_DEFAULT_SIZE)
+    (API_DATA_EEPROM_LAST_DATA + API_DATA_FLASH_SIZE)
 
 // PRQA S 380 --
 
@@ -541,15 +583,17 @@ bool api_data_write(uint32_t data_label,
 
 /**
  * @brief This function packs the given DTC number, vehicle speed, current gear,
- *        and trans gear values.
+ *        and trans gear values and stores them at the DTC label in the
+ *        EEPROM.
  *
- * @param data_label Api data label.
+ * @param data_label Api data label of a DTC.
  * @param dtc        Specifies the DTC number.
  *
  * @return bool Function status.
  *
- * @retval true
- * @retval false
+ * @retval true  The DTC is stored.
+ * @retval false The DTC number is zero, the label is not a DTC label or the
+ *               EEPROM write failed.
  *
  * https://codebeamer.daiichi.com/issue/191739
  *
@@ -580,6 +624,46 @@ bool api_data_cb_set(api_data_cb_t callback);
  */
 void api_data_process(void);
 
+/**
+ * @brief This function gives the audio slot count. It is the slot count of the
+ *        audio directory read by api_data_init(), or the three fixed slots of
+ *        API_DATA_LABEL_AUDIO_1_CFG to API_DATA_LABEL_AUDIO_3_CFG when the
+ *        external flash has no valid directory.
+ *
+ *        The directory is at the start of the external flash, big-endian:
+ *        - 0: Magic "ADIR" (4 bytes)
+ *        - 4: Slot count, 1 to API_DATA_AUDIO_SLOT_MAX (1 byte)
+ *        - 5: Reserved (3 bytes)
+ *        - 8: First sector (2 bytes) and sector count (2 bytes) of each slot
+ *
+ *        A slot starts with the audio configuration table, the audio data
+ *        follows it. The slots are after the directory sector.
+ *
+ * @return uint8_t Audio slot count.
+ *
+ */
+uint8_t api_data_audio_slot_cnt_get(void);
+
+/**
+ * @brief This function gives the configuration table label and the size of an
+ *        audio slot.
+ *
+ * @param[in]  audio   Audio slot number.
+ * @param[out] p_label Label of the configuration table of the slot. The audio
+ *                     data is at p_label + API_DATA_AUDIO_CFG_TBL_SIZE.
+ * @param[out] p_size  Size of the slot including the configuration table.
+ *
+ * @return bool Function status.
+ *
+ * @retval true  The slot is found.
+ * @retval false The slot number is out of the slot count or an argument is
+ *               invalid.
+ *
+ */
+bool api_data_audio_slot_get(uint8_t audio,
+                             uint32_t *p_label,
+                             uint32_t *p_size);
+
 #endif /* API_DATA_H */
 
 // end of file
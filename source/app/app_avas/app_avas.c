@@ -15,6 +15,7 @@
 #include "app_avas.h"
 
 #include "api_audio.h"
+#include "api_data.h"
 #include "appman.h"
 #include "bsp_mcu.h"
 
@@ -103,6 +104,87 @@ LOG_MODULE_NAME("APP_AVAS");
  */
 #define AUDIO_FILE_CALIB_DATE_SIZE (17U)
 
+/**
+ * @brief This macro holds the value of a profile field that matches any
+ *        vehicle state.
+ *
+ */
+#define AVAS_PROFILE_ANY (0xFFU)
+
+/**
+ * @brief This macro holds the profile audio value that plays the audio
+ *        selected by the current audio message.
+ *
+ */
+#define AVAS_PROFILE_AUDIO_SEL (0xFFU)
+
+/**
+ * @brief This macro holds the profile index value before a profile is
+ *        selected.
+ *
+ */
+#define AVAS_PROFILE_NONE (0xFFU)
+
+/**
+ * @brief This macro holds the audio value when no audio is to be loaded in
+ *        the background.
+ *
+ */
+#define AVAS_AUDIO_NONE (0xFEU)
+
+/**
+ * @brief This macro holds the number of the sound profiles.
+ *
+ */
+#define AVAS_PROFILE_CNT (4U)
+
+/**
+ * @brief This macro holds the profile gear value that matches the reverse
+ *        gear value of the calibration.
+ *
+ */
+#define AVAS_PROFILE_GEAR_REVERSE (0xFEU)
+
+/**
+ * @brief This macro holds the profile audio value that plays the reverse
+ *        audio of the calibration.
+ *
+ */
+#define AVAS_PROFILE_AUDIO_REVERSE (0xFEU)
+
+/**
+ * @brief This macro holds the calibration value of an erased EEPROM byte, the
+ *        calibrated profile is then not used.
+ *
+ */
+#define AVAS_CALIB_NONE (0xFFU)
+
+/**
+ * @brief This macro holds the ignition status value of the ignition off.
+ *
+ */
+#define AVAS_IGN_OFF (0U)
+
+/**
+ * @brief This macro holds the ignition status value of the ignition on.
+ *
+ */
+#define AVAS_IGN_ON (1U)
+
+/**
+ * @brief This macro holds the pedestrian alert value of the alert switched
+ *        off by the driver.
+ *
+ */
+#define AVAS_PED_ALERT_OFF (0U)
+
+/**
+ * @brief This macro holds the pedestrian alert value of the alert switched
+ *        on.
+ *
+ */
+#define AVAS_PED_ALERT_ON (1U)
+
 /*******************************************************************************
  * Enumerations
  ******************************************************************************/
@@ -160,6 +242,25 @@ typedef struct avas_msg_pool_s
 
 } avas_msg_pool_t;
 
+/**
+ * @brief The data structure corresponds to a sound profile. A profile matches
+ *        the vehicle state when all of its gear, ignition and pedestrian
+ *        alert fields are equal to the state or AVAS_PROFILE_ANY. The audio
+ *        slot brings its own configuration table, so it selects the pitch
+ *        and gain curves of the profile too.
+ *
+ */
+typedef struct avas_profile_s
+{
+    uint8_t gear;
+    uint8_t ign;
+    uint8_t ped_alert;
+
+    bool play;
+    uint8_t audio;
+
+} avas_profile_t;
+
 /*******************************************************************************
  * Type Definitions
  ******************************************************************************/
@@ -241,6 +342,85 @@ static appman_timer_t m_err_timer = {
  */
 static avas_state_t m_avas_state = AVAS_STATE_DEINIT;
 
+/**
+ * @brief Holds the sound profiles, the first profile matching the vehicle
+ *        state is played. The last profile matches any state.
+ *
+ */
+static const avas_profile_t m_avas_profile_tbl[AVAS_PROFILE_CNT] = {
+
+    // The ignition is off, no sound is played.
+    {
+        .gear = AVAS_PROFILE_ANY,
+        .ign = AVAS_IGN_OFF,
+        .ped_alert = AVAS_PROFILE_ANY,
+        .play = false,
+        .audio = AVAS_PROFILE_AUDIO_SEL,
+    },
+
+    // The driver switched the pedestrian alert off.
+    {
+        .gear = AVAS_PROFILE_ANY,
+        .ign = AVAS_PROFILE_ANY,
+        .ped_alert = AVAS_PED_ALERT_OFF,
+        .play = false,
+        .audio = AVAS_PROFILE_AUDIO_SEL,
+    },
+
+    // The reverse gear has its own sound, both are taken from the EEPROM.
+    {
+        .gear = AVAS_PROFILE_GEAR_REVERSE,
+        .ign = AVAS_PROFILE_ANY,
+        .ped_alert = AVAS_PROFILE_ANY,
+        .play = true,
+        .audio = AVAS_PROFILE_AUDIO_REVERSE,
+    },
+
+    {
+        .gear = AVAS_PROFILE_ANY,
+        .ign = AVAS_PROFILE_ANY,
+        .ped_alert = AVAS_PROFILE_ANY,
+        .play = true,
+        .audio = AVAS_PROFILE_AUDIO_SEL,
+    },
+};
+
+/**
+ * @brief Holds the vehicle state the sound profile is selected by.
+ *
+ */
+static uint8_t m_avas_gear = AVAS_PROFILE_ANY;
+static uint8_t m_avas_ign = AVAS_IGN_ON;
+static uint8_t m_avas_ped_alert = AVAS_PED_ALERT_ON;
+
+/**
+ * @brief Holds the audio selected by the current audio message.
+ *
+ */
+static uint8_t m_avas_sel_audio = API_AUDIO_1;
+
+/**
+ * @brief Holds the reverse gear value and the reverse audio of the
+ *        calibration.
+ *
+ */
+static uint8_t m_avas_reverse_gear = AVAS_CALIB_NONE;
+static uint8_t m_avas_reverse_audio = AVAS_CALIB_NONE;
+
+/**
+ * @brief Holds the index of the played sound profile and its audio.
+ *
+ */
+static uint8_t m_avas_profile = AVAS_PROFILE_NONE;
+static uint8_t m_avas_profile_audio = AVAS_PROFILE_AUDIO_SEL;
+
+/**
+ * @brief Holds the audio to be loaded in the background for the next profile
+ *        change, AVAS_AUDIO_NONE when it is loaded.
+ *
+ */
+static uint8_t m_avas_prefetch_audio = AVAS_AUDIO_NONE;
+
 /*******************************************************************************
  * Private Function Declarations
  ******************************************************************************/
@@ -361,13 +541,60 @@ static inline avas_return_t avas_mute_check(void);
 /**
  * @brief This function provides to check the AVAS vehicle speed.
  *
- * @param vehicle_speed[in] Vehicle speed.
+ * @param vehicle_speed[in] Vehicle speed in 1/256 km/h.
  *
  * https://codebeamer.daiichi.com/issue/196285
  *
  */
 static inline void avas_vehicle_speed_check(uint16_t vehicle_speed);
 
+/**
+ * @brief This function provides to select the sound profile matching the
+ *        vehicle state and to switch the audio to it. The switch does not stop
+ *        the playback when the audio of the profile has been loaded in the
+ *        background.
+ *
+ */
+static void avas_profile_check(void);
+
+/**
+ * @brief This function checks whether a sound profile matches the vehicle
+ *        state.
+ *
+ * @param[in] p_profile Sound profile.
+ *
+ * @return bool Match status.
+ *
+ * @retval true  The profile matches the vehicle state.
+ * @retval false The profile does not match or it is not calibrated.
+ *
+ */
+static bool avas_profile_match(const avas_profile_t *p_profile);
+
+/**
+ * @brief This function returns the audio played by a sound profile.
+ *
+ * @param[in] p_profile Sound profile.
+ *
+ * @return uint8_t Audio of the profile.
+ *
+ */
+static uint8_t avas_profile_audio_get(const avas_profile_t *p_profile);
+
+/**
+ * @brief This function provides to read the reverse sound calibration from
+ *        the EEPROM.
+ *
+ */
+static void avas_calib_read(void);
+
+/**
+ * @brief This function provides to load the audio of the next likely profile
+ *        in the background, it is retried until api_audio accepts it.
+ *
+ */
+static inline void avas_profile_prefetch(void);
+
 /**
  * @brief This function provides to print configuration table parameters related
  *        to audio files.
@@ -457,6 +684,10 @@ void app_avas_deinit(void)
 
     m_avas_is_mute = true;
 
+    m_avas_profile = AVAS_PROFILE_NONE;
+
+    m_avas_prefetch_audio = AVAS_AUDIO_NONE;
+
     avas_return_t status = audio_mute();
 
     if (AVAS_RETURN_ERROR == status)
@@ -508,16 +739,34 @@ void app_avas_msg_handler(void *p_arg)
     {
         const uint8_t *p_data = (const uint8_t *)p_msg->p_data;
 
-        bool ret = api_audio_switch(*p_data);
+        m_avas_sel_audio = *p_data;
 
-        if (false == ret)
-        {
-            LOG_ERROR("The audio could not be changed.");
-        }
+        avas_profile_check();
 
         m_cfg_is_print = false;
     }
 
+    if (APPMAN_MSG_ID_TRANS_GEAR == msg_id)
+    {
+        m_avas_gear = *((const uint8_t *)p_msg->p_data);
+
+        avas_profile_check();
+    }
+
+    if (APPMAN_MSG_ID_IGN_STATUS == msg_id)
+    {
+        m_avas_ign = *((const uint8_t *)p_msg->p_data);
+
+        avas_profile_check();
+    }
+
+    if (APPMAN_MSG_ID_PED_ALERT == msg_id)
+    {
+        m_avas_ped_alert = *((const uint8_t *)p_msg->p_data);
+
+        avas_profile_check();
+    }
+
     if (APPMAN_MSG_ID_AUDIO_MUTE_STATUS == msg_id)
     {
         uint8_t tmp = *((uint8_t *)p_msg->p_data);
@@ -644,6 +893,18 @@ static avas_return_t audio_init(void)
         return AVAS_RETURN_ERROR;
     }
 
+    // api_audio starts with the selected audio, the profiles go back to it.
+    ret = api_data_read(API_DATA_LABEL_CURR_AUDIO, &m_avas_sel_audio, 1U, 0U);
+
+    if (false == ret)
+    {
+        m_avas_sel_audio = API_AUDIO_1;
+    }
+
+    avas_calib_read();
+
+    m_avas_profile = AVAS_PROFILE_NONE;
+
     if (false == api_audio_status_get())
     {
         ret = api_audio_play();
@@ -737,22 +998,26 @@ static inline void avas_vehicle_speed_check(uint16_t vehicle_speed)
 
     if (speed != vehicle_speed)
     {
-        api_audio_param_update(vehicle_speed);
+        api_audio_speed_update(vehicle_speed);
+
+        // The raw table parameters are logged for the whole km/h, the played
+        // parameters are interpolated from the calibration curve.
+        uint16_t kmh = (uint16_t)(vehicle_speed >> API_AUDIO_SPEED_SHIFT);
 
-        LOG_DEBUG("Vehicle speed: %u", vehicle_speed);
+        LOG_DEBUG("Vehicle speed: %u", kmh);
 
         speed = vehicle_speed;
 
         uint16_t tmp = 0U;
 
-        bool ret = api_audio_gain_get(&tmp, vehicle_speed);
+        bool ret = api_audio_gain_get(&tmp, kmh);
 
         if (true == ret)
         {
             LOG_DEBUG("Audio Gain: %u", tmp);
         }
 
-        ret = api_audio_freq_get(&tmp, vehicle_speed);
+        ret = api_audio_freq_get(&tmp, kmh);
 
         if (true == ret)
         {
@@ -761,6 +1026,213 @@ static inline void avas_vehicle_speed_check(uint16_t vehicle_speed)
     }
 }
 
+/**
+ * @brief This function provides to select the sound profile.
+ *
+ */
+static void avas_profile_check(void)
+{
+    // The profile is played once the audio is initialized.
+    if ((AVAS_STATE_INIT == m_avas_state) ||
+        (AVAS_STATE_DEINIT == m_avas_state))
+    {
+        return;
+    }
+
+    uint8_t idx = 0U;
+
+    for (; idx < (AVAS_PROFILE_CNT - 1U); idx++)
+    {
+        if (true == avas_profile_match(&m_avas_profile_tbl[idx]))
+        {
+            break;
+        }
+    }
+
+    const avas_profile_t *p_profile = &m_avas_profile_tbl[idx];
+
+    uint8_t audio = avas_profile_audio_get(p_profile);
+
+    if ((idx == m_avas_profile) && (audio == m_avas_profile_audio))
+    {
+        return;
+    }
+
+    LOG_INFO("Sound profile %u; audio:%u", idx, audio);
+
+    bool ret = true;
+
+    if (false == p_profile->play)
+    {
+        if (true == api_audio_status_get())
+        {
+            ret = api_audio_pause();
+        }
+    }
+    else
+    {
+        ret = api_audio_switch(audio);
+
+        if ((true == ret) && (false == api_audio_status_get()))
+        {
+            // A paused audio is in the run state, so api_audio_play() only
+            // resumes it and returns false, the status tells the result.
+            (void)api_audio_play();
+
+            ret = api_audio_status_get();
+        }
+    }
+
+    if (false == ret)
+    {
+        LOG_ERROR("The sound profile could not be changed.");
+
+        return;
+    }
+
+    m_avas_profile = idx;
+
+    m_avas_profile_audio = audio;
+
+    // Only one audio is kept in the background, the one of the other played
+    // profile is loaded, so going back and forth does not stop the playback.
+    uint8_t next = AVAS_AUDIO_NONE;
+
+    for (idx = 0U; idx < AVAS_PROFILE_CNT; idx++)
+    {
+        const avas_profile_t *p_next = &m_avas_profile_tbl[idx];
+
+        uint8_t tmp = avas_profile_audio_get(p_next);
+
+        if ((AVAS_PROFILE_GEAR_REVERSE == p_next->gear) &&
+            (AVAS_CALIB_NONE == m_avas_reverse_gear))
+        {
+            // Placeholder
+        }
+        else if ((true == p_next->play) && (tmp != audio))
+        {
+            next = tmp;
+
+            break;
+        }
+    }
+
+    // Without the standby layer nothing is loaded, the switch reads the audio.
+    if (true == api_audio_standby_get())
+    {
+        m_avas_prefetch_audio = next;
+    }
+    else
+    {
+        m_avas_prefetch_audio = AVAS_AUDIO_NONE;
+    }
+
+    avas_profile_prefetch();
+}
+
+/**
+ * @brief This function checks the sound profile against the vehicle state.
+ *
+ */
+static bool avas_profile_match(const avas_profile_t *p_profile)
+{
+    uint8_t gear = p_profile->gear;
+
+    if (AVAS_PROFILE_GEAR_REVERSE == gear)
+    {
+        // The vehicle has no reverse sound without the calibration.
+        if (AVAS_CALIB_NONE == m_avas_reverse_gear)
+        {
+            return false;
+        }
+
+        gear = m_avas_reverse_gear;
+    }
+
+    return (((AVAS_PROFILE_ANY == gear) || (m_avas_gear == gear)) &&
+            ((AVAS_PROFILE_ANY == p_profile->ign) ||
+             (m_avas_ign == p_profile->ign)) &&
+            ((AVAS_PROFILE_ANY == p_profile->ped_alert) ||
+             (m_avas_ped_alert == p_profile->ped_alert)));
+}
+
+/**
+ * @brief This function returns the audio of the sound profile.
+ *
+ */
+static uint8_t avas_profile_audio_get(const avas_profile_t *p_profile)
+{
+    uint8_t audio = p_profile->audio;
+
+    if ((AVAS_PROFILE_AUDIO_REVERSE == audio) &&
+        (AVAS_CALIB_NONE != m_avas_reverse_audio))
+    {
+        audio = m_avas_reverse_audio;
+    }
+    else if ((AVAS_PROFILE_AUDIO_SEL == audio) ||
+             (AVAS_PROFILE_AUDIO_REVERSE == audio))
+    {
+        audio = m_avas_sel_audio;
+    }
+    else
+    {
+        // Placeholder
+    }
+
+    return audio;
+}
+
+/**
+ * @brief This function provides to read the reverse sound calibration.
+ *
+ */
+static void avas_calib_read(void)
+{
+    bool ret = api_data_read(API_DATA_LABEL_REVERSE_GEAR,
+                             &m_avas_reverse_gear,
+                             1U,
+                             0U);
+
+    if (false == ret)
+    {
+        m_avas_reverse_gear = AVAS_CALIB_NONE;
+    }
+
+    ret = api_data_read(API_DATA_LABEL_REVERSE_AUDIO,
+                        &m_avas_reverse_audio,
+                        1U,
+                        0U);
+
+    // The reverse profile plays the selected audio without a valid slot.
+    if ((false == ret) ||
+        (api_data_audio_slot_cnt_get() <= m_avas_reverse_audio))
+    {
+        m_avas_reverse_audio = AVAS_CALIB_NONE;
+    }
+
+    LOG_INFO("Reverse gear: %u, audio: %u",
+             m_avas_reverse_gear,
+             m_avas_reverse_audio);
+}
+
+/**
+ * @brief This function provides to load the audio of the next profile.
+ *
+ */
+static inline void avas_profile_prefetch(void)
+{
+    if (AVAS_AUDIO_NONE == m_avas_prefetch_audio)
+    {
+        return;
+    }
+
+    if ((m_avas_prefetch_audio == m_avas_profile_audio) ||
+        (true == api_audio_prefetch(m_avas_prefetch_audio)))
+    {
+        m_avas_prefetch_audio = AVAS_AUDIO_NONE;
+    }
+}
+
 /**
  * @brief https://codebeamer.daiichi.com/issue/197003
  *
@@ -883,6 +1355,15 @@ static inline void avas_state_manager(void)
                       AVAS_ERROR_ATTEMPTS);
         }
 
+        if (AVAS_PROFILE_NONE == m_avas_profile)
+        {
+            avas_profile_check();
+        }
+        else
+        {
+            avas_profile_prefetch();
+        }
+
         api_audio_process();
     }
     break;
@@ -125,11 +125,13 @@ typedef enum appman_app_id_e
 typedef enum appman_msg_id_e
 {
     APPMAN_MSG_ID_SYSTEM_STATUS = 0U,
-    APPMAN_MSG_ID_VEHICLE_SPEED = 1U,
+    APPMAN_MSG_ID_VEHICLE_SPEED = 1U, ///< uint16_t in 1/256 km/h (TCO1).
     APPMAN_MSG_ID_TRANS_GEAR = 2U,
     APPMAN_MSG_ID_GEAR = 3U,    
     APPMAN_MSG_ID_CURR_AUDIO = 4U,
     APPMAN_MSG_ID_AUDIO_MUTE_STATUS = 5U,
+    APPMAN_MSG_ID_IGN_STATUS = 6U,
+    APPMAN_MSG_ID_PED_ALERT = 7U,
 
     APPMAN_MSG_ID_SPEAKER_1_OPEN_CIRCUIT = 100U,
     APPMAN_MSG_ID_SPEAKER_1_SHORT_TO_PWR = 101U,
@@ -52,6 +52,38 @@ LOG_MODULE_NAME("BSP_I2S");
  */
 #define EDMA_CH_2 2U
 
+/**
+ * @brief This macro indicates the size of one I2S word moved by the eDMA.
+ *
+ */
+#define I2S_WORD_SIZE (4U)
+
+/**
+ * @brief This macro indicates the bit count of one I2S word.
+ *
+ */
+#define I2S_WORD_BIT_CNT (32U)
+
+/**
+ * @brief This macro indicates the bit clock count of one stereo I2S frame.
+ *
+ */
+#define I2S_FRAME_BIT_CNT (2U * I2S_WORD_BIT_CNT)
+
+/**
+ * @brief This macro indicates the highest major loop count of a descriptor
+ *        when the channel linking is disabled.
+ *
+ */
+#define I2S_TCD_ITER_MAX (0x7FFFU)
+
+/**
+ * @brief This macro indicates the descriptor index of the silence. It follows
+ *        the descriptors of the ring slots.
+ *
+ */
+#define I2S_STCD_SILENCE (BSP_I2S_RING_SLOT_MAX)
+
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
@@ -86,6 +118,85 @@ static edma_chn_state_t m_dma_controller_ch0_state;
  */
 static edma_chn_state_t m_dma_controller_ch1_state;
 
+/**
+ * @brief Holds the scatter-gather descriptors of the playback ring and the
+ *        silence descriptor. One extra descriptor leaves room for the 32-byte
+ *        alignment of the eDMA.
+ *
+ */
+static edma_software_tcd_t m_i2s_stcd_buff[BSP_I2S_RING_SLOT_MAX + 2U];
+
+/**
+ * @brief Holds the zero word sent by the silence descriptor.
+ *
+ */
+static uint32_t m_i2s_zero_word = 0U;
+
+/**
+ * @brief Holds the slot addresses of the running playback ring.
+ *
+ */
+static uint32_t m_i2s_slot_addr[BSP_I2S_RING_SLOT_MAX] = {0U};
+
+/**
+ * @brief Holds the word count of a slot of the running playback ring.
+ *
+ */
+static uint32_t m_i2s_slot_word_cnt = 0U;
+
+/**
+ * @brief Holds the address of the FlexIO shifter buffer fed by the eDMA.
+ *
+ */
+static uint32_t m_i2s_tx_addr = 0U;
+
+/**
+ * @brief Holds the slot count of the running playback ring. Zero means the
+ *        ring is stopped.
+ *
+ */
+static uint32_t m_i2s_slot_cnt = 0U;
+
+/**
+ * @brief Holds the index of the slot the eDMA is playing. It is written by the
+ *        eDMA interrupt only.
+ *
+ */
+static volatile uint32_t m_i2s_play_slot = 0U;
+
+/**
+ * @brief Holds the committed flags of the slots. A flag is set by
+ *        bsp_i2s_slot_commit() and cleared by the eDMA interrupt when the slot
+ *        starts playing.
+ *
+ */
+static volatile bool m_i2s_slot_ready[BSP_I2S_RING_SLOT_MAX] = {false};
+
+/**
+ * @brief Holds the count of the slots started before they were committed.
+ *
+ */
+static volatile uint32_t m_i2s_underrun_cnt = 0U;
+
+/**
+ * @brief Holds the silence mode of the playback ring. The slot interrupts
+ *        pending when the silence starts are ignored.
+ *
+ */
+static volatile bool m_i2s_silence = false;
+
+/**
+ * @brief Holds the eDMA interrupt counts of the transfer modes.
+ *
+ */
+static volatile uint32_t m_i2s_irq_cnt[BSP_I2S_MODE_CNT] = {0U};
+
+/**
+ * @brief Holds the sample rate of the I2S in Hz.
+ *
+ */
+static uint32_t m_i2s_sample_rate = BSP_I2S_SAMPLE_RATE_DEFAULT;
+
 /*******************************************************************************
  * Private Function Declarations
  ******************************************************************************/
@@ -131,6 +242,40 @@ static bool i2s_edma_cfg(void);
  */
 static void i2s_event_cb(i2s_event_t event, void *userData);
 
+/**
+ * @brief eDMA major loop callback of the playback ring. It is called once per
+ *        played slot.
+ *
+ * @param p_param Unused callback parameter.
+ *
+ * @param status eDMA channel status.
+ */
+static void i2s_ring_dma_cb(void *p_param, edma_chn_status_t status);
+
+/**
+ * @brief Gives a scatter-gather descriptor aligned for the eDMA.
+ *
+ * @param idx Slot index or I2S_STCD_SILENCE.
+ *
+ * @return edma_software_tcd_t* Descriptor address.
+ */
+static inline edma_software_tcd_t *i2s_stcd_get(uint32_t idx);
+
+/**
+ * @brief Writes a descriptor of the tx channel, to the registers when no
+ *        software descriptor is given. The zero word is read without a source
+ *        offset.
+ *
+ * @param p_stcd   Software descriptor or NULL.
+ * @param src_addr Source address.
+ * @param word_cnt Word count of the major loop.
+ * @param next     Index of the descriptor loaded at the end of the loop.
+ */
+static void i2s_tcd_set(edma_software_tcd_t *p_stcd,
+                        uint32_t src_addr,
+                        uint32_t word_cnt,
+                        uint32_t next);
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -191,6 +336,11 @@ bool bsp_i2s_init(void)
  */
 bool bsp_i2s_deinit(void)
 {
+    if (0U != m_i2s_slot_cnt)
+    {
+        (void)bsp_i2s_ring_stop();
+    }
+
     status_t ret = FLEXIO_I2S_DRV_MasterDeinit(&m_i2s_master_state);
 
     if (STATUS_SUCCESS != ret)
@@ -231,6 +381,8 @@ bool bsp_i2s_deinit(void)
 
     m_i2s_write = false;
 
+    m_i2s_slot_cnt = 0U;
+
     LOG_INFO("Denitialized");
 
     return true;
@@ -256,6 +408,13 @@ bool bsp_i2s_write(const uint8_t *data, size_t size)
         return false;
     }
 
+    if (0U != m_i2s_slot_cnt)
+    {
+        LOG_ERROR("Playback ring is running");
+
+        return false;
+    }
+
     status_t ret = STATUS_ERROR;
 
     if (false == m_i2s_write)
@@ -304,6 +463,359 @@ bool bsp_i2s_cb_set(bsp_i2s_cb_t callback)
     return true;
 }
 
+/**
+ * @brief The eDMA plays the slots through a closed chain of scatter-gather
+ *        descriptors, so the CPU only refills the slots already played.
+ *
+ */
+bool bsp_i2s_ring_start(uint8_t *const *pp_slot,
+                        uint32_t slot_cnt,
+                        size_t slot_size)
+{
+    if ((NULL == pp_slot) ||
+        (2U > slot_cnt) ||
+        (BSP_I2S_RING_SLOT_MAX < slot_cnt) ||
+        (0U == slot_size) ||
+        (0U != (slot_size % I2S_WORD_SIZE)) ||
+        (I2S_TCD_ITER_MAX < (slot_size / I2S_WORD_SIZE)))
+    {
+        LOG_ERROR("Invalid argument in bsp_i2s_ring_start");
+
+        return false;
+    }
+
+    for (uint32_t idx = 0U; idx < slot_cnt; idx++)
+    {
+        if (NULL == pp_slot[idx])
+        {
+            LOG_ERROR("Invalid argument in bsp_i2s_ring_start");
+
+            return false;
+        }
+    }
+
+    if ((0U != m_i2s_slot_cnt) || (true == m_i2s_write))
+    {
+        LOG_ERROR("I2S is busy");
+
+        return false;
+    }
+
+    // The driver starts the FlexIO shifters and both eDMA channels.
+    status_t ret = FLEXIO_I2S_DRV_MasterSendData(&m_i2s_master_state,
+                                                 pp_slot[0U],
+                                                 (uint32_t)slot_size);
+
+    if (STATUS_SUCCESS != ret)
+    {
+        LOG_ERROR("I2S Send new data Error");
+
+        return false;
+    }
+
+    // The driver ends the transfer when the rx channel has counted the sent
+    // words. The ring never ends, so the rx channel is stopped and the tx
+    // channel is re-programmed with the descriptor ring. Only the first few
+    // words of slot 0 may be sent twice.
+    (void)EDMA_DRV_StopChannel(EDMA_CH_2);
+    (void)EDMA_DRV_InstallCallback(EDMA_CH_2, NULL, NULL);
+    (void)EDMA_DRV_StopChannel(EDMA_CH_1);
+
+    uint8_t shifter = m_i2s_master_state.flexioCommon.resourceIndex;
+
+    // PRQA S 0306 ++ # The eDMA registers hold the addresses as integers.
+    m_i2s_tx_addr = (uint32_t)&(FLEXIO->SHIFTBUFBIS[shifter]);
+
+    for (uint32_t idx = 0U; idx < slot_cnt; idx++)
+    {
+        m_i2s_slot_addr[idx] = (uint32_t)pp_slot[idx];
+    }
+
+    uint32_t zero_addr = (uint32_t)&m_i2s_zero_word;
+    // PRQA S 0306 --
+
+    m_i2s_slot_word_cnt = (uint32_t)(slot_size / I2S_WORD_SIZE);
+
+    // Each descriptor loads the next one, the last one loads the first one.
+    for (uint32_t slot = 0U; slot < slot_cnt; slot++)
+    {
+        uint32_t next = ((slot + 1U) < slot_cnt) ? (slot + 1U) : 0U;
+
+        i2s_tcd_set(i2s_stcd_get(slot),
+                    m_i2s_slot_addr[slot],
+                    m_i2s_slot_word_cnt,
+                    next);
+
+        m_i2s_slot_ready[slot] = true;
+    }
+
+    // The silence descriptor loads itself until the ring is played again.
+    i2s_tcd_set(i2s_stcd_get(I2S_STCD_SILENCE),
+                zero_addr,
+                I2S_TCD_ITER_MAX,
+                I2S_STCD_SILENCE);
+
+    // The slot 0 configuration is loaded directly.
+    i2s_tcd_set(NULL, m_i2s_slot_addr[0U], m_i2s_slot_word_cnt, 1U);
+
+    m_i2s_slot_ready[0U] = false;
+
+    m_i2s_play_slot = 0U;
+
+    m_i2s_underrun_cnt = 0U;
+
+    m_i2s_silence = false;
+
+    for (uint32_t mode = 0U; mode < (uint32_t)BSP_I2S_MODE_CNT; mode++)
+    {
+        m_i2s_irq_cnt[mode] = 0U;
+    }
+
+    m_i2s_slot_cnt = slot_cnt;
+
+    (void)EDMA_DRV_InstallCallback(EDMA_CH_1, i2s_ring_dma_cb, NULL);
+
+    ret = EDMA_DRV_StartChannel(EDMA_CH_1);
+
+    if (STATUS_SUCCESS != ret)
+    {
+        LOG_ERROR("Ring start error");
+
+        (void)bsp_i2s_ring_stop();
+
+        return false;
+    }
+
+    LOG_INFO("Ring started; slot:%u, size:%u", slot_cnt, slot_size);
+
+    return true;
+}
+
+/**
+ * @brief Stops the playback ring.
+ *
+ */
+bool bsp_i2s_ring_stop(void)
+{
+    if (0U == m_i2s_slot_cnt)
+    {
+        return false;
+    }
+
+    (void)EDMA_DRV_StopChannel(EDMA_CH_1);
+
+    status_t ret = FLEXIO_I2S_DRV_MasterTransferAbort(&m_i2s_master_state);
+
+    m_i2s_slot_cnt = 0U;
+
+    m_i2s_silence = false;
+
+    for (uint32_t idx = 0U; idx < BSP_I2S_RING_SLOT_MAX; idx++)
+    {
+        m_i2s_slot_ready[idx] = false;
+    }
+
+    if (STATUS_SUCCESS != ret)
+    {
+        LOG_ERROR("Ring stop error");
+
+        return false;
+    }
+
+    LOG_INFO("Ring stopped; underrun:%u", m_i2s_underrun_cnt);
+
+    return true;
+}
+
+/**
+ * @brief Queues a refilled slot.
+ *
+ */
+bool bsp_i2s_slot_commit(uint32_t slot)
+{
+    if (BSP_I2S_SLOT_STATE_FREE != bsp_i2s_slot_state_get(slot))
+    {
+        return false;
+    }
+
+    m_i2s_slot_ready[slot] = true;
+
+    return true;
+}
+
+/**
+ * @brief Gives the state of a slot.
+ *
+ */
+bsp_i2s_slot_state_t bsp_i2s_slot_state_get(uint32_t slot)
+{
+    if (slot >= m_i2s_slot_cnt)
+    {
+        return BSP_I2S_SLOT_STATE_PLAY;
+    }
+
+    if (slot == m_i2s_play_slot)
+    {
+        return BSP_I2S_SLOT_STATE_PLAY;
+    }
+
+    if (true == m_i2s_slot_ready[slot])
+    {
+        return BSP_I2S_SLOT_STATE_READY;
+    }
+
+    return BSP_I2S_SLOT_STATE_FREE;
+}
+
+/**
+ * @brief Sets the bit clock of the FlexIO I2S for a sample rate.
+ *
+ */
+bool bsp_i2s_rate_set(uint32_t sample_rate)
+{
+    if (0U == sample_rate)
+    {
+        LOG_ERROR("Invalid argument in bsp_i2s_rate_set");
+
+        return false;
+    }
+
+    if ((0U != m_i2s_slot_cnt) || (true == m_i2s_write))
+    {
+        LOG_ERROR("I2S is busy");
+
+        return false;
+    }
+
+    if (m_i2s_sample_rate == sample_rate)
+    {
+        return true;
+    }
+
+    status_t ret = FLEXIO_I2S_DRV_MasterSetConfig(&m_i2s_master_state,
+                                                  sample_rate *
+                                                  I2S_FRAME_BIT_CNT,
+                                                  (uint8_t)I2S_WORD_BIT_CNT);
+
+    if (STATUS_SUCCESS != ret)
+    {
+        LOG_ERROR("I2S rate set error; rate:%u", sample_rate);
+
+        return false;
+    }
+
+    m_i2s_sample_rate = sample_rate;
+
+    LOG_INFO("Rate set; rate:%u", sample_rate);
+
+    return true;
+}
+
+/**
+ * @brief Gives the underrun count of the playback ring.
+ *
+ */
+uint32_t bsp_i2s_underrun_cnt_get(void)
+{
+    return m_i2s_underrun_cnt;
+}
+
+/**
+ * @brief The tx channel is stopped and loaded with the silence descriptor or
+ *        with the descriptor of the next slot. The FlexIO shifter repeats its
+ *        last word meanwhile, which is zero at a silent slot.
+ *
+ */
+bool bsp_i2s_silence_set(bool enable)
+{
+    if (0U == m_i2s_slot_cnt)
+    {
+        LOG_ERROR("Playback ring is not running");
+
+        return false;
+    }
+
+    if (enable == m_i2s_silence)
+    {
+        return true;
+    }
+
+    if (true == enable)
+    {
+        // The slot interrupts are ignored from here, so the playing slot
+        // stays the cut one.
+        m_i2s_silence = true;
+
+        (void)EDMA_DRV_StopChannel(EDMA_CH_1);
+
+        // PRQA S 0306 ++ # The eDMA registers hold the addresses as integers.
+        i2s_tcd_set(NULL,
+                    (uint32_t)&m_i2s_zero_word,
+                    I2S_TCD_ITER_MAX,
+                    I2S_STCD_SILENCE);
+        // PRQA S 0306 --
+    }
+    else
+    {
+        (void)EDMA_DRV_StopChannel(EDMA_CH_1);
+
+        uint32_t slot = m_i2s_play_slot + 1U;
+
+        if (slot >= m_i2s_slot_cnt)
+        {
+            slot = 0U;
+        }
+
+        uint32_t next = ((slot + 1U) < m_i2s_slot_cnt) ? (slot + 1U) : 0U;
+
+        i2s_tcd_set(NULL, m_i2s_slot_addr[slot], m_i2s_slot_word_cnt, next);
+
+        if (false == m_i2s_slot_ready[slot])
+        {
+            m_i2s_underrun_cnt++;
+        }
+
+        m_i2s_slot_ready[slot] = false;
+
+        m_i2s_play_slot = slot;
+
+        m_i2s_silence = false;
+
+        // The eDMA is stopped, so the callback does not race the interrupt.
+        if (NULL != m_i2s_callback)
+        {
+            (*m_i2s_callback)(BSP_I2S_TX_EMPTY);
+        }
+    }
+
+    status_t ret = EDMA_DRV_StartChannel(EDMA_CH_1);
+
+    if (STATUS_SUCCESS != ret)
+    {
+        LOG_ERROR("Silence set error; enable:%u", enable);
+
+        return false;
+    }
+
+    LOG_DEBUG("Silence set; enable:%u", enable);
+
+    return true;
+}
+
+/**
+ * @brief Gives the interrupt count of a transfer mode.
+ *
+ */
+uint32_t bsp_i2s_irq_cnt_get(bsp_i2s_mode_t mode)
+{
+    if (BSP_I2S_MODE_CNT <= mode)
+    {
+        return 0U;
+    }
+
+    return m_i2s_irq_cnt[mode];
+}
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
@@ -316,8 +828,8 @@ static bool i2s_init_cfg(void)
 {
     const flexio_i2s_master_user_config_t i2s_master_cfg =
     {
-        .baudRate = 1024000,
-        .bitsWidth = 32U,
+        .baudRate = BSP_I2S_SAMPLE_RATE_DEFAULT * I2S_FRAME_BIT_CNT,
+        .bitsWidth = I2S_WORD_BIT_CNT,
         .callback = i2s_event_cb,
         .callbackParam = NULL,
         .driverType = FLEXIO_DRIVER_TYPE_DMA,
@@ -339,6 +851,8 @@ static bool i2s_init_cfg(void)
               i2s_master_cfg.bitsWidth,
               ret);
 
+    m_i2s_sample_rate = BSP_I2S_SAMPLE_RATE_DEFAULT;
+
     return (STATUS_SUCCESS == ret);
 }
 
@@ -517,4 +1031,123 @@ static void i2s_event_cb(i2s_event_t event, void *userData)
 }
 //PRQA S 3673 -- 
 
+/**
+ * @brief The eDMA has already loaded the next descriptor when this callback
+ *        runs, so only the bookkeeping is done here.
+ *
+ */
+static void i2s_ring_dma_cb(void *p_param, edma_chn_status_t status)
+{
+    (void)p_param;
+
+    if (true == m_i2s_silence)
+    {
+        m_i2s_irq_cnt[BSP_I2S_MODE_SILENCE]++;
+    }
+    else
+    {
+        m_i2s_irq_cnt[BSP_I2S_MODE_RING]++;
+    }
+
+    if (EDMA_CHN_ERROR == status)
+    {
+        if (NULL != m_i2s_callback)
+        {
+            (*m_i2s_callback)(BSP_I2S_ERROR);
+        }
+
+        LOG_ERROR("BSP_I2S_ERROR");
+
+        return;
+    }
+
+    // The silence descriptor loads itself, no slot has ended.
+    if (true == m_i2s_silence)
+    {
+        return;
+    }
+
+    uint32_t next = m_i2s_play_slot + 1U;
+
+    if (next >= m_i2s_slot_cnt)
+    {
+        next = 0U;
+    }
+
+    if (false == m_i2s_slot_ready[next])
+    {
+        m_i2s_underrun_cnt++;
+    }
+
+    m_i2s_slot_ready[next] = false;
+
+    m_i2s_play_slot = next;
+
+    if (NULL != m_i2s_callback)
+    {
+        (*m_i2s_callback)(BSP_I2S_TX_EMPTY);
+    }
+
+    LOG_VERBOSE("BSP_I2S_TX_EMPTY");
+}
+
+/**
+ * @brief Gives an aligned scatter-gather descriptor.
+ *
+ */
+static inline edma_software_tcd_t *i2s_stcd_get(uint32_t idx)
+{
+    // PRQA S 0306 ++ # The eDMA needs the 32-byte aligned descriptor address.
+    edma_software_tcd_t *p_stcd =
+        (edma_software_tcd_t *)STCD_ADDR(m_i2s_stcd_buff);
+    // PRQA S 0306 --
+
+    return &p_stcd[idx];
+}
+
+/**
+ * @brief Writes a descriptor of the tx channel.
+ *
+ */
+static void i2s_tcd_set(edma_software_tcd_t *p_stcd,
+                        uint32_t src_addr,
+                        uint32_t word_cnt,
+                        uint32_t next)
+{
+    edma_loop_transfer_config_t loop_cfg = {
+        .majorLoopIterationCount = word_cnt,
+    };
+
+    // PRQA S 0306 ++ # The eDMA registers hold the addresses as integers.
+    int16_t src_offset = ((uint32_t)&m_i2s_zero_word == src_addr)
+                             ? 0
+                             : (int16_t)I2S_WORD_SIZE;
+
+    edma_transfer_config_t tcd_cfg = {
+        .srcAddr = src_addr,
+        .destAddr = m_i2s_tx_addr,
+        .srcTransferSize = EDMA_TRANSFER_SIZE_4B,
+        .destTransferSize = EDMA_TRANSFER_SIZE_4B,
+        .srcOffset = src_offset,
+        .destOffset = 0,
+        .srcModulo = EDMA_MODULO_OFF,
+        .destModulo = EDMA_MODULO_OFF,
+        .minorByteTransferCount = I2S_WORD_SIZE,
+        .scatterGatherEnable = true,
+        .scatterGatherNextDescAddr = (uint32_t)i2s_stcd_get(next),
+        .interruptEnable = true,
+        .loopTransferConfig = &loop_cfg,
+    };
+    // PRQA S 0306 --
+
+    if (NULL == p_stcd)
+    {
+        EDMA_DRV_PushConfigToReg(EDMA_CH_1, &tcd_cfg);
+    }
+    else
+    {
+        EDMA_DRV_PushConfigToSTCD(&tcd_cfg, p_stcd);
+    }
+}
+
 /*end of line*/
@@ -17,6 +17,23 @@
 
 #include "daiichi_types.h"
 
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the highest slot count of the playback ring.
+ *
+ */
+#define BSP_I2S_RING_SLOT_MAX (8U)
+
+/**
+ * @brief This macro indicates the sample rate of the I2S in Hz after the
+ *        initialization.
+ *
+ */
+#define BSP_I2S_SAMPLE_RATE_DEFAULT (16000U)
+
 /*******************************************************************************
  * Enumerations
  ******************************************************************************/
@@ -36,6 +53,38 @@ typedef enum bsp_i2s_status_e
 
 } bsp_i2s_status_t;
 
+/**
+ * @brief List of the playback ring slot states.
+ *
+ * A slot is FREE once the eDMA has played it, READY after the CPU refilled and
+ * committed it, and PLAY while the eDMA reads it.
+ *
+ */
+typedef enum bsp_i2s_slot_state_e
+{
+    BSP_I2S_SLOT_STATE_FREE = 0U,
+    BSP_I2S_SLOT_STATE_READY = 1U,
+    BSP_I2S_SLOT_STATE_PLAY = 2U,
+
+} bsp_i2s_slot_state_t;
+
+/**
+ * @brief List of the transfer modes of the running playback ring. The eDMA
+ *        interrupts are counted per mode.
+ *
+ * In the silence mode the eDMA sends one zero word over and over with the
+ * longest major loop, so it interrupts about once a second at 16 kHz instead
+ * of once per slot.
+ *
+ */
+typedef enum bsp_i2s_mode_e
+{
+    BSP_I2S_MODE_RING = 0U,
+    BSP_I2S_MODE_SILENCE = 1U,
+    BSP_I2S_MODE_CNT = 2U,
+
+} bsp_i2s_mode_t;
+
 /*******************************************************************************
  * Type Definitions
  ******************************************************************************/
@@ -99,6 +148,111 @@ bool bsp_i2s_write(const uint8_t* data, size_t size);
  */
 bool bsp_i2s_cb_set(bsp_i2s_cb_t callback);
 
+/**
+ * @brief This function starts the gapless playback of a ring of equally sized
+ *        slots. The slots are linked with eDMA scatter-gather descriptors, so
+ *        the next slot starts without CPU involvement. The callback is called
+ *        with BSP_I2S_TX_EMPTY each time a slot has been played.
+ *
+ * All slots must be filled before the ring is started. The slot memory must
+ * stay valid until bsp_i2s_ring_stop() is called.
+ *
+ * @param[in] pp_slot   Slot addresses.
+ * @param[in] slot_cnt  Slot count, from 2 to BSP_I2S_RING_SLOT_MAX.
+ * @param[in] slot_size Size of a slot in bytes, a multiple of 4.
+ *
+ * @return true  The ring has been started.
+ * @return false An argument is invalid or the transfer could not be started.
+ *
+ */
+bool bsp_i2s_ring_start(uint8_t *const *pp_slot,
+                        uint32_t slot_cnt,
+                        size_t slot_size);
+
+/**
+ * @brief This function stops the playback ring.
+ *
+ * @return true  The ring has been stopped.
+ * @return false The ring is not running or the transfer could not be aborted.
+ *
+ */
+bool bsp_i2s_ring_stop(void);
+
+/**
+ * @brief This function hands a refilled FREE slot back to the eDMA.
+ *
+ * @param[in] slot Slot index.
+ *
+ * @return true  The slot is queued for the playback.
+ * @return false The slot index is invalid or the slot is not FREE.
+ *
+ */
+bool bsp_i2s_slot_commit(uint32_t slot);
+
+/**
+ * @brief This function gives the state of a playback ring slot.
+ *
+ * @param[in] slot Slot index.
+ *
+ * @return bsp_i2s_slot_state_t Slot state. BSP_I2S_SLOT_STATE_PLAY is returned
+ *                              for an invalid slot index so that it is never
+ *                              refilled.
+ *
+ */
+bsp_i2s_slot_state_t bsp_i2s_slot_state_get(uint32_t slot);
+
+/**
+ * @brief This function sets the sample rate of the I2S. The bit clock is set
+ *        for two 32-bit words per frame. The rate is kept over a
+ *        de-initialization until bsp_i2s_init() is called again.
+ *
+ * @param[in] sample_rate Sample rate in Hz.
+ *
+ * @return true  The sample rate has been set.
+ * @return false The sample rate is zero, the I2S is busy or the FlexIO could
+ *               not be configured.
+ *
+ */
+bool bsp_i2s_rate_set(uint32_t sample_rate);
+
+/**
+ * @brief This function gives the count of the slots that the eDMA started
+ *        before they were committed, i.e. the replayed stale slots.
+ *
+ * @return uint32_t Underrun count since the ring was started.
+ *
+ */
+uint32_t bsp_i2s_underrun_cnt_get(void);
+
+/**
+ * @brief This function switches the running playback ring to the silence mode
+ *        and back. The playing slot is cut at once, so it must be silent.
+ *        When the silence ends, the ring goes on with the slot after the cut
+ *        one, and the callback is called with BSP_I2S_TX_EMPTY for the cut
+ *        slot before the eDMA is restarted.
+ *
+ * The committed slots are kept over the silence, the slots can be refilled and
+ * committed meanwhile.
+ *
+ * @param[in] enable True to send silence, false to play the ring again.
+ *
+ * @return true  The mode has been set or was already set.
+ * @return false The ring is not running or the eDMA could not be restarted.
+ *
+ */
+bool bsp_i2s_silence_set(bool enable);
+
+/**
+ * @brief This function gives the eDMA interrupt count of a transfer mode.
+ *
+ * @param[in] mode Transfer mode.
+ *
+ * @return uint32_t Interrupt count since the ring was started, zero for an
+ *                  invalid mode.
+ *
+ */
+uint32_t bsp_i2s_irq_cnt_get(bsp_i2s_mode_t mode);
+
 #endif /*BSP_I2S_H*/
 
 // end of file
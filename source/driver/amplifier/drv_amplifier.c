@@ -39,6 +39,13 @@ LOG_MODULE_NAME("DRV_AMLIFIER");
  */
 #define IB11_ADDR                       0x0BU
 
+/**
+ * @brief This macro indicates the address of the instruction byte holding the
+ *        I2S sample rate.
+ *
+ */
+#define IB1_ADDR                        0x01U
+
 /**
  * @brief https://codebeamer.daiichi.com/issue/192998
  * 
@@ -229,16 +236,31 @@ LOG_MODULE_NAME("DRV_AMLIFIER");
  * @brief https://codebeamer.daiichi.com/issue/193029
  * 
  */
-#define SELECT_48KHZ_WS                 (0x0100U << 2U)
+#define SELECT_48KHZ_WS                 (0x04U << 2U)
 
-// TODO
-#define SELECT_32KHZ_WS                 (0x0010U << 2U)
+/**
+ * @brief This macro indicates the 32 kHz I2S sample rate select of IB1.
+ *
+ */
+#define SELECT_32KHZ_WS                 (0x02U << 2U)
 
-// TODO
-#define SELECT_16KHZ_WS                 (0x0001U << 2U)
+/**
+ * @brief This macro indicates the 16 kHz I2S sample rate select of IB1.
+ *
+ */
+#define SELECT_16KHZ_WS                 (0x01U << 2U)
 
-// TODO
-#define SELECT_8KHZ_WS                  (0x0000U << 2U)
+/**
+ * @brief This macro indicates the 8 kHz I2S sample rate select of IB1.
+ *
+ */
+#define SELECT_8KHZ_WS                  (0x00U << 2U)
+
+/**
+ * @brief This macro indicates the I2S sample rate select bits of IB1.
+ *
+ */
+#define SELECT_WS_MASK                  (0x07U << 2U)
 
 
 /**
@@ -819,6 +841,84 @@ bool drv_amplifier_process(void)
     return true;
 }
 
+/**
+ * @brief The sample rate select is written to both amplifiers.
+ *
+ */
+bool drv_amplifier_rate_set(uint32_t sample_rate)
+{
+    uint8_t ws_select = 0U;
+
+    switch (sample_rate)
+    {
+    case 8000U:
+    {
+        ws_select = (uint8_t)SELECT_8KHZ_WS;
+    }
+    break;
+
+    case 16000U:
+    {
+        ws_select = (uint8_t)SELECT_16KHZ_WS;
+    }
+    break;
+
+    case 32000U:
+    {
+        ws_select = (uint8_t)SELECT_32KHZ_WS;
+    }
+    break;
+
+    case 48000U:
+    {
+        ws_select = (uint8_t)SELECT_48KHZ_WS;
+    }
+    break;
+
+    default:
+    {
+        LOG_ERROR("Invalid argument in drv_amplifier_rate_set");
+
+        return false;
+    }
+    }
+
+    uint8_t ib1 = m_instruction_bytes[IB0_ADDR_SIZE + 1U];
+
+    ib1 = (uint8_t)((ib1 & (uint8_t)~SELECT_WS_MASK) | ws_select);
+
+    uint8_t rate_data[2U] = {IB1_ADDR, ib1};
+
+    bool amp_write_ret = fda903s_write(DRV_AMPLIFIER_CHANNEL_1,
+                                       rate_data,
+                                       sizeof(rate_data));
+
+    if (false == amp_write_ret)
+    {
+        LOG_ERROR("CH-1 rate set failed");
+
+        return false;
+    }
+
+    amp_write_ret = fda903s_write(DRV_AMPLIFIER_CHANNEL_2,
+                                  rate_data,
+                                  sizeof(rate_data));
+
+    if (false == amp_write_ret)
+    {
+        LOG_ERROR("CH-2 rate set failed");
+
+        return false;
+    }
+
+    // The instruction bytes are written again by the diagnostic start.
+    m_instruction_bytes[IB0_ADDR_SIZE + 1U] = ib1;
+
+    LOG_INFO("Rate set; rate:%u", sample_rate);
+
+    return true;
+}
+
 /**
  * @brief https://codebeamer.daiichi.com/issue/193489
  * 
@@ -146,6 +146,21 @@ bool drv_amplifier_unmute(void);
  */
 bool drv_amplifier_process(void);
 
+/**
+ * @brief Sets the I2S sample rate of the amplifiers. The I2S should be
+ *        stopped meanwhile.
+ *
+ * @param[in] sample_rate Sample rate in Hz: 8000, 16000, 32000 or 48000.
+ *
+ * @return bool Success or fail.
+ *
+ * @retval true  Successful.
+ * @retval false Possible errors:
+ *               -Invalid argument.
+ *               -A communication error.
+ */
+bool drv_amplifier_rate_set(uint32_t sample_rate);
+
 /**
  * @brief Implementatiton of drv_amplifier_diag_cb_set.
  *
@@ -0,0 +1,70 @@
+/**
+ * @file crc32.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  CRC-32 (IEEE 802.3, reflected 0x04C11DB7) of byte streams.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The CRC is the one of zlib and of the common file tools: the register starts
+ * at 0xFFFFFFFF and the result is inverted. crc32_update() carries the result
+ * of the previous part, so a stream may be checked in parts of any size,
+ * starting from CRC32_INIT.
+ *
+ * The kernel is slice-by-4: the aligned words are folded four bytes at a time
+ * with four 256-entry tables kept in flash (4 KB), the target (Cortex-M0+)
+ * loads a word as fast as a byte. The bytes before the first aligned word and
+ * after the last one go through the first table.
+ *
+ */
+
+#ifndef CRC32_H
+#define CRC32_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the CRC of an empty stream, the start value of
+ *        crc32_update().
+ *
+ */
+#define CRC32_INIT (0U)
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function adds the bytes of a part to the CRC of a stream.
+ *
+ * @param[in] crc    CRC of the stream so far, CRC32_INIT for a new stream.
+ * @param[in] p_data Bytes of the part.
+ * @param[in] size   Byte count of the part.
+ *
+ * @return uint32_t CRC of the stream with the part.
+ *
+ */
+uint32_t crc32_update(uint32_t crc, const uint8_t *p_data, uint32_t size);
+
+/**
+ * @brief This function gives the CRC of two joined parts from their own CRCs,
+ *        so the parts of a stream may be checked out of order. It takes about
+ *        a thousand shifts, whatever the part sizes.
+ *
+ * @param[in] crc_first  CRC of the first part.
+ * @param[in] crc_second CRC of the second part.
+ * @param[in] size       Byte count of the second part.
+ *
+ * @return uint32_t CRC of the first part followed by the second part.
+ *
+ */
+uint32_t crc32_combine(uint32_t crc_first, uint32_t crc_second, uint32_t size);
+
+#endif /* CRC32_H */
+
+// end of file
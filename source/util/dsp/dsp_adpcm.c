@@ -0,0 +1,235 @@
+/**
+ * @file dsp_adpcm.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the IMA-ADPCM decoder.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "dsp_adpcm.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the mask of a 4-bit code.
+ *
+ */
+#define ADPCM_CODE_MASK (0x0FU)
+
+/**
+ * @brief This macro indicates the sign bit of a 4-bit code.
+ *
+ */
+#define ADPCM_CODE_SIGN (0x08U)
+
+/**
+ * @brief This macro indicates the bit count of a 4-bit code.
+ *
+ */
+#define ADPCM_CODE_SHIFT (4U)
+
+/**
+ * @brief This macro indicates the shift from the 16-bit sample to the upper
+ *        half of the 32-bit PCM sample.
+ *
+ */
+#define ADPCM_PCM_SHIFT (16U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/**
+ * @brief IMA-ADPCM quantizer steps.
+ *
+ */
+static const uint16_t m_adpcm_step[DSP_ADPCM_INDEX_MAX + 1U] = {
+    7U, 8U, 9U, 10U, 11U, 12U, 13U, 14U, 16U, 17U,
+    19U, 21U, 23U, 25U, 28U, 31U, 34U, 37U, 41U, 45U,
+    50U, 55U, 60U, 66U, 73U, 80U, 88U, 97U, 107U, 118U,
+    130U, 143U, 157U, 173U, 190U, 209U, 230U, 253U, 279U, 307U,
+    337U, 371U, 408U, 449U, 494U, 544U, 598U, 658U, 724U, 796U,
+    876U, 963U, 1060U, 1166U, 1282U, 1411U, 1552U, 1707U, 1878U, 2066U,
+    2272U, 2499U, 2749U, 3024U, 3327U, 3660U, 4026U, 4428U, 4871U, 5358U,
+    5894U, 6484U, 7132U, 7845U, 8630U, 9493U, 10442U, 11487U, 12635U, 13899U,
+    15289U, 16818U, 18500U, 20350U, 22385U, 24623U, 27086U, 29794U, 32767U,
+};
+
+/**
+ * @brief IMA-ADPCM step index changes of the code magnitudes.
+ *
+ */
+static const int8_t m_adpcm_index_adj[ADPCM_CODE_SIGN] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+};
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+bool dsp_adpcm_hdr_load(dsp_adpcm_t *p_adpcm, const uint8_t *p_hdr)
+{
+    if (NULL == p_adpcm)
+    {
+        return false;
+    }
+
+    if (NULL == p_hdr)
+    {
+        return false;
+    }
+
+    for (uint32_t ch = 0U; ch < DSP_ADPCM_CH_CNT; ch++)
+    {
+        const uint8_t *p_ch_hdr = &p_hdr[ch * DSP_ADPCM_CH_HDR_SIZE];
+
+        uint32_t index = p_ch_hdr[2U];
+
+        if (DSP_ADPCM_INDEX_MAX < index)
+        {
+            return false;
+        }
+
+        uint16_t pred = (uint16_t)((uint16_t)p_ch_hdr[0U] |
+                                   ((uint16_t)p_ch_hdr[1U] << 8U));
+
+        p_adpcm->ch[ch].pred = (int32_t)(int16_t)pred;
+        p_adpcm->ch[ch].index = index;
+    }
+
+    return true;
+}
+
+void dsp_adpcm_decode(dsp_adpcm_t *p_adpcm,
+                      const uint8_t *p_in,
+                      int32_t *p_out,
+                      uint32_t frame_cnt)
+{
+    if ((NULL == p_adpcm) || (NULL == p_in))
+    {
+        return;
+    }
+
+    dsp_adpcm_ch_t *p_left = &p_adpcm->ch[0U];
+    dsp_adpcm_ch_t *p_right = &p_adpcm->ch[1U];
+
+    for (uint32_t frame = 0U; frame < frame_cnt; frame++)
+    {
+        uint32_t code = p_in[frame];
+
+        int32_t left = dsp_adpcm_code_decode(p_left, code & ADPCM_CODE_MASK);
+
+        int32_t right = dsp_adpcm_code_decode(p_right,
+                                              code >> ADPCM_CODE_SHIFT);
+
+        if (NULL != p_out)
+        {
+            // PRQA S 3101, 4532 ++ # Shift of the signed 16-bit sample is intended.
+            *p_out = (int32_t)((uint32_t)left << ADPCM_PCM_SHIFT);
+            p_out++;
+            *p_out = (int32_t)((uint32_t)right << ADPCM_PCM_SHIFT);
+            p_out++;
+            // PRQA S 3101, 4532 --
+        }
+    }
+}
+
+int32_t dsp_adpcm_code_decode(dsp_adpcm_ch_t *p_ch, uint32_t code)
+{
+    uint32_t step = m_adpcm_step[p_ch->index];
+
+    // diff = (magnitude + 0.5) * step / 4 without a multiply.
+    uint32_t diff = step >> 3U;
+
+    if (0U != (code & 0x04U))
+    {
+        diff += step;
+    }
+
+    if (0U != (code & 0x02U))
+    {
+        diff += step >> 1U;
+    }
+
+    if (0U != (code & 0x01U))
+    {
+        diff += step >> 2U;
+    }
+
+    int32_t pred = p_ch->pred;
+
+    if (0U != (code & ADPCM_CODE_SIGN))
+    {
+        pred -= (int32_t)diff;
+    }
+    else
+    {
+        pred += (int32_t)diff;
+    }
+
+    if (INT16_MAX < pred)
+    {
+        pred = INT16_MAX;
+    }
+    else if (INT16_MIN > pred)
+    {
+        pred = INT16_MIN;
+    }
+    else
+    {
+        // Placeholder
+    }
+
+    int32_t index = (int32_t)p_ch->index +
+                    m_adpcm_index_adj[code & (ADPCM_CODE_SIGN - 1U)];
+
+    if (0 > index)
+    {
+        index = 0;
+    }
+    else if ((int32_t)DSP_ADPCM_INDEX_MAX < index)
+    {
+        index = (int32_t)DSP_ADPCM_INDEX_MAX;
+    }
+    else
+    {
+        // Placeholder
+    }
+
+    p_ch->pred = pred;
+    p_ch->index = (uint32_t)index;
+
+    return pred;
+}
+
+uint32_t dsp_adpcm_step_get(uint32_t index)
+{
+    if (DSP_ADPCM_INDEX_MAX < index)
+    {
+        index = DSP_ADPCM_INDEX_MAX;
+    }
+
+    return m_adpcm_step[index];
+}
+
+uint32_t dsp_adpcm_frame_cnt_get(uint32_t size)
+{
+    uint32_t frame_cnt = (size / DSP_ADPCM_BLOCK_SIZE) *
+                         DSP_ADPCM_BLOCK_FRAME_CNT;
+
+    uint32_t rest = size % DSP_ADPCM_BLOCK_SIZE;
+
+    if (DSP_ADPCM_HDR_SIZE < rest)
+    {
+        frame_cnt += rest - DSP_ADPCM_HDR_SIZE;
+    }
+
+    return frame_cnt;
+}
+
+// end of file
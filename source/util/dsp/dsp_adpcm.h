@@ -0,0 +1,160 @@
+/**
+ * @file dsp_adpcm.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  IMA-ADPCM decoder for the compressed stereo audio slots.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The compressed audio is stored as independent blocks of
+ * DSP_ADPCM_BLOCK_FRAME_CNT stereo frames, so the playback can start at any
+ * block. A block starts with one header per channel (little-endian int16_t
+ * predictor, uint8_t step index, one reserved byte) followed by one byte per
+ * frame, the low nibble is the left and the high nibble is the right channel.
+ * The last block of a file may be shorter.
+ *
+ * Each 4-bit code stands for a 16-bit sample (4:1), which is returned in the
+ * upper half of a 32-bit PCM sample (8:1 against the 32-bit PCM slots).
+ *
+ */
+
+#ifndef DSP_ADPCM_H
+#define DSP_ADPCM_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the channel count of a frame.
+ *
+ */
+#define DSP_ADPCM_CH_CNT (2U)
+
+/**
+ * @brief This macro indicates the header size of one channel in bytes.
+ *
+ */
+#define DSP_ADPCM_CH_HDR_SIZE (4U)
+
+/**
+ * @brief This macro indicates the header size of a block in bytes.
+ *
+ */
+#define DSP_ADPCM_HDR_SIZE (DSP_ADPCM_CH_HDR_SIZE * DSP_ADPCM_CH_CNT)
+
+/**
+ * @brief This macro indicates the frame count of a block.
+ *
+ */
+#define DSP_ADPCM_BLOCK_FRAME_CNT (256U)
+
+/**
+ * @brief This macro indicates the size of a full block in bytes.
+ *
+ */
+#define DSP_ADPCM_BLOCK_SIZE (DSP_ADPCM_HDR_SIZE + DSP_ADPCM_BLOCK_FRAME_CNT)
+
+/**
+ * @brief This macro indicates the highest step index.
+ *
+ */
+#define DSP_ADPCM_INDEX_MAX (88U)
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to the decoder state of one channel.
+ *
+ */
+typedef struct dsp_adpcm_ch_s
+{
+    int32_t pred;
+    uint32_t index;
+
+} dsp_adpcm_ch_t;
+
+/**
+ * @brief Data structure corresponds to the decoder state.
+ *
+ */
+typedef struct dsp_adpcm_s
+{
+    dsp_adpcm_ch_t ch[DSP_ADPCM_CH_CNT];
+
+} dsp_adpcm_t;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function loads the decoder state from a block header.
+ *
+ * @param[out] p_adpcm Decoder state.
+ * @param[in]  p_hdr   Block header of DSP_ADPCM_HDR_SIZE bytes.
+ *
+ * @return bool Load status.
+ *
+ * @retval true  The state has been loaded.
+ * @retval false The step index is out of range or an argument is invalid.
+ *
+ */
+bool dsp_adpcm_hdr_load(dsp_adpcm_t *p_adpcm, const uint8_t *p_hdr);
+
+/**
+ * @brief This function decodes the frames of a block to 32-bit interleaved
+ *        stereo PCM. The output may not overlap the input.
+ *
+ * @param[in,out] p_adpcm   Decoder state.
+ * @param[in]     p_in      Coded frames, one byte per frame.
+ * @param[out]    p_out     PCM frames. NULL only advances the state, it is
+ *                          used to start in the middle of a block.
+ * @param[in]     frame_cnt Frame count.
+ *
+ */
+void dsp_adpcm_decode(dsp_adpcm_t *p_adpcm,
+                      const uint8_t *p_in,
+                      int32_t *p_out,
+                      uint32_t frame_cnt);
+
+/**
+ * @brief This function decodes one 4-bit code and updates the channel state.
+ *        The encoder uses it to track the decoder exactly.
+ *
+ * @param[in,out] p_ch Channel state.
+ * @param[in]     code 4-bit code.
+ *
+ * @return int32_t Decoded 16-bit sample.
+ *
+ */
+int32_t dsp_adpcm_code_decode(dsp_adpcm_ch_t *p_ch, uint32_t code);
+
+/**
+ * @brief This function returns the quantizer step of the step index.
+ *
+ * @param[in] index Step index, clamped to DSP_ADPCM_INDEX_MAX.
+ *
+ * @return uint32_t Quantizer step.
+ *
+ */
+uint32_t dsp_adpcm_step_get(uint32_t index);
+
+/**
+ * @brief This function returns the frame count stored in a compressed file.
+ *
+ * @param[in] size Compressed byte count.
+ *
+ * @return uint32_t Frame count.
+ *
+ */
+uint32_t dsp_adpcm_frame_cnt_get(uint32_t size);
+
+#endif /* DSP_ADPCM_H */
+
+// end of file
@@ -0,0 +1,136 @@
+/**
+ * @file dsp_biquad.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the biquad cascade.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "dsp_biquad.h"
+
+#include <string.h>
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the bit count of the lower half of a 32-bit
+ *        sample, it is dropped by the cascade.
+ *
+ */
+#define BIQUAD_SAMPLE_SHIFT (16U)
+
+/**
+ * @brief This macro indicates the mask of the fraction dropped by the output
+ *        shift of a stage.
+ *
+ */
+#define BIQUAD_FRAC_MASK ((1U << DSP_BIQUAD_COEF_SHIFT) - 1U)
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void dsp_biquad_init(dsp_biquad_t *p_biquad)
+{
+    if (NULL == p_biquad)
+    {
+        return;
+    }
+
+    (void)memset(p_biquad, 0, sizeof(dsp_biquad_t));
+}
+
+bool dsp_biquad_set(dsp_biquad_t *p_biquad,
+                    const int16_t *p_coef,
+                    uint32_t stage_cnt)
+{
+    if ((NULL == p_biquad) || (NULL == p_coef) ||
+        (DSP_BIQUAD_STAGE_MAX < stage_cnt))
+    {
+        return false;
+    }
+
+    dsp_biquad_init(p_biquad);
+
+    (void)memcpy(p_biquad->coef,
+                 p_coef,
+                 stage_cnt * DSP_BIQUAD_COEF_CNT * sizeof(int16_t));
+
+    p_biquad->stage_cnt = stage_cnt;
+
+    return true;
+}
+
+int32_t dsp_biquad_run(dsp_biquad_t *p_biquad, int32_t sample)
+{
+    uint32_t stage_cnt = p_biquad->stage_cnt;
+
+    if (0U == stage_cnt)
+    {
+        return sample;
+    }
+
+    // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed sample is intended.
+    int32_t in = sample >> BIQUAD_SAMPLE_SHIFT;
+    // PRQA S 3101, 4532 --
+
+    for (uint32_t stage = 0U; stage < stage_cnt; stage++)
+    {
+        const int16_t *p_coef = p_biquad->coef[stage];
+
+        int16_t *p_x = p_biquad->hist[stage];
+        int16_t *p_y = p_biquad->hist[stage + 1U];
+
+        // Every product fits in 32 bits. The sum wraps, only the output has
+        // to fit, so it is built unsigned.
+        uint32_t acc = (uint32_t)p_biquad->err[stage];
+
+        acc += (uint32_t)(p_coef[0U] * in);
+        acc += (uint32_t)(p_coef[1U] * p_x[0U]);
+        acc += (uint32_t)(p_coef[2U] * p_x[1U]);
+        acc -= (uint32_t)(p_coef[3U] * p_y[0U]);
+        acc -= (uint32_t)(p_coef[4U] * p_y[1U]);
+
+        p_biquad->err[stage] = (int32_t)(acc & BIQUAD_FRAC_MASK);
+
+        // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed sum is intended.
+        int32_t out = (int32_t)acc >> DSP_BIQUAD_COEF_SHIFT;
+        // PRQA S 3101, 4532 --
+
+        if (INT16_MAX < out)
+        {
+            out = INT16_MAX;
+        }
+        else if (INT16_MIN > out)
+        {
+            out = INT16_MIN;
+        }
+        else
+        {
+            // Placeholder
+        }
+
+        p_x[1U] = p_x[0U];
+        p_x[0U] = (int16_t)in;
+
+        in = out;
+    }
+
+    // The inputs of a stage are the outputs of the one before, so only the
+    // outputs of the last stage are left.
+    int16_t *p_y = p_biquad->hist[stage_cnt];
+
+    p_y[1U] = p_y[0U];
+    p_y[0U] = (int16_t)in;
+
+    // PRQA S 3101 ++ # The sample is moved back to the upper half.
+    return (int32_t)((uint32_t)in << BIQUAD_SAMPLE_SHIFT);
+    // PRQA S 3101 --
+}
+
+// end of file
@@ -0,0 +1,123 @@
+/**
+ * @file dsp_biquad.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Fixed-point Direct-Form-I biquad cascade for the speaker EQ.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The target (Cortex-M0+) has a single cycle 32x32->32 multiply but no MAC
+ * and no long multiply. The cascade therefore runs on the upper 16 bits of
+ * the samples with Q14 coefficients, so every product is a 16x16 multiply
+ * which fits in 32 bits. The sum is built with wrapping arithmetic, so the
+ * partial sums may overflow as long as the output fits. The fraction dropped
+ * by the output shift is fed back to the next sample of the stage, which
+ * keeps the noise of the low frequency sections down.
+ *
+ * The output of a stage is the input of the next one, so the stages share
+ * their history and a cascade of N stages keeps N + 1 sample pairs.
+ *
+ */
+
+#ifndef DSP_BIQUAD_H
+#define DSP_BIQUAD_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the highest stage count of a cascade.
+ *
+ */
+#define DSP_BIQUAD_STAGE_MAX (4U)
+
+/**
+ * @brief This macro indicates the coefficient count of a stage, in the order
+ *        b0, b1, b2, a1, a2 of y = b0.x0 + b1.x1 + b2.x2 - a1.y1 - a2.y2.
+ *
+ */
+#define DSP_BIQUAD_COEF_CNT (5U)
+
+/**
+ * @brief This macro indicates the fractional bit count of the coefficients.
+ *
+ */
+#define DSP_BIQUAD_COEF_SHIFT (14U)
+
+/**
+ * @brief This macro indicates the coefficient of 1.0 in Q14 format.
+ *
+ */
+#define DSP_BIQUAD_COEF_UNITY (16384)
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to the cascade state. The history entry
+ *        of a stage holds its last two inputs, the last entry holds the last
+ *        two outputs of the cascade.
+ *
+ */
+typedef struct dsp_biquad_s
+{
+    int16_t coef[DSP_BIQUAD_STAGE_MAX][DSP_BIQUAD_COEF_CNT];
+
+    int16_t hist[DSP_BIQUAD_STAGE_MAX + 1U][2U];
+
+    int32_t err[DSP_BIQUAD_STAGE_MAX];
+
+    uint32_t stage_cnt;
+
+} dsp_biquad_t;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function resets the cascade to pass the samples unchanged.
+ *
+ * @param[out] p_biquad Cascade state.
+ *
+ */
+void dsp_biquad_init(dsp_biquad_t *p_biquad);
+
+/**
+ * @brief This function sets the coefficients of the cascade and clears its
+ *        history.
+ *
+ * @param[in,out] p_biquad  Cascade state.
+ * @param[in]     p_coef    Q14 coefficients, DSP_BIQUAD_COEF_CNT per stage.
+ * @param[in]     stage_cnt Stage count, zero passes the samples unchanged.
+ *
+ * @return bool Set status.
+ *
+ * @retval true  The coefficients have been set.
+ * @retval false The stage count or a pointer is invalid.
+ *
+ */
+bool dsp_biquad_set(dsp_biquad_t *p_biquad,
+                    const int16_t *p_coef,
+                    uint32_t stage_cnt);
+
+/**
+ * @brief This function filters one 32-bit sample through the cascade. The
+ *        lower 16 bits of the sample are dropped when a stage is set.
+ *
+ * @param[in,out] p_biquad Cascade state.
+ * @param[in]     sample   32-bit PCM sample.
+ *
+ * @return int32_t Filtered sample.
+ *
+ */
+int32_t dsp_biquad_run(dsp_biquad_t *p_biquad, int32_t sample);
+
+#endif /* DSP_BIQUAD_H */
+
+// end of file
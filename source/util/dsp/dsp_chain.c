@@ -0,0 +1,163 @@
+/**
+ * @file dsp_chain.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the per-speaker chains.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "dsp_chain.h"
+
+#include "dsp_gain.h"
+
+/*******************************************************************************
+ * Private Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief This function updates the flag of the chains passing the frames
+ *        unchanged.
+ *
+ * @param[in,out] p_chain Chains of the channels.
+ *
+ */
+static void chain_flat_update(dsp_chain_t *p_chain);
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void dsp_chain_init(dsp_chain_t *p_chain)
+{
+    if (NULL == p_chain)
+    {
+        return;
+    }
+
+    for (uint32_t ch = 0U; ch < DSP_CHAIN_CH_CNT; ch++)
+    {
+        dsp_biquad_init(&p_chain->ch[ch].eq);
+
+        dsp_limiter_init(&p_chain->ch[ch].limiter);
+
+        p_chain->ch[ch].gain = DSP_GAIN_UNITY_Q15;
+    }
+
+    p_chain->flat = true;
+}
+
+bool dsp_chain_gain_set(dsp_chain_t *p_chain, uint32_t ch, uint32_t gain_q15)
+{
+    if ((NULL == p_chain) || (DSP_CHAIN_CH_CNT <= ch))
+    {
+        return false;
+    }
+
+    if (DSP_GAIN_MAX_Q15 < gain_q15)
+    {
+        gain_q15 = DSP_GAIN_MAX_Q15;
+    }
+
+    p_chain->ch[ch].gain = gain_q15;
+
+    chain_flat_update(p_chain);
+
+    return true;
+}
+
+bool dsp_chain_eq_set(dsp_chain_t *p_chain,
+                      uint32_t ch,
+                      const int16_t *p_coef,
+                      uint32_t stage_cnt)
+{
+    if ((NULL == p_chain) || (DSP_CHAIN_CH_CNT <= ch))
+    {
+        return false;
+    }
+
+    bool ret = dsp_biquad_set(&p_chain->ch[ch].eq, p_coef, stage_cnt);
+
+    chain_flat_update(p_chain);
+
+    return ret;
+}
+
+bool dsp_chain_limiter_set(dsp_chain_t *p_chain, uint32_t ch, uint32_t thr_q15)
+{
+    if ((NULL == p_chain) || (DSP_CHAIN_CH_CNT <= ch))
+    {
+        return false;
+    }
+
+    bool ret = dsp_limiter_thr_set(&p_chain->ch[ch].limiter, thr_q15);
+
+    chain_flat_update(p_chain);
+
+    return ret;
+}
+
+void dsp_chain_process(dsp_chain_t *p_chain,
+                       int32_t *p_frames,
+                       uint32_t frame_cnt)
+{
+    if ((NULL == p_chain) || (NULL == p_frames) || (true == p_chain->flat))
+    {
+        return;
+    }
+
+    // The settings are kept in registers for the whole block.
+    dsp_biquad_t *p_eq_l = &p_chain->ch[0U].eq;
+    dsp_biquad_t *p_eq_r = &p_chain->ch[1U].eq;
+
+    dsp_limiter_t *p_limiter_l = &p_chain->ch[0U].limiter;
+    dsp_limiter_t *p_limiter_r = &p_chain->ch[1U].limiter;
+
+    uint32_t gain_l = p_chain->ch[0U].gain;
+    uint32_t gain_r = p_chain->ch[1U].gain;
+
+    for (uint32_t frame = 0U; frame < frame_cnt; frame++)
+    {
+        int32_t left = p_frames[0U];
+        int32_t right = p_frames[1U];
+
+        left = dsp_biquad_run(p_eq_l, left);
+        right = dsp_biquad_run(p_eq_r, right);
+
+        left = dsp_gain_s32_mul(left, gain_l);
+        right = dsp_gain_s32_mul(right, gain_r);
+
+        left = dsp_limiter_run(p_limiter_l, left);
+        right = dsp_limiter_run(p_limiter_r, right);
+
+        p_frames[0U] = left;
+        p_frames[1U] = right;
+
+        p_frames = &p_frames[DSP_CHAIN_CH_CNT];
+    }
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void chain_flat_update(dsp_chain_t *p_chain)
+{
+    bool flat = true;
+
+    for (uint32_t ch = 0U; ch < DSP_CHAIN_CH_CNT; ch++)
+    {
+        if ((DSP_GAIN_UNITY_Q15 != p_chain->ch[ch].gain) ||
+            (0U != p_chain->ch[ch].eq.stage_cnt) ||
+            (true == p_chain->ch[ch].limiter.enable))
+        {
+            flat = false;
+        }
+    }
+
+    p_chain->flat = flat;
+}
+
+// end of file
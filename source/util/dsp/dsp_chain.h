@@ -0,0 +1,146 @@
+/**
+ * @file dsp_chain.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Per-speaker processing chains of the stereo output.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The left channel of the I2S frames drives the first amplifier channel and
+ * the right channel the second one. Each channel has its own chain settings
+ * and state. The chains walk the interleaved frames once, the two samples of
+ * a frame are split and processed by their own chain in the same pass.
+ *
+ * A chain runs the EQ cascade first, then the gain and the limiter.
+ *
+ */
+
+#ifndef DSP_CHAIN_H
+#define DSP_CHAIN_H
+
+#include "daiichi_types.h"
+
+#include "dsp_biquad.h"
+#include "dsp_limiter.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the channel count of a frame, one chain per
+ *        channel.
+ *
+ */
+#define DSP_CHAIN_CH_CNT (2U)
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to the chain of one channel.
+ *
+ */
+typedef struct dsp_chain_ch_s
+{
+    dsp_biquad_t eq;
+
+    dsp_limiter_t limiter;
+
+    uint32_t gain;
+
+} dsp_chain_ch_t;
+
+/**
+ * @brief Data structure corresponds to the chains of the channels.
+ *
+ */
+typedef struct dsp_chain_s
+{
+    dsp_chain_ch_t ch[DSP_CHAIN_CH_CNT];
+
+    bool flat;
+
+} dsp_chain_t;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function resets the chains to pass the frames unchanged.
+ *
+ * @param[out] p_chain Chains of the channels.
+ *
+ */
+void dsp_chain_init(dsp_chain_t *p_chain);
+
+/**
+ * @brief This function sets the gain of the chain of one channel.
+ *
+ * @param[in,out] p_chain  Chains of the channels.
+ * @param[in]     ch       Channel index, 0 is the left channel.
+ * @param[in]     gain_q15 Gain in Q15 format, clamped to DSP_GAIN_MAX_Q15.
+ *
+ * @return bool Set status.
+ *
+ * @retval true  The gain has been set.
+ * @retval false The channel or the pointer is invalid.
+ *
+ */
+bool dsp_chain_gain_set(dsp_chain_t *p_chain, uint32_t ch, uint32_t gain_q15);
+
+/**
+ * @brief This function sets the EQ cascade of the chain of one channel.
+ *
+ * @param[in,out] p_chain   Chains of the channels.
+ * @param[in]     ch        Channel index, 0 is the left channel.
+ * @param[in]     p_coef    Q14 coefficients, DSP_BIQUAD_COEF_CNT per stage.
+ * @param[in]     stage_cnt Stage count, zero turns the EQ off.
+ *
+ * @return bool Set status.
+ *
+ * @retval true  The cascade has been set.
+ * @retval false The channel, the stage count or a pointer is invalid.
+ *
+ */
+bool dsp_chain_eq_set(dsp_chain_t *p_chain,
+                      uint32_t ch,
+                      const int16_t *p_coef,
+                      uint32_t stage_cnt);
+
+/**
+ * @brief This function sets the limiter threshold of the chain of one channel
+ *        and turns its limiter on. The limiter delays the channel by
+ *        DSP_LIMITER_DELAY_CNT samples.
+ *
+ * @param[in,out] p_chain Chains of the channels.
+ * @param[in]     ch      Channel index, 0 is the left channel.
+ * @param[in]     thr_q15 Threshold relative to the full scale in Q15 format.
+ *
+ * @return bool Set status.
+ *
+ * @retval true  The threshold has been set.
+ * @retval false The channel, the threshold or the pointer is invalid.
+ *
+ */
+bool dsp_chain_limiter_set(dsp_chain_t *p_chain, uint32_t ch, uint32_t thr_q15);
+
+/**
+ * @brief This function processes the interleaved 32-bit stereo frames in
+ *        place, each channel through its own chain.
+ *
+ * @param[in,out] p_chain   Chains of the channels.
+ * @param[in,out] p_frames  Interleaved 32-bit stereo frames.
+ * @param[in]     frame_cnt Frame count.
+ *
+ */
+void dsp_chain_process(dsp_chain_t *p_chain,
+                       int32_t *p_frames,
+                       uint32_t frame_cnt);
+
+#endif /* DSP_CHAIN_H */
+
+// end of file
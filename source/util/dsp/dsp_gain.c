@@ -0,0 +1,265 @@
+/**
+ * @file dsp_gain.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the fixed-point gain stage.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "dsp_gain.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the mask of the lower half of a 32-bit sample.
+ *
+ */
+#define GAIN_LOW_HALF_MASK (0xFFFFU)
+
+/**
+ * @brief This macro indicates the bit count of the lower half of a 32-bit
+ *        sample.
+ *
+ */
+#define GAIN_LOW_HALF_SHIFT (16U)
+
+/**
+ * @brief This macro indicates the extra fractional bit count of the gain
+ *        accumulator of the ramp.
+ *
+ */
+#define GAIN_RAMP_FRAC_SHIFT (8U)
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+uint32_t dsp_gain_q15_get(uint32_t num, uint32_t den)
+{
+    if (0U == den)
+    {
+        return 0U;
+    }
+
+    uint64_t gain = ((uint64_t)num << DSP_GAIN_Q15_SHIFT) / den;
+
+    if (DSP_GAIN_MAX_Q15 < gain)
+    {
+        gain = DSP_GAIN_MAX_Q15;
+    }
+
+    return (uint32_t)gain;
+}
+
+int32_t dsp_gain_s32_mul(int32_t sample, uint32_t gain_q15)
+{
+    // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed upper half is intended.
+    int32_t high = sample >> GAIN_LOW_HALF_SHIFT;
+    // PRQA S 3101, 4532 --
+
+    uint32_t low = (uint32_t)sample & GAIN_LOW_HALF_MASK;
+
+    // |high| <= 2^15 and gain_q15 < 2^16, the product always fits.
+    int32_t high_prod = high * (int32_t)gain_q15;
+
+    int32_t low_prod = (int32_t)((low * gain_q15) >> DSP_GAIN_Q15_SHIFT);
+
+    // (sample * gain) >> 15 == (high * gain * 2) + ((low * gain) >> 15)
+    if (high_prod > ((INT32_MAX - low_prod) / 2))
+    {
+        return INT32_MAX;
+    }
+
+    if (high_prod < (INT32_MIN / 2))
+    {
+        return INT32_MIN;
+    }
+
+    return (high_prod * 2) + low_prod;
+}
+
+void dsp_gain_s32_apply(int32_t *p_samples, uint32_t cnt, uint32_t gain_q15)
+{
+    if ((NULL == p_samples) || (DSP_GAIN_UNITY_Q15 == gain_q15))
+    {
+        return;
+    }
+
+    if (DSP_GAIN_MAX_Q15 < gain_q15)
+    {
+        gain_q15 = DSP_GAIN_MAX_Q15;
+    }
+
+    uint32_t idx = 0U;
+
+    // Stereo frames are processed as pairs to halve the loop overhead.
+    for (; (idx + 1U) < cnt; idx += 2U)
+    {
+        p_samples[idx] = dsp_gain_s32_mul(p_samples[idx], gain_q15);
+        p_samples[idx + 1U] = dsp_gain_s32_mul(p_samples[idx + 1U], gain_q15);
+    }
+
+    if (idx < cnt)
+    {
+        p_samples[idx] = dsp_gain_s32_mul(p_samples[idx], gain_q15);
+    }
+}
+
+void dsp_gain_s32_ramp(int32_t *p_samples,
+                       uint32_t frame_cnt,
+                       uint32_t ch_cnt,
+                       uint32_t gain_start,
+                       uint32_t gain_end)
+{
+    if ((NULL == p_samples) || (0U == frame_cnt) || (0U == ch_cnt))
+    {
+        return;
+    }
+
+    if (DSP_GAIN_MAX_Q15 < gain_start)
+    {
+        gain_start = DSP_GAIN_MAX_Q15;
+    }
+
+    if (DSP_GAIN_MAX_Q15 < gain_end)
+    {
+        gain_end = DSP_GAIN_MAX_Q15;
+    }
+
+    if (gain_start == gain_end)
+    {
+        dsp_gain_s32_apply(p_samples, frame_cnt * ch_cnt, gain_start);
+
+        return;
+    }
+
+    // The accumulator holds the gain with extra fractional bits, so a slow
+    // ramp still moves on every frame.
+    int32_t acc = (int32_t)(gain_start << GAIN_RAMP_FRAC_SHIFT);
+
+    int32_t inc = (((int32_t)gain_end - (int32_t)gain_start) *
+                   (int32_t)(1UL << GAIN_RAMP_FRAC_SHIFT)) /
+                  (int32_t)frame_cnt;
+
+    for (uint32_t frame = 0U; frame < frame_cnt; frame++)
+    {
+        uint32_t gain = (uint32_t)acc >> GAIN_RAMP_FRAC_SHIFT;
+
+        for (uint32_t ch = 0U; ch < ch_cnt; ch++)
+        {
+            *p_samples = dsp_gain_s32_mul(*p_samples, gain);
+
+            p_samples++;
+        }
+
+        acc += inc;
+    }
+}
+
+void dsp_gain_s32_xfade(int32_t *p_out,
+                        const int32_t *p_in,
+                        uint32_t frame_cnt,
+                        uint32_t ch_cnt)
+{
+    if ((NULL == p_out) || (NULL == p_in) ||
+        (0U == frame_cnt) || (0U == ch_cnt))
+    {
+        return;
+    }
+
+    // The fade-in gain skips both ends, so neither block is played alone.
+    uint32_t inc = (DSP_GAIN_UNITY_Q15 << GAIN_RAMP_FRAC_SHIFT) /
+                   (frame_cnt + 1U);
+
+    uint32_t acc = inc;
+
+    for (uint32_t frame = 0U; frame < frame_cnt; frame++)
+    {
+        uint32_t gain_in = acc >> GAIN_RAMP_FRAC_SHIFT;
+
+        uint32_t gain_out = DSP_GAIN_UNITY_Q15 - gain_in;
+
+        for (uint32_t ch = 0U; ch < ch_cnt; ch++)
+        {
+            // The gains sum to unity, so the sum never leaves the range.
+            *p_out = dsp_gain_s32_mul(*p_out, gain_out) +
+                     dsp_gain_s32_mul(*p_in, gain_in);
+
+            p_out++;
+            p_in++;
+        }
+
+        acc += inc;
+    }
+}
+
+void dsp_gain_s32_mix(int32_t *p_out, const int32_t *p_in, uint32_t cnt)
+{
+    if ((NULL == p_out) || (NULL == p_in))
+    {
+        return;
+    }
+
+    for (uint32_t idx = 0U; idx < cnt; idx++)
+    {
+        int64_t sum = (int64_t)p_out[idx] + (int64_t)p_in[idx];
+
+        if (INT32_MAX < sum)
+        {
+            sum = INT32_MAX;
+        }
+        else if (INT32_MIN > sum)
+        {
+            sum = INT32_MIN;
+        }
+        else
+        {
+            // Placeholder
+        }
+
+        p_out[idx] = (int32_t)sum;
+    }
+}
+
+void dsp_gain_s16_apply(int16_t *p_samples, uint32_t cnt, uint32_t gain_q15)
+{
+    if ((NULL == p_samples) || (DSP_GAIN_UNITY_Q15 == gain_q15))
+    {
+        return;
+    }
+
+    if (DSP_GAIN_MAX_Q15 < gain_q15)
+    {
+        gain_q15 = DSP_GAIN_MAX_Q15;
+    }
+
+    for (uint32_t idx = 0U; idx < cnt; idx++)
+    {
+        // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed product is intended.
+        int32_t val = ((int32_t)p_samples[idx] * (int32_t)gain_q15) >>
+                      DSP_GAIN_Q15_SHIFT;
+        // PRQA S 3101, 4532 --
+
+        if (INT16_MAX < val)
+        {
+            val = INT16_MAX;
+        }
+        else if (INT16_MIN > val)
+        {
+            val = INT16_MIN;
+        }
+        else
+        {
+            // Placeholder
+        }
+
+        p_samples[idx] = (int16_t)val;
+    }
+}
+
+// end of file
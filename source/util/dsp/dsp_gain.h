@@ -0,0 +1,145 @@
+/**
+ * @file dsp_gain.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Fixed-point gain stage for the PCM audio samples.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The gain is carried as an unsigned Q15 value (32768 is unity) so the stage
+ * runs on whole 16/32-bit samples with integer arithmetic only. The target
+ * (Cortex-M0+) has no FPU and no long multiply, therefore the 32-bit kernel
+ * splits each sample into 16-bit halves and uses two 32x32->32 multiplies.
+ *
+ */
+
+#ifndef DSP_GAIN_H
+#define DSP_GAIN_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the fractional bit count of the Q15 gain.
+ *
+ */
+#define DSP_GAIN_Q15_SHIFT (15U)
+
+/**
+ * @brief This macro indicates the unity gain (0 dB) in Q15 format.
+ *
+ */
+#define DSP_GAIN_UNITY_Q15 (32768U)
+
+/**
+ * @brief This macro indicates the highest gain (about +6 dB) accepted by the
+ *        kernels. Higher gains are clamped to this value.
+ *
+ */
+#define DSP_GAIN_MAX_Q15 (65535U)
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function converts a rational gain (num / den) to Q15 format.
+ *
+ * @param[in] num Numerator of the gain, e.g. the calibration table gain.
+ * @param[in] den Denominator of the gain, e.g. the calibration rate (1000).
+ *
+ * @return uint32_t Gain in Q15 format, clamped to DSP_GAIN_MAX_Q15. Zero is
+ *                  returned when the denominator is zero.
+ *
+ */
+uint32_t dsp_gain_q15_get(uint32_t num, uint32_t den);
+
+/**
+ * @brief This function applies the Q15 gain to the 32-bit PCM samples in
+ *        place. The result is saturated to the int32_t range.
+ *
+ * @param[in,out] p_samples Interleaved 32-bit samples.
+ * @param[in]     cnt       Sample count (frame count x channel count).
+ * @param[in]     gain_q15  Gain in Q15 format.
+ *
+ */
+void dsp_gain_s32_apply(int32_t *p_samples, uint32_t cnt, uint32_t gain_q15);
+
+/**
+ * @brief This function applies the Q15 gain to the 16-bit PCM samples in
+ *        place. The result is saturated to the int16_t range.
+ *
+ * @param[in,out] p_samples Interleaved 16-bit samples.
+ * @param[in]     cnt       Sample count (frame count x channel count).
+ * @param[in]     gain_q15  Gain in Q15 format.
+ *
+ */
+void dsp_gain_s16_apply(int16_t *p_samples, uint32_t cnt, uint32_t gain_q15);
+
+/**
+ * @brief This function ramps the Q15 gain linearly across the interleaved
+ *        32-bit frames in place. The gain is stepped once per frame, so all
+ *        the channels of a frame get the same gain. The last frame gets the
+ *        gain just below gain_end, the next block is expected to start there.
+ *
+ * @param[in,out] p_samples  Interleaved 32-bit samples.
+ * @param[in]     frame_cnt  Frame count.
+ * @param[in]     ch_cnt     Channel count of a frame.
+ * @param[in]     gain_start Gain of the first frame in Q15 format.
+ * @param[in]     gain_end   Gain reached after the last frame in Q15 format.
+ *
+ */
+void dsp_gain_s32_ramp(int32_t *p_samples,
+                       uint32_t frame_cnt,
+                       uint32_t ch_cnt,
+                       uint32_t gain_start,
+                       uint32_t gain_end);
+
+/**
+ * @brief This function crossfades two blocks of interleaved 32-bit frames with
+ *        complementary linear gains. The output block fades out while the
+ *        input block fades in, so the last frame is almost the input frame.
+ *
+ * @param[in,out] p_out     Block to fade out, it receives the result.
+ * @param[in]     p_in      Block to fade in.
+ * @param[in]     frame_cnt Frame count of both blocks.
+ * @param[in]     ch_cnt    Channel count of a frame.
+ *
+ */
+void dsp_gain_s32_xfade(int32_t *p_out,
+                        const int32_t *p_in,
+                        uint32_t frame_cnt,
+                        uint32_t ch_cnt);
+
+/**
+ * @brief This function adds one block of 32-bit samples to another with
+ *        saturation, so the sum of the mixed sounds clips instead of wrapping
+ *        around.
+ *
+ * @param[in,out] p_out Samples to add to, they receive the sum.
+ * @param[in]     p_in  Samples to add.
+ * @param[in]     cnt   Sample count (frame count x channel count).
+ *
+ */
+void dsp_gain_s32_mix(int32_t *p_out, const int32_t *p_in, uint32_t cnt);
+
+/**
+ * @brief This function multiplies one 32-bit sample with the Q15 gain and
+ *        saturates the result.
+ *
+ * @param[in] sample   32-bit PCM sample.
+ * @param[in] gain_q15 Gain in Q15 format, lower than or equal to
+ *                     DSP_GAIN_MAX_Q15.
+ *
+ * @return int32_t Scaled sample.
+ *
+ */
+int32_t dsp_gain_s32_mul(int32_t sample, uint32_t gain_q15);
+
+#endif /* DSP_GAIN_H */
+
+// end of file
@@ -0,0 +1,219 @@
+/**
+ * @file dsp_limiter.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the look-ahead limiter.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "dsp_limiter.h"
+
+#include "dsp_gain.h"
+
+#include <string.h>
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the mask of the delay line position.
+ *
+ */
+#define LIMITER_POS_MASK (DSP_LIMITER_DELAY_CNT - 1U)
+
+/**
+ * @brief This macro indicates the shift of a Q15 threshold to the sample
+ *        scale.
+ *
+ */
+#define LIMITER_THR_SHIFT (16U)
+
+/**
+ * @brief This macro indicates the margin below the peak, as a shift, of the
+ *        samples holding the peak (about 1 dB). The release can then never
+ *        lift such a sample over the threshold while it is in the line.
+ *
+ */
+#define LIMITER_HOLD_SHIFT (3U)
+
+/*******************************************************************************
+ * Private Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief This function updates the gain target once a sample enters the delay
+ *        line.
+ *
+ * @param[in,out] p_limiter Limiter state.
+ * @param[in]     level     Absolute value of the sample.
+ *
+ */
+static void limiter_detect(dsp_limiter_t *p_limiter, uint32_t level);
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void dsp_limiter_init(dsp_limiter_t *p_limiter)
+{
+    if (NULL == p_limiter)
+    {
+        return;
+    }
+
+    (void)memset(p_limiter, 0, sizeof(dsp_limiter_t));
+
+    p_limiter->thr = (uint32_t)INT32_MAX;
+    p_limiter->gain = DSP_GAIN_UNITY_Q15;
+    p_limiter->target = DSP_GAIN_UNITY_Q15;
+}
+
+bool dsp_limiter_thr_set(dsp_limiter_t *p_limiter, uint32_t thr_q15)
+{
+    if ((NULL == p_limiter) || (0U == thr_q15) ||
+        (DSP_LIMITER_THR_UNITY < thr_q15))
+    {
+        return false;
+    }
+
+    uint32_t thr = (uint32_t)INT32_MAX;
+
+    if (DSP_LIMITER_THR_UNITY != thr_q15)
+    {
+        thr = thr_q15 << LIMITER_THR_SHIFT;
+    }
+
+    // The peaks in the delay line are detected again against the new
+    // threshold, the clamp covers the ones about to leave.
+    p_limiter->thr = thr;
+    p_limiter->env = 0U;
+    p_limiter->hold = 0U;
+
+    p_limiter->enable = true;
+
+    return true;
+}
+
+int32_t dsp_limiter_run(dsp_limiter_t *p_limiter, int32_t sample)
+{
+    if (false == p_limiter->enable)
+    {
+        return sample;
+    }
+
+    uint32_t level = (uint32_t)sample;
+
+    if (0 > sample)
+    {
+        level = 0U - level;
+    }
+
+    limiter_detect(p_limiter, level);
+
+    // The gain ramps down to the target, it follows the target up.
+    if ((p_limiter->gain > p_limiter->target) &&
+        ((p_limiter->gain - p_limiter->target) > p_limiter->step))
+    {
+        p_limiter->gain -= p_limiter->step;
+    }
+    else
+    {
+        p_limiter->gain = p_limiter->target;
+
+        p_limiter->step = 0U;
+    }
+
+    uint32_t pos = p_limiter->pos;
+
+    int32_t out = p_limiter->delay[pos];
+
+    p_limiter->delay[pos] = sample;
+
+    p_limiter->pos = (pos + 1U) & LIMITER_POS_MASK;
+
+    out = dsp_gain_s32_mul(out, p_limiter->gain);
+
+    int32_t thr = (int32_t)p_limiter->thr;
+
+    if (thr < out)
+    {
+        out = thr;
+    }
+    else if (-thr > out)
+    {
+        out = -thr;
+    }
+    else
+    {
+        // Placeholder
+    }
+
+    return out;
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void limiter_detect(dsp_limiter_t *p_limiter, uint32_t level)
+{
+    if (level > p_limiter->env)
+    {
+        p_limiter->env = level;
+        p_limiter->hold = DSP_LIMITER_DELAY_CNT;
+
+        if (level <= p_limiter->thr)
+        {
+            return;
+        }
+
+        // The level is over the threshold, so the quotient is below unity.
+        // The divisor is rounded up to keep the gain on the safe side.
+        uint32_t target = p_limiter->thr /
+                          ((level >> DSP_GAIN_Q15_SHIFT) + 1U);
+
+        if (target < p_limiter->target)
+        {
+            p_limiter->target = target;
+
+            // The ramp ends when the peak leaves the delay line. A faster
+            // ramp of an earlier peak is kept.
+            uint32_t step = ((p_limiter->gain - target) >>
+                             DSP_LIMITER_DELAY_SHIFT) + 1U;
+
+            if (step > p_limiter->step)
+            {
+                p_limiter->step = step;
+            }
+        }
+    }
+    else if (level > (p_limiter->env - (p_limiter->env >> LIMITER_HOLD_SHIFT)))
+    {
+        p_limiter->hold = DSP_LIMITER_DELAY_CNT;
+    }
+    else if (0U != p_limiter->hold)
+    {
+        p_limiter->hold--;
+    }
+    else
+    {
+        p_limiter->env -= p_limiter->env >> DSP_LIMITER_RELEASE_SHIFT;
+
+        if (DSP_GAIN_UNITY_Q15 > p_limiter->target)
+        {
+            p_limiter->target +=
+                (p_limiter->target >> DSP_LIMITER_RELEASE_SHIFT) + 1U;
+        }
+
+        if (DSP_GAIN_UNITY_Q15 < p_limiter->target)
+        {
+            p_limiter->target = DSP_GAIN_UNITY_Q15;
+        }
+    }
+}
+
+// end of file
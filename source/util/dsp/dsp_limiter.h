@@ -0,0 +1,125 @@
+/**
+ * @file dsp_limiter.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Fixed-point look-ahead peak limiter of a speaker chain.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The samples pass a short delay line. A peak over the threshold is seen when
+ * it enters the line, and the gain ramps down linearly so it reaches the gain
+ * of the peak when the peak leaves the line. The peak is held for the length
+ * of the line, then the gain is released slowly. A division is only needed
+ * when a new peak is found, the rest is shifts and multiplies. The output is
+ * clamped to the threshold, so a peak never passes it.
+ *
+ */
+
+#ifndef DSP_LIMITER_H
+#define DSP_LIMITER_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the bit count of the delay line length.
+ *
+ */
+#define DSP_LIMITER_DELAY_SHIFT (5U)
+
+/**
+ * @brief This macro indicates the look-ahead of the limiter in samples, 2 ms
+ *        at 16 kHz.
+ *
+ */
+#define DSP_LIMITER_DELAY_CNT (1U << DSP_LIMITER_DELAY_SHIFT)
+
+/**
+ * @brief This macro indicates the release time constant of the limiter as a
+ *        shift, 1024 samples (64 ms) at 16 kHz.
+ *
+ */
+#define DSP_LIMITER_RELEASE_SHIFT (10U)
+
+/**
+ * @brief This macro indicates the threshold of the full scale in Q15 format.
+ *
+ */
+#define DSP_LIMITER_THR_UNITY (32768U)
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to the limiter state.
+ *
+ */
+typedef struct dsp_limiter_s
+{
+    int32_t delay[DSP_LIMITER_DELAY_CNT];
+
+    uint32_t pos;
+
+    uint32_t thr;
+    uint32_t env;
+    uint32_t hold;
+
+    uint32_t gain;
+    uint32_t target;
+    uint32_t step;
+
+    bool enable;
+
+} dsp_limiter_t;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function resets the limiter. It is off and passes the samples
+ *        unchanged until a threshold is set.
+ *
+ * @param[out] p_limiter Limiter state.
+ *
+ */
+void dsp_limiter_init(dsp_limiter_t *p_limiter);
+
+/**
+ * @brief This function sets the threshold and turns the limiter on. The delay
+ *        line and the gain are kept, so the threshold can be changed while
+ *        the limiter runs.
+ *
+ * @param[in,out] p_limiter Limiter state.
+ * @param[in]     thr_q15   Threshold relative to the full scale in Q15
+ *                          format, from 1 to DSP_LIMITER_THR_UNITY.
+ *
+ * @return bool Set status.
+ *
+ * @retval true  The threshold has been set.
+ * @retval false The threshold or the pointer is invalid.
+ *
+ */
+bool dsp_limiter_thr_set(dsp_limiter_t *p_limiter, uint32_t thr_q15);
+
+/**
+ * @brief This function passes one 32-bit sample through the limiter. The
+ *        returned sample is DSP_LIMITER_DELAY_CNT samples late when the
+ *        limiter is on.
+ *
+ * @param[in,out] p_limiter Limiter state.
+ * @param[in]     sample    32-bit PCM sample.
+ *
+ * @return int32_t Limited sample.
+ *
+ */
+int32_t dsp_limiter_run(dsp_limiter_t *p_limiter, int32_t sample);
+
+#endif /* DSP_LIMITER_H */
+
+// end of file
@@ -0,0 +1,300 @@
+/**
+ * @file dsp_osc.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the wavetable oscillators.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "dsp_osc.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the shift from the phase to the table index.
+ *
+ */
+#define OSC_INDEX_SHIFT (24U)
+
+/**
+ * @brief This macro indicates the shift from the phase to the interpolation
+ *        fraction.
+ *
+ */
+#define OSC_FRAC_SHIFT (10U)
+
+/**
+ * @brief This macro indicates the fractional bit count of the interpolation.
+ *        The difference of two entries (17 bits) times the fraction fits in
+ *        32 bits.
+ *
+ */
+#define OSC_FRAC_BITS (14U)
+
+/**
+ * @brief This macro indicates the mask of the interpolation fraction.
+ *
+ */
+#define OSC_FRAC_MASK ((1UL << OSC_FRAC_BITS) - 1U)
+
+/**
+ * @brief This macro indicates the mask of the table index.
+ *
+ */
+#define OSC_INDEX_MASK (DSP_OSC_TABLE_SIZE - 1U)
+
+/**
+ * @brief This macro indicates the fractional bit count of the level.
+ *
+ */
+#define OSC_LEVEL_SHIFT (15U)
+
+/**
+ * @brief This macro indicates the unity level.
+ *
+ */
+#define OSC_LEVEL_UNITY (1UL << OSC_LEVEL_SHIFT)
+
+/**
+ * @brief This macro indicates the shift from the 16-bit sum to the upper half
+ *        of a 32-bit sample.
+ *
+ */
+#define OSC_PCM_SHIFT (16U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/**
+ * @brief Single-cycle wavetables normalized to the full 16-bit range.
+ *
+ */
+static const int16_t m_osc_table[DSP_OSC_WAVE_CNT][DSP_OSC_TABLE_SIZE] = {
+    // Sine
+    {
+        0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179,
+        7962, 8739, 9512, 10278, 11039, 11793, 12539, 13279, 14010, 14732,
+        15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159, 20787, 21403,
+        22005, 22594, 23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+        27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956, 30273, 30571,
+        30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521,
+        32609, 32678, 32728, 32757, 32767, 32757, 32728, 32678, 32609, 32521,
+        32412, 32285, 32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+        30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683, 27245, 26790,
+        26319, 25832, 25329, 24811, 24279, 23731, 23170, 22594, 22005, 21403,
+        20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151, 15446, 14732,
+        14010, 13279, 12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179,
+        6393, 5602, 4808, 4011, 3212, 2410, 1608, 804, 0, -804,
+        -1608, -2410, -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739,
+        -9512, -10278, -11039, -11793, -12539, -13279, -14010, -14732, -15446, -16151,
+        -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+        -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683,
+        -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113,
+        -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678,
+        -32728, -32757, -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+        -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571, -30273, -29956,
+        -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832,
+        -25329, -24811, -24279, -23731, -23170, -22594, -22005, -21403, -20787, -20159,
+        -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+        -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602,
+        -4808, -4011, -3212, -2410, -1608, -804
+    },
+    // Triangle, odd harmonics up to the 11th
+    {
+        0, 502, 1007, 1516, 2032, 2555, 3087, 3626, 4173, 4726,
+        5283, 5842, 6400, 6954, 7503, 8045, 8578, 9102, 9618, 10126,
+        10629, 11128, 11625, 12125, 12630, 13141, 13661, 14191, 14732, 15283,
+        15841, 16406, 16975, 17543, 18108, 18666, 19214, 19750, 20273, 20783,
+        21279, 21766, 22245, 22721, 23199, 23683, 24179, 24692, 25223, 25776,
+        26351, 26946, 27558, 28180, 28806, 29424, 30025, 30596, 31124, 31596,
+        32002, 32329, 32570, 32717, 32767, 32717, 32570, 32329, 32002, 31596,
+        31124, 30596, 30025, 29424, 28806, 28180, 27558, 26946, 26351, 25776,
+        25223, 24692, 24179, 23683, 23199, 22721, 22245, 21766, 21279, 20783,
+        20273, 19750, 19214, 18666, 18108, 17543, 16975, 16406, 15841, 15283,
+        14732, 14191, 13661, 13141, 12630, 12125, 11625, 11128, 10629, 10126,
+        9618, 9102, 8578, 8045, 7503, 6954, 6400, 5842, 5283, 4726,
+        4173, 3626, 3087, 2555, 2032, 1516, 1007, 502, 0, -502,
+        -1007, -1516, -2032, -2555, -3087, -3626, -4173, -4726, -5283, -5842,
+        -6400, -6954, -7503, -8045, -8578, -9102, -9618, -10126, -10629, -11128,
+        -11625, -12125, -12630, -13141, -13661, -14191, -14732, -15283, -15841, -16406,
+        -16975, -17543, -18108, -18666, -19214, -19750, -20273, -20783, -21279, -21766,
+        -22245, -22721, -23199, -23683, -24179, -24692, -25223, -25776, -26351, -26946,
+        -27558, -28180, -28806, -29424, -30025, -30596, -31124, -31596, -32002, -32329,
+        -32570, -32717, -32767, -32717, -32570, -32329, -32002, -31596, -31124, -30596,
+        -30025, -29424, -28806, -28180, -27558, -26946, -26351, -25776, -25223, -24692,
+        -24179, -23683, -23199, -22721, -22245, -21766, -21279, -20783, -20273, -19750,
+        -19214, -18666, -18108, -17543, -16975, -16406, -15841, -15283, -14732, -14191,
+        -13661, -13141, -12630, -12125, -11625, -11128, -10629, -10126, -9618, -9102,
+        -8578, -8045, -7503, -6954, -6400, -5842, -5283, -4726, -4173, -3626,
+        -3087, -2555, -2032, -1516, -1007, -502
+    },
+    // Sawtooth, harmonics up to the 12th
+    {
+        0, 4, 29, 94, 216, 405, 665, 993, 1380, 1813,
+        2273, 2738, 3188, 3601, 3960, 4254, 4476, 4628, 4716, 4753,
+        4758, 4751, 4755, 4792, 4879, 5032, 5257, 5556, 5924, 6348,
+        6811, 7292, 7767, 8215, 8613, 8947, 9206, 9387, 9494, 9537,
+        9533, 9505, 9476, 9470, 9512, 9618, 9802, 10070, 10420, 10842,
+        11319, 11829, 12348, 12847, 13302, 13691, 13998, 14214, 14338, 14380,
+        14355, 14286, 14201, 14129, 14099, 14137, 14263, 14489, 14819, 15246,
+        15755, 16322, 16916, 17505, 18054, 18533, 18915, 19184, 19331, 19361,
+        19289, 19140, 18947, 18750, 18588, 18500, 18522, 18676, 18977, 19425,
+        20007, 20695, 21452, 22230, 22979, 23648, 24190, 24568, 24757, 24750,
+        24556, 24204, 23739, 23220, 22714, 22296, 22036, 21996, 22224, 22747,
+        23568, 24663, 25979, 27436, 28931, 30345, 31545, 32395, 32767, 32546,
+        31639, 29986, 27558, 24368, 20467, 15944, 10922, 5551, 0, -5551,
+        -10922, -15944, -20467, -24368, -27558, -29986, -31639, -32546, -32767, -32395,
+        -31545, -30345, -28931, -27436, -25979, -24663, -23568, -22747, -22224, -21996,
+        -22036, -22296, -22714, -23220, -23739, -24204, -24556, -24750, -24757, -24568,
+        -24190, -23648, -22979, -22230, -21452, -20695, -20007, -19425, -18977, -18676,
+        -18522, -18500, -18588, -18750, -18947, -19140, -19289, -19361, -19331, -19184,
+        -18915, -18533, -18054, -17505, -16916, -16322, -15755, -15246, -14819, -14489,
+        -14263, -14137, -14099, -14129, -14201, -14286, -14355, -14380, -14338, -14214,
+        -13998, -13691, -13302, -12847, -12348, -11829, -11319, -10842, -10420, -10070,
+        -9802, -9618, -9512, -9470, -9476, -9505, -9533, -9537, -9494, -9387,
+        -9206, -8947, -8613, -8215, -7767, -7292, -6811, -6348, -5924, -5556,
+        -5257, -5032, -4879, -4792, -4755, -4751, -4758, -4753, -4716, -4628,
+        -4476, -4254, -3960, -3601, -3188, -2738, -2273, -1813, -1380, -993,
+        -665, -405, -216, -94, -29, -4
+    },
+    // Square, odd harmonics up to the 11th
+    {
+        0, 5180, 10213, 14958, 19290, 23104, 26321, 28891, 30795, 32045,
+        32680, 32767, 32393, 31659, 30676, 29555, 28403, 27318, 26379, 25648,
+        25164, 24945, 24987, 25263, 25735, 26348, 27043, 27756, 28427, 29003,
+        29442, 29713, 29805, 29716, 29464, 29077, 28593, 28056, 27513, 27011,
+        26590, 26283, 26112, 26087, 26207, 26457, 26813, 27243, 27708, 28168,
+        28585, 28924, 29157, 29266, 29245, 29095, 28832, 28479, 28067, 27631,
+        27209, 26837, 26546, 26361, 26298, 26361, 26546, 26837, 27209, 27631,
+        28067, 28479, 28832, 29095, 29245, 29266, 29157, 28924, 28585, 28168,
+        27708, 27243, 26813, 26457, 26207, 26087, 26112, 26283, 26590, 27011,
+        27513, 28056, 28593, 29077, 29464, 29716, 29805, 29713, 29442, 29003,
+        28427, 27756, 27043, 26348, 25735, 25263, 24987, 24945, 25164, 25648,
+        26379, 27318, 28403, 29555, 30676, 31659, 32393, 32767, 32680, 32045,
+        30795, 28891, 26321, 23104, 19290, 14958, 10213, 5180, 0, -5180,
+        -10213, -14958, -19290, -23104, -26321, -28891, -30795, -32045, -32680, -32767,
+        -32393, -31659, -30676, -29555, -28403, -27318, -26379, -25648, -25164, -24945,
+        -24987, -25263, -25735, -26348, -27043, -27756, -28427, -29003, -29442, -29713,
+        -29805, -29716, -29464, -29077, -28593, -28056, -27513, -27011, -26590, -26283,
+        -26112, -26087, -26207, -26457, -26813, -27243, -27708, -28168, -28585, -28924,
+        -29157, -29266, -29245, -29095, -28832, -28479, -28067, -27631, -27209, -26837,
+        -26546, -26361, -26298, -26361, -26546, -26837, -27209, -27631, -28067, -28479,
+        -28832, -29095, -29245, -29266, -29157, -28924, -28585, -28168, -27708, -27243,
+        -26813, -26457, -26207, -26087, -26112, -26283, -26590, -27011, -27513, -28056,
+        -28593, -29077, -29464, -29716, -29805, -29713, -29442, -29003, -28427, -27756,
+        -27043, -26348, -25735, -25263, -24987, -24945, -25164, -25648, -26379, -27318,
+        -28403, -29555, -30676, -31659, -32393, -32767, -32680, -32045, -30795, -28891,
+        -26321, -23104, -19290, -14958, -10213, -5180
+    }
+};
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+bool dsp_osc_init(dsp_osc_t *p_osc,
+                  dsp_osc_wave_t wave,
+                  uint32_t freq,
+                  uint32_t sample_rate,
+                  uint32_t level_q15)
+{
+    if (NULL == p_osc)
+    {
+        return false;
+    }
+
+    p_osc->p_table = m_osc_table[DSP_OSC_WAVE_SINE];
+    p_osc->phase = 0U;
+    p_osc->inc = 0U;
+    p_osc->level = 0U;
+
+    if (DSP_OSC_WAVE_CNT <= wave)
+    {
+        return false;
+    }
+
+    if ((0U == sample_rate) || ((sample_rate / 2U) <= freq))
+    {
+        return false;
+    }
+
+    if (OSC_LEVEL_UNITY < level_q15)
+    {
+        return false;
+    }
+
+    p_osc->p_table = m_osc_table[wave];
+
+    // The division runs once per set up, not per frame.
+    p_osc->inc = (uint32_t)(((uint64_t)freq << 32U) / sample_rate);
+
+    p_osc->level = level_q15;
+
+    return true;
+}
+
+void dsp_osc_render(dsp_osc_t *p_osc,
+                    uint32_t osc_cnt,
+                    int32_t *p_out,
+                    uint32_t frame_cnt)
+{
+    if ((NULL == p_osc) || (NULL == p_out))
+    {
+        return;
+    }
+
+    for (uint32_t frame = 0U; frame < frame_cnt; frame++)
+    {
+        int32_t sum = 0;
+
+        for (uint32_t idx = 0U; idx < osc_cnt; idx++)
+        {
+            dsp_osc_t *p_cur = &p_osc[idx];
+
+            uint32_t phase = p_cur->phase;
+
+            uint32_t pos = phase >> OSC_INDEX_SHIFT;
+
+            int32_t frac = (int32_t)((phase >> OSC_FRAC_SHIFT) & OSC_FRAC_MASK);
+
+            int32_t a = p_cur->p_table[pos];
+            int32_t b = p_cur->p_table[(pos + 1U) & OSC_INDEX_MASK];
+
+            // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed products is intended.
+            int32_t sample = a + (((b - a) * frac) >> OSC_FRAC_BITS);
+
+            sum += (sample * (int32_t)p_cur->level) >> OSC_LEVEL_SHIFT;
+            // PRQA S 3101, 4532 --
+
+            p_cur->phase = phase + p_cur->inc;
+        }
+
+        if (INT16_MAX < sum)
+        {
+            sum = INT16_MAX;
+        }
+        else if (INT16_MIN > sum)
+        {
+            sum = INT16_MIN;
+        }
+        else
+        {
+            // Placeholder
+        }
+
+        int32_t out = (int32_t)((uint32_t)sum << OSC_PCM_SHIFT);
+
+        p_out[0U] = out;
+        p_out[1U] = out;
+
+        p_out = &p_out[DSP_OSC_CH_CNT];
+    }
+}
+
+// end of file
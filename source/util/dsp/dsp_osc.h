@@ -0,0 +1,118 @@
+/**
+ * @file dsp_osc.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Wavetable oscillators for the synthesized AVAS sounds.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Each oscillator reads a single-cycle wavetable with a 32-bit phase
+ * accumulator and interpolates linearly between the table entries. The
+ * wavetables are constant, so they stay in the internal flash. The cost per
+ * frame only depends on the oscillator count.
+ *
+ */
+
+#ifndef DSP_OSC_H
+#define DSP_OSC_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the entry count of a wavetable.
+ *
+ */
+#define DSP_OSC_TABLE_SIZE (256U)
+
+/**
+ * @brief This macro indicates the channel count of a rendered frame.
+ *
+ */
+#define DSP_OSC_CH_CNT (2U)
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+
+/**
+ * @brief List of the wavetables. The harmonics are limited, so a tone up to
+ *        a few hundred Hz does not alias after the pitch shift.
+ *
+ */
+typedef enum dsp_osc_wave_e
+{
+    DSP_OSC_WAVE_SINE = 0U,
+    DSP_OSC_WAVE_TRIANGLE = 1U,
+    DSP_OSC_WAVE_SAW = 2U,
+    DSP_OSC_WAVE_SQUARE = 3U,
+    DSP_OSC_WAVE_CNT = 4U,
+
+} dsp_osc_wave_t;
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to the oscillator state.
+ *
+ */
+typedef struct dsp_osc_s
+{
+    const int16_t *p_table;
+
+    uint32_t phase;
+    uint32_t inc;
+    uint32_t level;
+
+} dsp_osc_t;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function sets up the oscillator and resets its phase.
+ *
+ * @param[out] p_osc       Oscillator state.
+ * @param[in]  wave        Wavetable.
+ * @param[in]  freq        Frequency in Hz, below the half of the sample rate.
+ * @param[in]  sample_rate Sample rate in Hz.
+ * @param[in]  level_q15   Level in Q15 format, up to unity.
+ *
+ * @return bool Init status.
+ *
+ * @retval true  The oscillator has been set up.
+ * @retval false An argument is invalid, the oscillator is silent.
+ *
+ */
+bool dsp_osc_init(dsp_osc_t *p_osc,
+                  dsp_osc_wave_t wave,
+                  uint32_t freq,
+                  uint32_t sample_rate,
+                  uint32_t level_q15);
+
+/**
+ * @brief This function renders the sum of the oscillators to 32-bit stereo
+ *        frames with the same sample on both channels. The sum is saturated
+ *        to the 16-bit range before it is moved to the upper half.
+ *
+ * @param[in,out] p_osc     Oscillator states.
+ * @param[in]     osc_cnt   Oscillator count.
+ * @param[out]    p_out     32-bit interleaved stereo frames.
+ * @param[in]     frame_cnt Frame count.
+ *
+ */
+void dsp_osc_render(dsp_osc_t *p_osc,
+                    uint32_t osc_cnt,
+                    int32_t *p_out,
+                    uint32_t frame_cnt);
+
+#endif /* DSP_OSC_H */
+
+// end of file
@@ -0,0 +1,142 @@
+/**
+ * @file dsp_pcm.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the PCM storage expansion.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "dsp_pcm.h"
+
+#include <string.h>
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the shift from a 16-bit sample to the upper
+ *        half of a 32-bit sample.
+ *
+ */
+#define PCM_S16_SHIFT (16U)
+
+/*******************************************************************************
+ * Private Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief This function widens a 16-bit sample to a 32-bit sample.
+ *
+ * @param[in] sample 16-bit sample.
+ *
+ * @return int32_t 32-bit sample.
+ *
+ */
+static inline int32_t s16_widen(int16_t sample);
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+uint32_t dsp_pcm_frame_size_get(uint32_t bit_depth, uint32_t ch_cnt)
+{
+    if ((16U != bit_depth) && (32U != bit_depth))
+    {
+        return 0U;
+    }
+
+    if ((1U != ch_cnt) && (2U != ch_cnt))
+    {
+        return 0U;
+    }
+
+    return (bit_depth / 8U) * ch_cnt;
+}
+
+bool dsp_pcm_expand(int32_t *p_out,
+                    const void *p_in,
+                    uint32_t frame_cnt,
+                    uint32_t bit_depth,
+                    uint32_t ch_cnt)
+{
+    if ((NULL == p_out) || (NULL == p_in))
+    {
+        return false;
+    }
+
+    if (0U == dsp_pcm_frame_size_get(bit_depth, ch_cnt))
+    {
+        return false;
+    }
+
+    // Every loop reads a stored frame before its output frame is written.
+    if (16U == bit_depth)
+    {
+        const int16_t *p_s16 = (const int16_t *)p_in;
+
+        if (1U == ch_cnt)
+        {
+            for (uint32_t frame = 0U; frame < frame_cnt; frame++)
+            {
+                int32_t sample = s16_widen(p_s16[frame]);
+
+                p_out[0U] = sample;
+                p_out[1U] = sample;
+
+                p_out = &p_out[DSP_PCM_CH_CNT];
+            }
+        }
+        else
+        {
+            for (uint32_t frame = 0U; frame < frame_cnt; frame++)
+            {
+                int32_t left = s16_widen(p_s16[0U]);
+                int32_t right = s16_widen(p_s16[1U]);
+
+                p_out[0U] = left;
+                p_out[1U] = right;
+
+                p_s16 = &p_s16[DSP_PCM_CH_CNT];
+                p_out = &p_out[DSP_PCM_CH_CNT];
+            }
+        }
+    }
+    else if (1U == ch_cnt)
+    {
+        const int32_t *p_s32 = (const int32_t *)p_in;
+
+        for (uint32_t frame = 0U; frame < frame_cnt; frame++)
+        {
+            int32_t sample = p_s32[frame];
+
+            p_out[0U] = sample;
+            p_out[1U] = sample;
+
+            p_out = &p_out[DSP_PCM_CH_CNT];
+        }
+    }
+    else
+    {
+        // The stored format is the I2S format already.
+        (void)memmove(p_out, p_in, frame_cnt * sizeof(int32_t) * DSP_PCM_CH_CNT);
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline int32_t s16_widen(int16_t sample)
+{
+    // PRQA S 3101, 4532 ++ # Shift of the signed 16-bit sample is intended.
+    return (int32_t)((uint32_t)(int32_t)sample << PCM_S16_SHIFT);
+    // PRQA S 3101, 4532 --
+}
+
+// end of file
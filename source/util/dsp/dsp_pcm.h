@@ -0,0 +1,81 @@
+/**
+ * @file dsp_pcm.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Expansion of the compact PCM storage formats to 32-bit stereo.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The audio slots may store 16-bit samples and a single channel. The samples
+ * are widened to the upper half of a 32-bit sample and a mono sample is
+ * duplicated to both channels of the I2S frame.
+ *
+ */
+
+#ifndef DSP_PCM_H
+#define DSP_PCM_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the channel count of an expanded frame.
+ *
+ */
+#define DSP_PCM_CH_CNT (2U)
+
+/**
+ * @brief This macro indicates the bit depth of an expanded sample.
+ *
+ */
+#define DSP_PCM_BIT_DEPTH (32U)
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function returns the stored frame size of a storage format.
+ *
+ * @param[in] bit_depth Stored bit depth, 16 or 32.
+ * @param[in] ch_cnt    Stored channel count, 1 or 2.
+ *
+ * @return uint32_t Stored frame size in bytes, zero for an unsupported
+ *                  format.
+ *
+ */
+uint32_t dsp_pcm_frame_size_get(uint32_t bit_depth, uint32_t ch_cnt);
+
+/**
+ * @brief This function expands the stored frames to 32-bit stereo frames.
+ *
+ * The expansion runs in place when the stored frames are placed at the end of
+ * the output buffer, since an output frame never reaches a stored frame that
+ * has not been read yet.
+ *
+ * @param[out] p_out     32-bit interleaved stereo frames.
+ * @param[in]  p_in      Stored frames.
+ * @param[in]  frame_cnt Frame count.
+ * @param[in]  bit_depth Stored bit depth, 16 or 32.
+ * @param[in]  ch_cnt    Stored channel count, 1 or 2.
+ *
+ * @return bool Expansion status.
+ *
+ * @retval true  The frames have been expanded.
+ * @retval false The storage format is not supported or an argument is
+ *               invalid.
+ *
+ */
+bool dsp_pcm_expand(int32_t *p_out,
+                    const void *p_in,
+                    uint32_t frame_cnt,
+                    uint32_t bit_depth,
+                    uint32_t ch_cnt);
+
+#endif /* DSP_PCM_H */
+
+// end of file
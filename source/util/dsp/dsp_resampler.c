@@ -0,0 +1,568 @@
+/**
+ * @file dsp_resampler.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the streaming resampler.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "dsp_resampler.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the phase of a reset resampler. The first output
+ *        frame is taken at the second history frame, so the cubic kernel
+ *        always finds its preceding frame.
+ *
+ */
+#define RS_PHASE_INIT (DSP_RESAMPLER_STEP_UNITY)
+
+/**
+ * @brief This macro indicates the mask of the fractional part of the phase.
+ *
+ */
+#define RS_FRAC_MASK (DSP_RESAMPLER_STEP_UNITY - 1U)
+
+/**
+ * @brief This macro indicates the number of the polyphase table rows.
+ *
+ */
+#define RS_POLY_PHASE_CNT (64U)
+
+/**
+ * @brief This macro indicates the shift from the Q16 fraction to the
+ *        polyphase table row.
+ *
+ */
+#define RS_POLY_PHASE_SHIFT (10U)
+
+/**
+ * @brief This macro indicates the tap count of the cubic kernel.
+ *
+ */
+#define RS_TAP_CNT (4U)
+
+/**
+ * @brief This macro indicates the fractional bit count of the polyphase
+ *        coefficients.
+ *
+ */
+#define RS_COEF_SHIFT (14U)
+
+/**
+ * @brief This macro indicates the mask of the lower half of a 32-bit sample.
+ *
+ */
+#define RS_LOW_HALF_MASK (0xFFFFU)
+
+/**
+ * @brief This macro indicates the bit count of the lower half of a 32-bit
+ *        sample.
+ *
+ */
+#define RS_LOW_HALF_SHIFT (16U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/**
+ * @brief Catmull-Rom interpolation coefficients in Q14, one row per 1/64 of a
+ *        frame. The row sum is always 16384, so a DC input stays unchanged.
+ *
+ */
+static const int16_t m_poly_coef[RS_POLY_PHASE_CNT][RS_TAP_CNT] = {
+    {     0,  16384,      0,      0},
+    {  -124,  16374,    136,     -2},
+    {  -240,  16345,    287,     -8},
+    {  -349,  16297,    453,    -17},
+    {  -450,  16230,    634,    -30},
+    {  -544,  16146,    828,    -46},
+    {  -631,  16044,   1036,    -65},
+    {  -711,  15926,   1256,    -87},
+    {  -784,  15792,   1488,   -112},
+    {  -851,  15642,   1732,   -139},
+    {  -911,  15478,   1986,   -169},
+    {  -966,  15299,   2251,   -200},
+    { -1014,  15106,   2526,   -234},
+    { -1057,  14900,   2810,   -269},
+    { -1094,  14681,   3103,   -306},
+    { -1125,  14450,   3404,   -345},
+    { -1152,  14208,   3712,   -384},
+    { -1174,  13955,   4027,   -424},
+    { -1190,  13691,   4349,   -466},
+    { -1202,  13417,   4677,   -508},
+    { -1210,  13134,   5010,   -550},
+    { -1213,  12842,   5348,   -593},
+    { -1213,  12542,   5690,   -635},
+    { -1208,  12235,   6035,   -678},
+    { -1200,  11920,   6384,   -720},
+    { -1188,  11599,   6735,   -762},
+    { -1173,  11272,   7088,   -803},
+    { -1155,  10939,   7443,   -843},
+    { -1134,  10602,   7798,   -882},
+    { -1110,  10260,   8154,   -920},
+    { -1084,   9915,   8509,   -956},
+    { -1055,   9567,   8863,   -991},
+    { -1024,   9216,   9216,  -1024},
+    {  -991,   8863,   9567,  -1055},
+    {  -956,   8509,   9915,  -1084},
+    {  -920,   8154,  10260,  -1110},
+    {  -882,   7798,  10602,  -1134},
+    {  -843,   7443,  10939,  -1155},
+    {  -803,   7088,  11272,  -1173},
+    {  -762,   6735,  11599,  -1188},
+    {  -720,   6384,  11920,  -1200},
+    {  -678,   6035,  12235,  -1208},
+    {  -635,   5690,  12542,  -1213},
+    {  -593,   5348,  12842,  -1213},
+    {  -550,   5010,  13134,  -1210},
+    {  -508,   4677,  13417,  -1202},
+    {  -466,   4349,  13691,  -1190},
+    {  -424,   4027,  13955,  -1174},
+    {  -384,   3712,  14208,  -1152},
+    {  -345,   3404,  14450,  -1125},
+    {  -306,   3103,  14681,  -1094},
+    {  -269,   2810,  14900,  -1057},
+    {  -234,   2526,  15106,  -1014},
+    {  -200,   2251,  15299,   -966},
+    {  -169,   1986,  15478,   -911},
+    {  -139,   1732,  15642,   -851},
+    {  -112,   1488,  15792,   -784},
+    {   -87,   1256,  15926,   -711},
+    {   -65,   1036,  16044,   -631},
+    {   -46,    828,  16146,   -544},
+    {   -30,    634,  16230,   -450},
+    {   -17,    453,  16297,   -349},
+    {    -8,    287,  16345,   -240},
+    {    -2,    136,  16374,   -124}
+};
+
+/*******************************************************************************
+ * Private Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief This function returns (sample * frac) >> 16 without a long multiply.
+ *
+ * @param[in] sample Signed sample.
+ * @param[in] frac   Q16 fraction.
+ *
+ * @return int32_t Scaled sample.
+ *
+ */
+static inline int32_t mul_q16(int32_t sample, uint32_t frac);
+
+/**
+ * @brief This function returns (sample * coef) without the Q14 scaling and
+ *        without a long multiply. The result is to be shifted by the caller.
+ *
+ * @param[in] sample Signed sample.
+ * @param[in] coef   Q14 coefficient.
+ *
+ * @return int64_t Product in Q14.
+ *
+ */
+static inline int64_t mul_q14(int32_t sample, int32_t coef);
+
+/**
+ * @brief This function saturates the value to the int32_t range.
+ *
+ * @param[in] val Value to be saturated.
+ *
+ * @return int32_t Saturated value.
+ *
+ */
+static inline int32_t sat_s32(int64_t val);
+
+/**
+ * @brief This function interpolates one frame with the linear kernel.
+ *
+ * @param[in]  p_x   Four consecutive frames, the output lies between the
+ *                   second and the third.
+ * @param[in]  frac  Q16 position between the second and the third frame.
+ * @param[out] p_out Output frame.
+ *
+ */
+static inline void linear_frame_get(const int32_t *p_x,
+                                    uint32_t frac,
+                                    int32_t *p_out);
+
+/**
+ * @brief This function interpolates one frame with the 4-tap kernel.
+ *
+ * @param[in]  p_x   Four consecutive frames, the output lies between the
+ *                   second and the third.
+ * @param[in]  frac  Q16 position between the second and the third frame.
+ * @param[out] p_out Output frame.
+ *
+ */
+static inline void cubic_frame_get(const int32_t *p_x,
+                                   uint32_t frac,
+                                   int32_t *p_out);
+
+/**
+ * @brief This function stores the last input frames to the history.
+ *
+ * @param[in,out] p_rs   Resampler state.
+ * @param[in]     p_in   Input frames.
+ * @param[in]     in_cnt Input frame count.
+ *
+ */
+static void hist_update(dsp_resampler_t *p_rs,
+                        const int32_t *p_in,
+                        uint32_t in_cnt);
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void dsp_resampler_init(dsp_resampler_t *p_rs, dsp_resampler_mode_t mode)
+{
+    if (NULL == p_rs)
+    {
+        return;
+    }
+
+    (void)memset(p_rs, 0, sizeof(dsp_resampler_t));
+
+    p_rs->mode = mode;
+
+    p_rs->phase = RS_PHASE_INIT;
+}
+
+uint32_t dsp_resampler_phase_init_get(void)
+{
+    return RS_PHASE_INIT;
+}
+
+uint32_t dsp_resampler_plan(uint32_t *p_phase,
+                            uint32_t out_cnt,
+                            uint32_t step,
+                            int32_t step_inc)
+{
+    if (NULL == p_phase)
+    {
+        return 0U;
+    }
+
+    // Sum of the ramped steps: out * step + inc * (0 + 1 + ... + out - 1).
+    int32_t ramp = step_inc * (int32_t)((out_cnt * (out_cnt - 1U)) / 2U);
+
+    uint32_t end = *p_phase + (out_cnt * step) + (uint32_t)ramp;
+
+    // The frame under the last phase and its successor stay in the history.
+    uint32_t in_cnt = (end >> DSP_RESAMPLER_STEP_SHIFT) - 1U;
+
+    *p_phase = end - (in_cnt << DSP_RESAMPLER_STEP_SHIFT);
+
+    return in_cnt;
+}
+
+bool dsp_resampler_process(dsp_resampler_t *p_rs,
+                           const int32_t *p_in,
+                           uint32_t in_cnt,
+                           int32_t *p_out,
+                           uint32_t out_cnt,
+                           uint32_t step,
+                           int32_t step_inc)
+{
+    if ((NULL == p_rs) || (NULL == p_out) ||
+        ((NULL == p_in) && (0U != in_cnt)))
+    {
+        return false;
+    }
+
+    uint32_t phase = p_rs->phase;
+
+    if (dsp_resampler_plan(&phase, out_cnt, step, step_inc) != in_cnt)
+    {
+        return false;
+    }
+
+    uint32_t pos = p_rs->phase;
+
+    int32_t tmp[RS_TAP_CNT * DSP_RESAMPLER_CH_CNT];
+
+    for (uint32_t idx = 0U; idx < out_cnt; idx++)
+    {
+        // Index of the first tap in the history + input frame sequence.
+        uint32_t first = (pos >> DSP_RESAMPLER_STEP_SHIFT) - 1U;
+
+        const int32_t *p_x = NULL;
+
+        if (DSP_RESAMPLER_HIST_CNT <= first)
+        {
+            p_x = &p_in[(first - DSP_RESAMPLER_HIST_CNT) * DSP_RESAMPLER_CH_CNT];
+        }
+        else
+        {
+            for (uint32_t tap = 0U; tap < RS_TAP_CNT; tap++)
+            {
+                uint32_t frame = first + tap;
+
+                const int32_t *p_src =
+                    (DSP_RESAMPLER_HIST_CNT > frame)
+                        ? &p_rs->hist[frame * DSP_RESAMPLER_CH_CNT]
+                        : &p_in[(frame - DSP_RESAMPLER_HIST_CNT) *
+                                DSP_RESAMPLER_CH_CNT];
+
+                tmp[tap * DSP_RESAMPLER_CH_CNT] = p_src[0U];
+                tmp[(tap * DSP_RESAMPLER_CH_CNT) + 1U] = p_src[1U];
+            }
+
+            p_x = tmp;
+        }
+
+        if (DSP_RESAMPLER_MODE_CUBIC == p_rs->mode)
+        {
+            cubic_frame_get(p_x,
+                            pos & RS_FRAC_MASK,
+                            &p_out[idx * DSP_RESAMPLER_CH_CNT]);
+        }
+        else
+        {
+            linear_frame_get(p_x,
+                             pos & RS_FRAC_MASK,
+                             &p_out[idx * DSP_RESAMPLER_CH_CNT]);
+        }
+
+        pos += step;
+
+        step += (uint32_t)step_inc;
+    }
+
+    hist_update(p_rs, p_in, in_cnt);
+
+    p_rs->phase = phase;
+
+    return true;
+}
+
+bool dsp_resampler_bypass_get(uint32_t phase, uint32_t step, int32_t step_inc)
+{
+    return ((RS_PHASE_INIT == phase) && (DSP_RESAMPLER_STEP_UNITY == step) &&
+            (0 == step_inc));
+}
+
+bool dsp_resampler_phase_align(uint32_t *p_phase,
+                               uint32_t *p_step,
+                               int32_t step_inc,
+                               uint32_t out_cnt)
+{
+    if ((NULL == p_phase) || (NULL == p_step) || (0U == out_cnt) ||
+        (DSP_RESAMPLER_STEP_UNITY != *p_step) || (0 != step_inc))
+    {
+        return false;
+    }
+
+    uint32_t frac = *p_phase & RS_FRAC_MASK;
+
+    if (0U == frac)
+    {
+        return false;
+    }
+
+    if (out_cnt > frac)
+    {
+        // Less than a step unit per frame is left, it is dropped at once.
+        *p_phase &= ~(uint32_t)RS_FRAC_MASK;
+    }
+    else if ((DSP_RESAMPLER_STEP_UNITY / 2U) > frac)
+    {
+        *p_step -= frac / out_cnt;
+    }
+    else
+    {
+        uint32_t rest = (uint32_t)DSP_RESAMPLER_STEP_UNITY - frac;
+
+        // The step overshoots the next frame by less than out_cnt, the rest
+        // is dropped by the next block.
+        *p_step += (rest + out_cnt - 1U) / out_cnt;
+    }
+
+    return true;
+}
+
+bool dsp_resampler_bypass(dsp_resampler_t *p_rs,
+                          int32_t *p_buff,
+                          uint32_t out_cnt)
+{
+    if ((NULL == p_rs) || (NULL == p_buff) || (0U == out_cnt) ||
+        (RS_PHASE_INIT != p_rs->phase))
+    {
+        return false;
+    }
+
+    const uint32_t hist_size = DSP_RESAMPLER_HIST_CNT * DSP_RESAMPLER_CH_CNT;
+
+    const uint32_t delay_size = DSP_RESAMPLER_DELAY_CNT * DSP_RESAMPLER_CH_CNT;
+
+    // The first output frame is the second history frame, the buffer then
+    // holds the history and input sequence from its second frame.
+    (void)memcpy(p_buff,
+                 &p_rs->hist[DSP_RESAMPLER_CH_CNT],
+                 delay_size * sizeof(int32_t));
+
+    (void)memcpy(p_rs->hist,
+                 &p_buff[(out_cnt - 1U) * DSP_RESAMPLER_CH_CNT],
+                 hist_size * sizeof(int32_t));
+
+    return true;
+}
+
+int32_t dsp_resampler_ramp_get(uint32_t *p_step,
+                               uint32_t target,
+                               uint32_t out_cnt)
+{
+    if ((NULL == p_step) || (0U == out_cnt))
+    {
+        return 0;
+    }
+
+    target = dsp_resampler_step_clamp(target);
+
+    int32_t inc = ((int32_t)target - (int32_t)*p_step) / (int32_t)out_cnt;
+
+    if (0 == inc)
+    {
+        *p_step = target;
+    }
+
+    return inc;
+}
+
+uint32_t dsp_resampler_step_clamp(uint32_t step)
+{
+    if (DSP_RESAMPLER_STEP_MIN > step)
+    {
+        return DSP_RESAMPLER_STEP_MIN;
+    }
+
+    if (DSP_RESAMPLER_STEP_MAX < step)
+    {
+        return DSP_RESAMPLER_STEP_MAX;
+    }
+
+    return step;
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline int32_t mul_q16(int32_t sample, uint32_t frac)
+{
+    // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed upper half is intended.
+    int32_t high = sample >> RS_LOW_HALF_SHIFT;
+    // PRQA S 3101, 4532 --
+
+    uint32_t low = (uint32_t)sample & RS_LOW_HALF_MASK;
+
+    return (high * (int32_t)frac) + (int32_t)((low * frac) >> RS_LOW_HALF_SHIFT);
+}
+
+static inline int64_t mul_q14(int32_t sample, int32_t coef)
+{
+    // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed upper half is intended.
+    int32_t high = sample >> RS_LOW_HALF_SHIFT;
+    // PRQA S 3101, 4532 --
+
+    int32_t low = (int32_t)((uint32_t)sample & RS_LOW_HALF_MASK);
+
+    return ((int64_t)(high * coef) * (int64_t)(1L << RS_LOW_HALF_SHIFT)) +
+           (int64_t)(low * coef);
+}
+
+static inline int32_t sat_s32(int64_t val)
+{
+    if ((int64_t)INT32_MAX < val)
+    {
+        return INT32_MAX;
+    }
+
+    if ((int64_t)INT32_MIN > val)
+    {
+        return INT32_MIN;
+    }
+
+    return (int32_t)val;
+}
+
+static inline void linear_frame_get(const int32_t *p_x,
+                                    uint32_t frac,
+                                    int32_t *p_out)
+{
+    for (uint32_t ch = 0U; ch < DSP_RESAMPLER_CH_CNT; ch++)
+    {
+        int32_t x0 = p_x[DSP_RESAMPLER_CH_CNT + ch];
+        int32_t x1 = p_x[(2U * DSP_RESAMPLER_CH_CNT) + ch];
+
+        // The halves keep the difference inside the int32_t range.
+        // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed samples is intended.
+        int32_t diff = (x1 >> 1) - (x0 >> 1);
+        // PRQA S 3101, 4532 --
+
+        p_out[ch] = sat_s32((int64_t)x0 + ((int64_t)mul_q16(diff, frac) * 2));
+    }
+}
+
+static inline void cubic_frame_get(const int32_t *p_x,
+                                   uint32_t frac,
+                                   int32_t *p_out)
+{
+    const int16_t *p_coef = m_poly_coef[frac >> RS_POLY_PHASE_SHIFT];
+
+    for (uint32_t ch = 0U; ch < DSP_RESAMPLER_CH_CNT; ch++)
+    {
+        int64_t acc = 0;
+
+        for (uint32_t tap = 0U; tap < RS_TAP_CNT; tap++)
+        {
+            acc += mul_q14(p_x[(tap * DSP_RESAMPLER_CH_CNT) + ch],
+                           (int32_t)p_coef[tap]);
+        }
+
+        // PRQA S 3101, 4532 ++ # Arithmetic shift of the signed sum is intended.
+        p_out[ch] = sat_s32(acc >> RS_COEF_SHIFT);
+        // PRQA S 3101, 4532 --
+    }
+}
+
+static void hist_update(dsp_resampler_t *p_rs,
+                        const int32_t *p_in,
+                        uint32_t in_cnt)
+{
+    const uint32_t hist_size = DSP_RESAMPLER_HIST_CNT * DSP_RESAMPLER_CH_CNT;
+
+    if (DSP_RESAMPLER_HIST_CNT <= in_cnt)
+    {
+        const int32_t *p_tail =
+            &p_in[(in_cnt - DSP_RESAMPLER_HIST_CNT) * DSP_RESAMPLER_CH_CNT];
+
+        (void)memcpy(p_rs->hist, p_tail, hist_size * sizeof(int32_t));
+
+        return;
+    }
+
+    uint32_t keep = (DSP_RESAMPLER_HIST_CNT - in_cnt) * DSP_RESAMPLER_CH_CNT;
+
+    (void)memmove(p_rs->hist,
+                  &p_rs->hist[hist_size - keep],
+                  keep * sizeof(int32_t));
+
+    if (0U != in_cnt)
+    {
+        (void)memcpy(&p_rs->hist[keep],
+                     p_in,
+                     (hist_size - keep) * sizeof(int32_t));
+    }
+}
+
+// end of file
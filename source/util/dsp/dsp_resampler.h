@@ -0,0 +1,298 @@
+/**
+ * @file dsp_resampler.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Streaming fractional-phase resampler for the stereo PCM audio.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The resampler reads the input at a Q16 step per output frame, so a step
+ * above DSP_RESAMPLER_STEP_UNITY raises the pitch and a step below it lowers
+ * the pitch. The last input frames of a block are kept in the state, so the
+ * blocks are joined without a discontinuity and the cost per output frame is
+ * constant whatever the step is.
+ *
+ * The caller plans every block with dsp_resampler_plan() before the input is
+ * read, then passes the same step and frame counts to
+ * dsp_resampler_process(). The step may ramp linearly inside a block with a
+ * per-frame increment, see dsp_resampler_ramp_get().
+ *
+ * The input can share the buffer with the output when it is placed at the
+ * end of a buffer of DSP_RESAMPLER_INPLACE_FRAME_CNT frames (see
+ * dsp_resampler_process()).
+ *
+ * A block at the unity step from the initial phase passes the input delayed
+ * by DSP_RESAMPLER_DELAY_CNT frames. dsp_resampler_bypass() runs such a block
+ * by moving the history only, so the input may be read straight to the
+ * output buffer. Once a pitch ramp has settled at the unity step,
+ * dsp_resampler_phase_align() moves the phase back to a frame so the
+ * following blocks may be bypassed again.
+ *
+ */
+
+#ifndef DSP_RESAMPLER_H
+#define DSP_RESAMPLER_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the fractional bit count of the step and phase.
+ *
+ */
+#define DSP_RESAMPLER_STEP_SHIFT (16U)
+
+/**
+ * @brief This macro indicates the step that keeps the original pitch.
+ *
+ */
+#define DSP_RESAMPLER_STEP_UNITY (1UL << DSP_RESAMPLER_STEP_SHIFT)
+
+/**
+ * @brief This macro indicates the lowest accepted step (one octave down).
+ *
+ */
+#define DSP_RESAMPLER_STEP_MIN (DSP_RESAMPLER_STEP_UNITY / 2U)
+
+/**
+ * @brief This macro indicates the highest accepted step (about one octave up).
+ *        It is kept below 2.0 so that the input of a block always fits behind
+ *        the output of the same block, see DSP_RESAMPLER_INPLACE_FRAME_CNT.
+ *
+ */
+#define DSP_RESAMPLER_STEP_MAX ((DSP_RESAMPLER_STEP_UNITY * 31U) / 16U)
+
+/**
+ * @brief This macro indicates the channel count of a frame.
+ *
+ */
+#define DSP_RESAMPLER_CH_CNT (2U)
+
+/**
+ * @brief This macro indicates the input frame count kept between blocks.
+ *
+ */
+#define DSP_RESAMPLER_HIST_CNT (4U)
+
+/**
+ * @brief This macro indicates the frame count by which the output follows the
+ *        input when a block passes the input unchanged. The initial phase is
+ *        on the second history frame.
+ *
+ */
+#define DSP_RESAMPLER_DELAY_CNT (DSP_RESAMPLER_HIST_CNT - 1U)
+
+/**
+ * @brief This macro indicates the buffer size in frames needed to resample
+ *        out_cnt frames in place at DSP_RESAMPLER_STEP_MAX.
+ *
+ */
+#define DSP_RESAMPLER_INPLACE_FRAME_CNT(out_cnt)                    \
+    ((((uint32_t)(out_cnt) * DSP_RESAMPLER_STEP_MAX) >>              \
+      DSP_RESAMPLER_STEP_SHIFT) + DSP_RESAMPLER_HIST_CNT + 2U)
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+
+/**
+ * @brief List of the interpolation modes.
+ *
+ */
+typedef enum dsp_resampler_mode_e
+{
+    DSP_RESAMPLER_MODE_LINEAR = 0U,
+    DSP_RESAMPLER_MODE_CUBIC = 1U,
+
+} dsp_resampler_mode_t;
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to the resampler state.
+ *
+ */
+typedef struct dsp_resampler_s
+{
+    dsp_resampler_mode_t mode;
+
+    uint32_t phase;
+
+    int32_t hist[DSP_RESAMPLER_HIST_CNT * DSP_RESAMPLER_CH_CNT];
+
+} dsp_resampler_t;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function resets the resampler state.
+ *
+ * @param[out] p_rs Resampler state.
+ * @param[in]  mode Interpolation mode.
+ *
+ */
+void dsp_resampler_init(dsp_resampler_t *p_rs, dsp_resampler_mode_t mode);
+
+/**
+ * @brief This function returns the initial phase of a reset resampler. It is
+ *        used to reset a block planner together with the resampler.
+ *
+ * @return uint32_t Initial phase.
+ *
+ */
+uint32_t dsp_resampler_phase_init_get(void);
+
+/**
+ * @brief This function calculates the input frame count of a block and
+ *        advances the given phase the same way dsp_resampler_process() does.
+ *
+ * @param[in,out] p_phase  Planning phase.
+ * @param[in]     out_cnt  Output frame count of the block.
+ * @param[in]     step     Q16 step of the first output frame.
+ * @param[in]     step_inc Step increment per output frame.
+ *
+ * @return uint32_t Input frame count to be read for the block.
+ *
+ */
+uint32_t dsp_resampler_plan(uint32_t *p_phase,
+                            uint32_t out_cnt,
+                            uint32_t step,
+                            int32_t step_inc);
+
+/**
+ * @brief This function resamples one block of interleaved stereo frames.
+ *
+ * The output may overlap the input when the input is stored at the end of a
+ * buffer of at least DSP_RESAMPLER_INPLACE_FRAME_CNT(out_cnt) frames and the
+ * output starts at the beginning of the same buffer.
+ *
+ * @param[in,out] p_rs     Resampler state.
+ * @param[in]     p_in     Input frames.
+ * @param[in]     in_cnt   Input frame count returned by dsp_resampler_plan().
+ * @param[out]    p_out    Output frames.
+ * @param[in]     out_cnt  Output frame count.
+ * @param[in]     step     Q16 step passed to dsp_resampler_plan().
+ * @param[in]     step_inc Step increment passed to dsp_resampler_plan().
+ *
+ * @return bool Process status.
+ *
+ * @retval true  The block has been resampled.
+ * @retval false The input frame count does not match the plan or an argument
+ *               is invalid.
+ *
+ */
+bool dsp_resampler_process(dsp_resampler_t *p_rs,
+                           const int32_t *p_in,
+                           uint32_t in_cnt,
+                           int32_t *p_out,
+                           uint32_t out_cnt,
+                           uint32_t step,
+                           int32_t step_inc);
+
+/**
+ * @brief This function checks whether a block passes the input unchanged: the
+ *        step is DSP_RESAMPLER_STEP_UNITY without a ramp and the block starts
+ *        at the initial phase, so no frame is interpolated.
+ *
+ * @param[in] phase    Planning phase of the block before dsp_resampler_plan().
+ * @param[in] step     Q16 step of the block.
+ * @param[in] step_inc Step increment of the block.
+ *
+ * @return bool Bypass status.
+ *
+ * @retval true  The block may be run by dsp_resampler_bypass().
+ * @retval false The block has to be resampled.
+ *
+ */
+bool dsp_resampler_bypass_get(uint32_t phase, uint32_t step, int32_t step_inc);
+
+/**
+ * @brief This function moves the phase of a block at the unity step without a
+ *        ramp towards the nearest input frame. The fraction left by a pitch
+ *        ramp stays constant at the unity step, so without the alignment every
+ *        following block would be interpolated.
+ *
+ * The step of the block is moved by the fraction spread over the block, so
+ * the next block starts within out_cnt step units from a frame. Such a
+ * small fraction is dropped from the phase at once, the resampler phase has
+ * to be set to the aligned phase before the block is run then.
+ *
+ * @param[in,out] p_phase  Planning phase of the block before
+ *                         dsp_resampler_plan().
+ * @param[in,out] p_step   Q16 step of the block.
+ * @param[in]     step_inc Step increment of the block.
+ * @param[in]     out_cnt  Output frame count of the block.
+ *
+ * @return bool Align status.
+ *
+ * @retval true  The phase or the step has been moved.
+ * @retval false The block is not at the unity step, the phase is at a frame
+ *               already or an argument is invalid.
+ *
+ */
+bool dsp_resampler_phase_align(uint32_t *p_phase,
+                               uint32_t *p_step,
+                               int32_t step_inc,
+                               uint32_t out_cnt);
+
+/**
+ * @brief This function runs a block that passes the input unchanged.
+ *
+ * The out_cnt input frames are stored DSP_RESAMPLER_DELAY_CNT frames into the
+ * buffer. The delayed history frames are put before them and the last input
+ * frames are kept in the history, so the first out_cnt frames of the buffer
+ * are the output of dsp_resampler_process() for the same block.
+ *
+ * @param[in,out] p_rs    Resampler state.
+ * @param[in,out] p_buff  Buffer of out_cnt + DSP_RESAMPLER_DELAY_CNT frames.
+ * @param[in]     out_cnt Output frame count, equal to the input frame count.
+ *
+ * @return bool Bypass status.
+ *
+ * @retval true  The block has been run.
+ * @retval false The resampler is not at the initial phase or an argument is
+ *               invalid.
+ *
+ */
+bool dsp_resampler_bypass(dsp_resampler_t *p_rs,
+                          int32_t *p_buff,
+                          uint32_t out_cnt);
+
+/**
+ * @brief This function calculates the per-frame increment that moves the step
+ *        to the target within one block. A difference too small to be spread
+ *        over the block is applied at once at the block boundary.
+ *
+ * @param[in,out] p_step  Step of the first frame of the block. It is set to
+ *                        the target when no ramp is needed.
+ * @param[in]     target  Target step, clamped to the accepted range.
+ * @param[in]     out_cnt Output frame count of the block.
+ *
+ * @return int32_t Step increment per output frame.
+ *
+ */
+int32_t dsp_resampler_ramp_get(uint32_t *p_step,
+                               uint32_t target,
+                               uint32_t out_cnt);
+
+/**
+ * @brief This function clamps the step to the accepted range.
+ *
+ * @param[in] step Q16 step.
+ *
+ * @return uint32_t Clamped step.
+ *
+ */
+uint32_t dsp_resampler_step_clamp(uint32_t step);
+
+#endif /* DSP_RESAMPLER_H */
+
+// end of file
@@ -0,0 +1,160 @@
+/**
+ * @file spsc_queue.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the lock-free SPSC queue.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "spsc_queue.h"
+
+/*******************************************************************************
+ * Private Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief This function returns the storage index following the given one.
+ *
+ * @param[in] p_queue Queue state.
+ * @param[in] idx     Storage index.
+ *
+ * @return uint32_t Next storage index.
+ *
+ */
+static inline uint32_t queue_idx_next(const spsc_queue_t *p_queue,
+                                      uint32_t idx);
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+bool spsc_queue_init(spsc_queue_t *p_queue,
+                     volatile uint32_t *p_item,
+                     uint32_t size)
+{
+    if ((NULL == p_queue) || (NULL == p_item) || (2U > size))
+    {
+        return false;
+    }
+
+    p_queue->p_item = p_item;
+    p_queue->size = size;
+    p_queue->head = 0U;
+    p_queue->tail = 0U;
+
+    return true;
+}
+
+void spsc_queue_reset(spsc_queue_t *p_queue)
+{
+    p_queue->head = 0U;
+    p_queue->tail = 0U;
+}
+
+bool spsc_queue_push(spsc_queue_t *p_queue, uint32_t item)
+{
+    uint32_t head = p_queue->head;
+
+    uint32_t next = queue_idx_next(p_queue, head);
+
+    if (next == p_queue->tail)
+    {
+        return false;
+    }
+
+    p_queue->p_item[head] = item;
+
+    // The item is visible to the consumer once the head has been moved.
+    p_queue->head = next;
+
+    return true;
+}
+
+bool spsc_queue_pop(spsc_queue_t *p_queue, uint32_t *p_item)
+{
+    uint32_t tail = p_queue->tail;
+
+    if (tail == p_queue->head)
+    {
+        return false;
+    }
+
+    *p_item = p_queue->p_item[tail];
+
+    // The entry is given back to the producer once the tail has been moved.
+    p_queue->tail = queue_idx_next(p_queue, tail);
+
+    return true;
+}
+
+bool spsc_queue_peek(const spsc_queue_t *p_queue, uint32_t *p_item)
+{
+    uint32_t tail = p_queue->tail;
+
+    if (tail == p_queue->head)
+    {
+        return false;
+    }
+
+    *p_item = p_queue->p_item[tail];
+
+    return true;
+}
+
+bool spsc_queue_peek_at(const spsc_queue_t *p_queue,
+                        uint32_t pos,
+                        uint32_t *p_item)
+{
+    if (spsc_queue_cnt_get(p_queue) <= pos)
+    {
+        return false;
+    }
+
+    // The tail is moved by the consumer only, so it is still valid here.
+    uint32_t idx = p_queue->tail + pos;
+
+    if (idx >= p_queue->size)
+    {
+        idx -= p_queue->size;
+    }
+
+    *p_item = p_queue->p_item[idx];
+
+    return true;
+}
+
+uint32_t spsc_queue_cnt_get(const spsc_queue_t *p_queue)
+{
+    uint32_t head = p_queue->head;
+
+    uint32_t tail = p_queue->tail;
+
+    if (head >= tail)
+    {
+        return head - tail;
+    }
+
+    return (head + p_queue->size) - tail;
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline uint32_t queue_idx_next(const spsc_queue_t *p_queue,
+                                      uint32_t idx)
+{
+    idx++;
+
+    if (idx >= p_queue->size)
+    {
+        idx = 0U;
+    }
+
+    return idx;
+}
+
+// end of file
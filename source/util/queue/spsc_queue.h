@@ -0,0 +1,164 @@
+/**
+ * @file spsc_queue.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Lock-free single-producer/single-consumer queue of descriptor
+ *         indices.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * One side only pushes and the other side only pops, so the queue may be
+ * shared between an interrupt and the main loop without a critical section.
+ * The producer writes the item before it moves the head and the consumer
+ * reads the item before it moves the tail. Both indices are aligned 32-bit
+ * words, which the target loads and stores atomically.
+ *
+ * The indices wrap by comparison instead of a modulo, because the target
+ * (Cortex-M0+) has no hardware divider. One storage entry is kept empty to
+ * tell a full queue from an empty one, see SPSC_QUEUE_STORAGE_SIZE().
+ *
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the storage entry count of a queue holding up to
+ *        cap items.
+ *
+ */
+#define SPSC_QUEUE_STORAGE_SIZE(cap) ((uint32_t)(cap) + 1U)
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to the queue state.
+ *
+ */
+typedef struct spsc_queue_s
+{
+    volatile uint32_t *p_item;
+
+    uint32_t size;
+
+    volatile uint32_t head;
+
+    volatile uint32_t tail;
+
+} spsc_queue_t;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief This function initializes an empty queue on the given storage.
+ *
+ * @param[out] p_queue Queue state.
+ * @param[in]  p_item  Storage of SPSC_QUEUE_STORAGE_SIZE(cap) entries.
+ * @param[in]  size    Storage entry count, at least 2.
+ *
+ * @return bool Init status.
+ *
+ * @retval true  The queue has been initialized.
+ * @retval false An argument is invalid.
+ *
+ */
+bool spsc_queue_init(spsc_queue_t *p_queue,
+                     volatile uint32_t *p_item,
+                     uint32_t size);
+
+/**
+ * @brief This function empties the queue. It must not run while the producer
+ *        or the consumer is active.
+ *
+ * @param[out] p_queue Queue state.
+ *
+ */
+void spsc_queue_reset(spsc_queue_t *p_queue);
+
+/**
+ * @brief This function appends an item. It is called by the producer only.
+ *
+ * @param[in,out] p_queue Queue state.
+ * @param[in]     item    Item to be appended.
+ *
+ * @return bool Push status.
+ *
+ * @retval true  The item has been appended.
+ * @retval false The queue is full.
+ *
+ */
+bool spsc_queue_push(spsc_queue_t *p_queue, uint32_t item);
+
+/**
+ * @brief This function removes the oldest item. It is called by the consumer
+ *        only.
+ *
+ * @param[in,out] p_queue Queue state.
+ * @param[out]    p_item  Removed item.
+ *
+ * @return bool Pop status.
+ *
+ * @retval true  The item has been removed.
+ * @retval false The queue is empty.
+ *
+ */
+bool spsc_queue_pop(spsc_queue_t *p_queue, uint32_t *p_item);
+
+/**
+ * @brief This function reads the oldest item without removing it. It is
+ *        called by the consumer only.
+ *
+ * @param[in]  p_queue Queue state.
+ * @param[out] p_item  Oldest item.
+ *
+ * @return bool Peek status.
+ *
+ * @retval true  The item has been read.
+ * @retval false The queue is empty.
+ *
+ */
+bool spsc_queue_peek(const spsc_queue_t *p_queue, uint32_t *p_item);
+
+/**
+ * @brief This function reads the item at the given position from the oldest
+ *        one without removing it. It is called by the consumer only.
+ *
+ * @param[in]  p_queue Queue state.
+ * @param[in]  pos     Position of the item, zero is the oldest item.
+ * @param[out] p_item  Item at the position.
+ *
+ * @return bool Peek status.
+ *
+ * @retval true  The item has been read.
+ * @retval false The queue holds no item at the position.
+ *
+ */
+bool spsc_queue_peek_at(const spsc_queue_t *p_queue,
+                        uint32_t pos,
+                        uint32_t *p_item);
+
+/**
+ * @brief This function returns the item count. The count may be stale by the
+ *        time it is used when the other side is active.
+ *
+ * @param[in] p_queue Queue state.
+ *
+ * @return uint32_t Item count.
+ *
+ */
+uint32_t spsc_queue_cnt_get(const spsc_queue_t *p_queue);
+
+#endif /* SPSC_QUEUE_H */
+
+// end of file
@@ -23,12 +23,14 @@
 
 // Second - include the module to be tested
 #include "api_audio.h"
+#include "crc32.h"
 
 #include <string.h>
 
 // Third - include the mocks of required modules
 #include "mock_api_data.h"
 #include "mock_bsp_i2s.h"
+#include "mock_bsp_mcu.h"
 #include "mock_drv_amplifier.h"
 #include "mock_drv_flash.h"
 
@@ -39,6 +41,16 @@
  ******************************************************************************/
 
 TEST_FILE("api_audio.c");
+TEST_FILE("crc32.c");
+TEST_FILE("dsp_adpcm.c");
+TEST_FILE("dsp_biquad.c");
+TEST_FILE("dsp_chain.c");
+TEST_FILE("dsp_gain.c");
+TEST_FILE("dsp_limiter.c");
+TEST_FILE("dsp_osc.c");
+TEST_FILE("dsp_pcm.c");
+TEST_FILE("dsp_resampler.c");
+TEST_FILE("spsc_queue.c");
 
 /*******************************************************************************             
  * Defines
@@ -486,6 +498,62 @@ TEST_FILE("api_audio.c");
 #define TEST_AUDIO_OFFSET (TEST_API_DATA_AUDIO_CFG_TBL_SIZE + \
                            TEST_API_DATA_AUDIO_DEFAULT_SIZE)
 
+/**
+ * @brief This macro indicates the audio slot count of the fixed layout.
+ *
+ */
+#define TEST_AUDIO_SLOT_CNT (3U)
+
+/**
+ * @brief This macro indicates the size of the 16-bit mono PCM audio of the
+ *        CRC tests.
+ *
+ */
+#define TEST_CRC_AUDIO_SIZE (2048U)
+
+/**
+ * @brief This macro indicates the stored bit depth offset in the audio
+ *        configuration table. The maximum sample count, the loop points and
+ *        the format come before it.
+ *
+ */
+#define TEST_CFG_TBL_BIT_DEPTH_OFFSET (TEST_CFG_TBL_RESERVED_OFFSET + 11U)
+
+/**
+ * @brief This macro indicates the stored channel count offset in the audio
+ *        configuration table.
+ *
+ */
+#define TEST_CFG_TBL_CH_CNT_OFFSET (TEST_CFG_TBL_BIT_DEPTH_OFFSET + 1U)
+
+/**
+ * @brief This macro indicates the CRC-32 offset in the audio configuration
+ *        table.
+ *
+ */
+#define TEST_CFG_TBL_CRC_OFFSET (TEST_CFG_TBL_CH_CNT_OFFSET + 2U)
+
+/**
+ * @brief This macro indicates the process call count of the CRC tests, the
+ *        audio is played beyond its loop end.
+ *
+ */
+#define TEST_CRC_PROCESS_CNT (400U)
+
+/**
+ * @brief This macro indicates the frame count of the PCM tests, the audio of
+ *        the 32-bit stereo storage fills the audio of the CRC tests.
+ *
+ */
+#define TEST_PCM_FRAME_CNT (TEST_CRC_AUDIO_SIZE / 8U)
+
+/**
+ * @brief This macro indicates the size of the output recorded from the
+ *        played ring slots.
+ *
+ */
+#define TEST_PCM_PLAY_SIZE (4096U)
+
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
@@ -519,6 +587,39 @@ static bsp_i2s_cb_t m_test_audio_write_cb;
  */
 static api_data_cb_t m_test_data_cb;
 
+/**
+ * @brief This array holds the External Flash image of the CRC tests: the
+ *        configuration table and the audio of the first slot.
+ *
+ */
+static uint8_t m_test_flash[TEST_API_DATA_AUDIO_CFG_TBL_SIZE +
+                            TEST_CRC_AUDIO_SIZE];
+
+/**
+ * @brief This array holds the ring slot addresses passed to the I2S.
+ *
+ */
+static uint8_t *m_test_ring_slot[BSP_I2S_RING_SLOT_MAX];
+
+/**
+ * @brief This variable holds the ring slot size passed to the I2S, it is
+ *        zero until the ring is started.
+ *
+ */
+static size_t m_test_ring_slot_size;
+
+/**
+ * @brief This array holds the output of the played ring slots.
+ *
+ */
+static uint8_t m_test_play[TEST_PCM_PLAY_SIZE];
+
+/**
+ * @brief This variable holds the size of the recorded output.
+ *
+ */
+static uint32_t m_test_play_size;
+
 /*******************************************************************************
  * Private Functions Prototype Declarations
  ******************************************************************************/
@@ -537,6 +638,15 @@ static bool test_bsp_i2s_cb_set_stub(bsp_i2s_cb_t callback,
 static bool test_bsp_data_cb_set_stub(api_data_cb_t callback, 
                                       int cmock_num_calls);
 
+/**
+ * @brief This stub function resolves the audio slots of the fixed layout.
+ *
+ */
+static bool test_api_data_audio_slot_get_stub(uint8_t audio,
+                                              uint32_t *p_label,
+                                              uint32_t *p_size,
+                                              int cmock_num_calls);
+
 /**
  * @brief This helper function is used for audio initialization.
  * 
@@ -628,6 +738,63 @@ static bool test_api_data_read(uint32_t data_label,
                                uint32_t offset, 
                                int cmock_num_calls);
 
+/**
+ * @brief This stub function reads the External Flash image of the CRC tests.
+ *
+ */
+static bool test_api_data_read_flash_stub(uint32_t data_label,
+                                          uint8_t *p_data,
+                                          size_t size,
+                                          uint32_t offset,
+                                          int cmock_num_calls);
+
+/**
+ * @brief This helper function builds the External Flash image of the CRC
+ *        tests.
+ *
+ * @param crc CRC-32 of the configuration table.
+ *
+ */
+static void helper_crc_flash_set(uint32_t crc);
+
+/**
+ * @brief This helper function initializes the audio again and plays the
+ *        audio of the CRC tests beyond its loop end.
+ *
+ */
+static void helper_crc_audio_play(void);
+
+/**
+ * @brief This stub function records the ring slots of the I2S and the output
+ *        of the slots filled before the start.
+ *
+ */
+static bool test_bsp_i2s_ring_start_stub(uint8_t *const *pp_slot,
+                                         uint32_t slot_cnt,
+                                         size_t slot_size,
+                                         int cmock_num_calls);
+
+/**
+ * @brief This stub function records the output of a committed ring slot.
+ *
+ */
+static bool test_bsp_i2s_slot_commit_stub(uint32_t slot, int cmock_num_calls);
+
+/**
+ * @brief This helper function records the output of a ring slot.
+ *
+ */
+static void helper_ring_slot_record(uint32_t slot);
+
+/**
+ * @brief This helper function builds the External Flash image of the PCM
+ *        tests. The same stereo audio is stored in the given bit depth.
+ *
+ * @param bit_depth Stored bit depth, 16 or 32.
+ *
+ */
+static void helper_pcm_flash_set(uint32_t bit_depth);
+
 /*******************************************************************************
  * Setup & Teardown 
  ******************************************************************************/
@@ -636,6 +803,11 @@ void setUp()
 {
     log_print_Ignore();
 
+    api_data_audio_slot_cnt_get_IgnoreAndReturn(TEST_AUDIO_SLOT_CNT);
+    api_data_audio_slot_get_StubWithCallback(test_api_data_audio_slot_get_stub);
+
+    bsp_mcu_tick_get_IgnoreAndReturn(0U);
+
     m_test_edit_cnt = false;
     m_test_current_audio = false;
 }
@@ -700,6 +872,9 @@ void test_api_audio_init__usual_run__success(void)
     // get data callback adress
     api_data_cb_set_StubWithCallback(test_bsp_data_cb_set_stub);
 
+    // ignore amplifier diagnostic callback
+    drv_amplifier_diag_cb_set_Ignore();
+
     // **************************** Test Steps ****************************** //
 
     TEST_STEP(1);
@@ -1214,6 +1389,46 @@ void test_api_audio_pause__usual_run__success(void)
     TEST_ASSERT_EQUAL(true, ret);
 }
 
+/**
+ * @brief The test verifies the api_audio_pause function when the audio is
+ * running. The audio fades out and resumes on api_audio_play.
+ *
+ */
+void test_api_audio_pause__when_audio_state_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_init_success();
+
+    helper_api_audio_read_finish_stub();
+
+    drv_flash_is_busy_IgnoreAndReturn(true);
+
+    helper_api_audio_run_state();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_audio_pause();
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, ret);
+    TEST_ASSERT_EQUAL(false, api_audio_status_get());
+
+    TEST_STEP(3);
+    ret = api_audio_play();
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(false, ret);
+    TEST_ASSERT_EQUAL(true, api_audio_status_get());
+}
+
 /**
  * @brief The test verifies the api_audio_play function is successful. 
  * 
@@ -1403,6 +1618,57 @@ void test_api_audio_param_update__when_api_audio_not_init__fail(void)
     api_audio_param_update(speed);
 }
 
+/**
+ * @brief The test verifies the api_audio_speed_update function is successful
+ * with a fractional speed.
+ *
+ */
+void test_api_audio_speed_update__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // 10.5 km/h in 1/256 km/h
+    uint16_t speed = (10U << API_AUDIO_SPEED_SHIFT) + 128U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_init_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    api_audio_speed_update(speed);
+}
+
+/**
+ * @brief The test verifies the api_audio_speed_update function when the
+ * api_audio_deinit function is successful.
+ *
+ */
+void test_api_audio_speed_update__when_api_audio_not_init__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint16_t speed = 10U << API_AUDIO_SPEED_SHIFT;
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_deinit_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    api_audio_speed_update(speed);
+}
+
 /**
  * @brief The test verifies the api_audio_switch function is successful. 
  * 
@@ -1464,6 +1730,34 @@ void test_api_audio_switch__invalid_audio__fail(void)
     TEST_ASSERT_EQUAL(false, ret);
 }
 
+/**
+ * @brief The test verifies the api_audio_switch function with an audio number
+ * out of the audio slots.
+ *
+ */
+void test_api_audio_switch__when_audio_num_out_of_slots__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint8_t audio_num = TEST_AUDIO_SLOT_CNT;
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_init_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_audio_switch(audio_num);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
 /**
  * @brief The test verifies the api_audio_switch function when audio is not 
  * init.  
@@ -1532,50 +1826,49 @@ void test_api_audio_switch__when_audio_num_is_same___success(void)
 }
 
 /**
- * @brief The test verifies the api_audio_name_get function is successful. 
- * 
- * https://codebeamer.daiichi.com/item/195577
- *  
+ * @brief The test verifies the api_audio_prefetch function fails when the
+ * build has no standby layer. The standby layer is tested by
+ * test_api_audio_mix.
+ *
  */
-void test_api_audio_name_get__usual_run__success(void)
+void test_api_audio_prefetch__when_no_standby__fail(void)
 {
     TEST_CASE();
 
     // **************************** Input Params **************************** //
 
-    char_t test_audio_name[TEST_CFG_TBL_NAME_PARAM_SIZE];
+    uint8_t audio_num = 1U;
 
     // **************************** Pre-Actions ***************************** //
 
     helper_api_audio_init_success();
 
-    helper_buffer_state_ready();
-
     // ************************** Expected Calls **************************** //
 
     // **************************** Test Steps ****************************** //
 
     TEST_STEP(1);
-    bool ret = api_audio_name_get(test_audio_name);
+    TEST_ASSERT_EQUAL(false, api_audio_standby_get());
 
     TEST_STEP(2);
-    TEST_ASSERT_EQUAL(true, ret);
+    bool ret = api_audio_prefetch(audio_num);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, ret);
 }
 
 /**
- * @brief The test verifies the api_audio_name_get function is failing according 
- * to the buffer state ready.  
- * 
- * https://codebeamer.daiichi.com/item/197176
- *  
+ * @brief The test verifies the api_audio_prefetch function with an audio
+ * number out of the audio slots.
+ *
  */
-void test_api_audio_name_get__buffer_state__fail(void)
+void test_api_audio_prefetch__when_audio_num_out_of_slots__fail(void)
 {
     TEST_CASE();
 
     // **************************** Input Params **************************** //
 
-    char_t test_audio_name[TEST_CFG_TBL_NAME_PARAM_SIZE];
+    uint8_t audio_num = TEST_AUDIO_SLOT_CNT;
 
     // **************************** Pre-Actions ***************************** //
 
@@ -1586,26 +1879,24 @@ void test_api_audio_name_get__buffer_state__fail(void)
     // **************************** Test Steps ****************************** //
 
     TEST_STEP(1);
-    bool ret = api_audio_name_get(test_audio_name);
+    bool ret = api_audio_prefetch(audio_num);
 
     TEST_STEP(2);
     TEST_ASSERT_EQUAL(false, ret);
 }
 
 /**
- * @brief The test verifies the api_audio_name_get function when deinit function 
- * is successful. 
- * 
- * https://codebeamer.daiichi.com/item/195578
- *  
+ * @brief The test verifies the api_audio_prefetch function when audio is not
+ * init.
+ *
  */
-void test_api_audio_name_get__when_api_audio_not_init__fail(void)
+void test_api_audio_prefetch__when_api_audio_not_init__fail(void)
 {
     TEST_CASE();
 
     // **************************** Input Params **************************** //
 
-    char_t test_audio_name[TEST_CFG_TBL_NAME_PARAM_SIZE];
+    uint8_t audio_num = 1U;
 
     // **************************** Pre-Actions ***************************** //
 
@@ -1616,53 +1907,64 @@ void test_api_audio_name_get__when_api_audio_not_init__fail(void)
     // **************************** Test Steps ****************************** //
 
     TEST_STEP(1);
-    bool ret = api_audio_name_get(test_audio_name);
+    bool ret = api_audio_prefetch(audio_num);
 
     TEST_STEP(2);
     TEST_ASSERT_EQUAL(false, ret);
 }
 
 /**
- * @brief The test verifies the api_audio_name_get function when using an 
- * invalid argument. 
- * 
- * https://codebeamer.daiichi.com/item/195579
- *  
+ * @brief The test verifies the api_audio_layer_set and api_audio_layer_stop
+ * functions fail when the build has the default layer count of 1. The mixer
+ * layers are tested by test_api_audio_mix.
+ *
  */
-void test_api_audio_name_get__when_use_invalid_argument__fail(void)
+void test_api_audio_layer_set__when_no_layer__fail(void)
 {
     TEST_CASE();
 
     // **************************** Input Params **************************** //
 
+    uint8_t layer = 1U;
+
+    uint8_t audio_num = 1U;
+
+    uint16_t gain = 1000U;
+
     // **************************** Pre-Actions ***************************** //
 
-    helper_api_audio_deinit_success();
+    helper_api_audio_init_success();
 
     // ************************** Expected Calls **************************** //
 
     // **************************** Test Steps ****************************** //
 
     TEST_STEP(1);
-    bool ret = api_audio_name_get(NULL);
+    bool ret = api_audio_layer_set(layer, audio_num, gain);
 
     TEST_STEP(2);
     TEST_ASSERT_EQUAL(false, ret);
+
+    TEST_STEP(3);
+    ret = api_audio_layer_stop(layer);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(false, ret);
 }
 
 /**
- * @brief The test verifies the api_audio_size_get function is successful. 
+ * @brief The test verifies the api_audio_name_get function is successful. 
  * 
- * https://codebeamer.daiichi.com/item/195582
+ * https://codebeamer.daiichi.com/item/195577
  *  
  */
-void test_api_audio_size_get__usual_run__success(void)
+void test_api_audio_name_get__usual_run__success(void)
 {
     TEST_CASE();
 
     // **************************** Input Params **************************** //
 
-    uint32_t test_size = 99U;
+    char_t test_audio_name[TEST_CFG_TBL_NAME_PARAM_SIZE];
 
     // **************************** Pre-Actions ***************************** //
 
@@ -1675,29 +1977,26 @@ void test_api_audio_size_get__usual_run__success(void)
     // **************************** Test Steps ****************************** //
 
     TEST_STEP(1);
-    bool ret = api_audio_size_get(&test_size);
+    bool ret = api_audio_name_get(test_audio_name);
 
     TEST_STEP(2);
-    TEST_ASSERT_EQUAL(0U, test_size);
-
-    TEST_STEP(3);
     TEST_ASSERT_EQUAL(true, ret);
 }
 
 /**
- * @brief The test verifies the api_audio_size_get function is failing 
- * according to the buffer state ready.
+ * @brief The test verifies the api_audio_name_get function is failing according 
+ * to the buffer state ready.  
  * 
- * https://codebeamer.daiichi.com/item/197177
+ * https://codebeamer.daiichi.com/item/197176
  *  
  */
-void test_api_audio_size_get__buffer_state__fail(void)
+void test_api_audio_name_get__buffer_state__fail(void)
 {
     TEST_CASE();
 
     // **************************** Input Params **************************** //
 
-    uint32_t test_size = 99U;
+    char_t test_audio_name[TEST_CFG_TBL_NAME_PARAM_SIZE];
 
     // **************************** Pre-Actions ***************************** //
 
@@ -1708,29 +2007,26 @@ void test_api_audio_size_get__buffer_state__fail(void)
     // **************************** Test Steps ****************************** //
 
     TEST_STEP(1);
-    bool ret = api_audio_size_get(&test_size);
+    bool ret = api_audio_name_get(test_audio_name);
 
     TEST_STEP(2);
-    TEST_ASSERT_EQUAL(99U, test_size);
-
-    TEST_STEP(3);
     TEST_ASSERT_EQUAL(false, ret);
 }
 
 /**
- * @brief The test verifies the api_audio_size_get function when the 
- * api_audio_deinit() function is successful. 
+ * @brief The test verifies the api_audio_name_get function when deinit function 
+ * is successful. 
  * 
- * https://codebeamer.daiichi.com/item/195583
+ * https://codebeamer.daiichi.com/item/195578
  *  
  */
-void test_api_audio_size_get__when_api_audio_not_init__fail(void)
+void test_api_audio_name_get__when_api_audio_not_init__fail(void)
 {
     TEST_CASE();
 
     // **************************** Input Params **************************** //
 
-    uint32_t test_size = 99U;
+    char_t test_audio_name[TEST_CFG_TBL_NAME_PARAM_SIZE];
 
     // **************************** Pre-Actions ***************************** //
 
@@ -1741,20 +2037,145 @@ void test_api_audio_size_get__when_api_audio_not_init__fail(void)
     // **************************** Test Steps ****************************** //
 
     TEST_STEP(1);
-    bool ret = api_audio_size_get(&test_size);
+    bool ret = api_audio_name_get(test_audio_name);
 
     TEST_STEP(2);
-    TEST_ASSERT_EQUAL(99U, test_size);
-
-    TEST_STEP(3);
     TEST_ASSERT_EQUAL(false, ret);
 }
 
 /**
- * @brief The test verifies the api_audio_size_get function when using an 
+ * @brief The test verifies the api_audio_name_get function when using an 
  * invalid argument. 
  * 
- * https://codebeamer.daiichi.com/item/195584
+ * https://codebeamer.daiichi.com/item/195579
+ *  
+ */
+void test_api_audio_name_get__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_deinit_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_audio_name_get(NULL);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
+/**
+ * @brief The test verifies the api_audio_size_get function is successful. 
+ * 
+ * https://codebeamer.daiichi.com/item/195582
+ *  
+ */
+void test_api_audio_size_get__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t test_size = 99U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_init_success();
+
+    helper_buffer_state_ready();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_audio_size_get(&test_size);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(0U, test_size);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(true, ret);
+}
+
+/**
+ * @brief The test verifies the api_audio_size_get function is failing 
+ * according to the buffer state ready.
+ * 
+ * https://codebeamer.daiichi.com/item/197177
+ *  
+ */
+void test_api_audio_size_get__buffer_state__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t test_size = 99U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_init_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_audio_size_get(&test_size);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(99U, test_size);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
+/**
+ * @brief The test verifies the api_audio_size_get function when the 
+ * api_audio_deinit() function is successful. 
+ * 
+ * https://codebeamer.daiichi.com/item/195583
+ *  
+ */
+void test_api_audio_size_get__when_api_audio_not_init__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t test_size = 99U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_deinit_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_audio_size_get(&test_size);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(99U, test_size);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
+/**
+ * @brief The test verifies the api_audio_size_get function when using an 
+ * invalid argument. 
+ * 
+ * https://codebeamer.daiichi.com/item/195584
  *  
  */
 void test_api_audio_size_get__when_use_invalid_argument__fail(void)
@@ -2315,6 +2736,40 @@ void test_api_audio_gain_get__usual_run__success(void)
     TEST_ASSERT_EQUAL(true, ret);
 }
 
+/**
+ * @brief The test verifies the api_audio_gain_get and api_audio_freq_get
+ * functions reject an entry index beyond the configuration table.
+ *
+ */
+void test_api_audio_gain_get__offset_out_of_range__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint16_t test_gain = 99U;
+
+    uint16_t test_freq = 99U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_init_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, api_audio_gain_get(&test_gain, 100U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, api_audio_freq_get(&test_freq, 100U));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(99U, test_gain);
+    TEST_ASSERT_EQUAL(99U, test_freq);
+}
+
 /**
  * @brief The test verifies the api_audio_gain_get function is failing according 
  * to the buffer state ready.
@@ -2537,6 +2992,109 @@ void test_api_audio_ver_get__when_use_invalid_argument__fail(void)
     TEST_ASSERT_EQUAL(false, ret);
 }
 
+/**
+ * @brief The test verifies the api_audio_diag_get function is successful
+ * before the playback starts.
+ *
+ */
+void test_api_audio_diag_get__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    api_audio_diag_t test_diag = {0U};
+
+    (void)memset(&test_diag, 0xA5, sizeof(test_diag));
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_init_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_audio_diag_get(&test_diag);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, ret);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.underrun_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.late_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.refill_cnt);
+    TEST_ASSERT_EQUAL_UINT32(API_AUDIO_HEADROOM_NONE,
+                             test_diag.headroom_min_us);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.switch_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.switch_fast_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.switch_last_ms);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.switch_max_ms);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.silence_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.silence_ms);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.irq_ring_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.irq_silence_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.crc_ok_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.crc_fail_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.block_direct_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, test_diag.block_edit_cnt);
+}
+
+/**
+ * @brief The test verifies the api_audio_diag_get function when the
+ * api_audio_deinit function is successful.
+ *
+ */
+void test_api_audio_diag_get__when_api_audio_not_init__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    api_audio_diag_t test_diag = {0U};
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_deinit_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_audio_diag_get(&test_diag);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
+/**
+ * @brief The test verifies the api_audio_diag_get function when using an
+ * invalid argument.
+ *
+ */
+void test_api_audio_diag_get__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_init_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_audio_diag_get(NULL);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
 /**
  * @brief The test verifies the api_audio_process function sets audio and flash 
  * state when the current audio state switches.
@@ -2894,6 +3452,7 @@ void test_api_audio_process__audio_play__success(void)
     api_data_read_StubWithCallback(test_api_data_read);
     bsp_i2s_cb_set_StubWithCallback(test_bsp_i2s_cb_set_stub);
     api_data_cb_set_StubWithCallback(test_bsp_data_cb_set_stub);
+    drv_amplifier_diag_cb_set_Ignore();
     (void)api_audio_init();
 
     // Update Speed 
@@ -2951,6 +3510,7 @@ void test_api_audio_process__gain_value__success(void)
     api_data_read_StubWithCallback(test_api_data_read);
     bsp_i2s_cb_set_StubWithCallback(test_bsp_i2s_cb_set_stub);
     api_data_cb_set_StubWithCallback(test_bsp_data_cb_set_stub);
+    drv_amplifier_diag_cb_set_Ignore();
     (void)api_audio_init();
 
     // Update Speed for different gain value
@@ -3008,6 +3568,7 @@ void test_api_audio_process__buff_shift__success(void)
     api_data_read_StubWithCallback(test_api_data_read);
     bsp_i2s_cb_set_StubWithCallback(test_bsp_i2s_cb_set_stub);
     api_data_cb_set_StubWithCallback(test_bsp_data_cb_set_stub);
+    drv_amplifier_diag_cb_set_Ignore();
     (void)api_audio_init();
 
     // Update Speed 
@@ -3063,10 +3624,317 @@ void test_api_audio_process__buff_shift__success(void)
     TEST_ASSERT_EQUAL(54U, test_cfg_tbl[403U]);
 }
 
+/**
+ * @brief The test verifies the api_audio_process function sets the checksum
+ * DTC once the audio has been read up to its loop end and does not match the
+ * CRC of its configuration table.
+ *
+ */
+void test_api_audio_process__when_audio_crc_mismatch__dtc_set(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_crc_flash_set(0U);
+
+    uint32_t crc = crc32_update(CRC32_INIT,
+                                &m_test_flash[TEST_API_DATA_AUDIO_CFG_TBL_SIZE],
+                                TEST_CRC_AUDIO_SIZE);
+
+    helper_crc_flash_set(crc ^ 1U);
+
+    // ************************** Expected Calls **************************** //
+
+    api_data_dtc_set_ExpectAndReturn(TEST_API_DATA_LABEL_DTC_CSUM_FAIL,
+                                     1U,
+                                     true);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    helper_crc_audio_play();
+}
+
+/**
+ * @brief The test verifies the api_audio_process function does not set the
+ * checksum DTC when the audio matches the CRC of its configuration table.
+ *
+ */
+void test_api_audio_process__when_audio_crc_match__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_crc_flash_set(0U);
+
+    uint32_t crc = crc32_update(CRC32_INIT,
+                                &m_test_flash[TEST_API_DATA_AUDIO_CFG_TBL_SIZE],
+                                TEST_CRC_AUDIO_SIZE);
+
+    helper_crc_flash_set(crc);
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    helper_crc_audio_play();
+}
+
+/**
+ * @brief The test verifies the api_audio_process function plays the native
+ * 32-bit stereo audio read straight to the ring slots the same as the 16-bit
+ * stereo audio expanded and resampled by the edit stage.
+ *
+ */
+void test_api_audio_process__when_native_pcm_direct__same_as_edit(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    api_audio_diag_t diag = {0U};
+
+    uint8_t test_edit_play[TEST_PCM_PLAY_SIZE];
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_pcm_flash_set(16U);
+
+    helper_crc_audio_play();
+
+    (void)memcpy(test_edit_play, m_test_play, sizeof(test_edit_play));
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, api_audio_diag_get(&diag));
+    TEST_ASSERT_EQUAL_UINT32(0U, diag.block_direct_cnt);
+    TEST_ASSERT_NOT_EQUAL(0U, diag.block_edit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(TEST_PCM_PLAY_SIZE, m_test_play_size);
+
+    TEST_STEP(2);
+    helper_pcm_flash_set(32U);
+
+    helper_crc_audio_play();
+
+    TEST_ASSERT_EQUAL(true, api_audio_diag_get(&diag));
+    TEST_ASSERT_NOT_EQUAL(0U, diag.block_direct_cnt);
+    TEST_ASSERT_EQUAL_UINT32(TEST_PCM_PLAY_SIZE, m_test_play_size);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(test_edit_play,
+                                  m_test_play,
+                                  TEST_PCM_PLAY_SIZE);
+}
+
 /*******************************************************************************
  * Private Functions Definitions
  ******************************************************************************/
 
+static bool test_api_data_read_flash_stub(uint32_t data_label,
+                                          uint8_t *p_data,
+                                          size_t size,
+                                          uint32_t offset,
+                                          int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    (void)memset(p_data, 0, size);
+
+    if (TEST_API_DATA_EEPROM_LAST_DATA > data_label)
+    {
+        return true;
+    }
+
+    uint32_t addr = (data_label - TEST_API_DATA_EEPROM_LAST_DATA) + offset;
+
+    for (size_t idx = 0U; idx < size; idx++)
+    {
+        if ((addr + idx) < sizeof(m_test_flash))
+        {
+            p_data[idx] = m_test_flash[addr + idx];
+        }
+    }
+
+    return true;
+}
+
+static void helper_crc_flash_set(uint32_t crc)
+{
+    uint8_t *p_tbl = m_test_flash;
+
+    uint8_t *p_audio = &m_test_flash[TEST_API_DATA_AUDIO_CFG_TBL_SIZE];
+
+    (void)memset(p_tbl, 0, TEST_API_DATA_AUDIO_CFG_TBL_SIZE);
+
+    // The sizes and the CRC of the table are big-endian.
+    p_tbl[TEST_CFG_TBL_SIZE_OFFSET + 2U] = (uint8_t)(TEST_CRC_AUDIO_SIZE >> 8U);
+    p_tbl[TEST_CFG_TBL_SIZE_OFFSET + 3U] = (uint8_t)TEST_CRC_AUDIO_SIZE;
+
+    p_tbl[TEST_CFG_TBL_BIT_DEPTH_OFFSET] = 16U;
+    p_tbl[TEST_CFG_TBL_CH_CNT_OFFSET] = 1U;
+
+    p_tbl[TEST_CFG_TBL_CRC_OFFSET] = (uint8_t)(crc >> 24U);
+    p_tbl[TEST_CFG_TBL_CRC_OFFSET + 1U] = (uint8_t)(crc >> 16U);
+    p_tbl[TEST_CFG_TBL_CRC_OFFSET + 2U] = (uint8_t)(crc >> 8U);
+    p_tbl[TEST_CFG_TBL_CRC_OFFSET + 3U] = (uint8_t)crc;
+
+    for (uint32_t idx = 0U; idx < TEST_CFG_TBL_GAIN_PARAM_SIZE; idx += 2U)
+    {
+        // 1000 per mille
+        p_tbl[TEST_CFG_TBL_GAIN_OFFSET + idx] = 0x03U;
+        p_tbl[TEST_CFG_TBL_GAIN_OFFSET + idx + 1U] = 0xE8U;
+    }
+
+    for (uint32_t idx = 0U; idx < TEST_CRC_AUDIO_SIZE; idx++)
+    {
+        p_audio[idx] = (uint8_t)((idx * 37U) + (idx >> 8U));
+    }
+}
+
+static void helper_crc_audio_play(void)
+{
+    api_data_read_StubWithCallback(test_api_data_read_flash_stub);
+
+    bsp_i2s_cb_set_StubWithCallback(test_bsp_i2s_cb_set_stub);
+    bsp_i2s_rate_set_IgnoreAndReturn(true);
+    bsp_i2s_ring_start_StubWithCallback(test_bsp_i2s_ring_start_stub);
+    bsp_i2s_ring_stop_IgnoreAndReturn(true);
+    bsp_i2s_slot_commit_StubWithCallback(test_bsp_i2s_slot_commit_stub);
+    bsp_i2s_silence_set_IgnoreAndReturn(true);
+    bsp_i2s_irq_cnt_get_IgnoreAndReturn(0U);
+    bsp_i2s_underrun_cnt_get_IgnoreAndReturn(0U);
+
+    api_data_cb_set_StubWithCallback(test_bsp_data_cb_set_stub);
+
+    drv_amplifier_diag_cb_set_Ignore();
+    drv_amplifier_rate_set_IgnoreAndReturn(true);
+    drv_amplifier_mute_IgnoreAndReturn(true);
+    drv_amplifier_unmute_IgnoreAndReturn(true);
+
+    drv_flash_is_busy_IgnoreAndReturn(false);
+
+    helper_api_audio_deinit_success();
+
+    TEST_ASSERT_EQUAL(true, api_audio_init());
+
+    api_audio_diag_reset();
+
+    m_test_ring_slot_size = 0U;
+
+    m_test_play_size = 0U;
+
+    // The audio is read once it is unmuted and played.
+    (void)api_audio_unmute();
+
+    (void)api_audio_play();
+
+    for (uint32_t idx = 0U; idx < TEST_CRC_PROCESS_CNT; idx++)
+    {
+        api_audio_process();
+
+        // A slot is played once the ring has been started.
+        if (0U != m_test_ring_slot_size)
+        {
+            m_test_audio_write_cb(BSP_I2S_TX_EMPTY);
+        }
+    }
+}
+
+static bool test_bsp_i2s_ring_start_stub(uint8_t *const *pp_slot,
+                                         uint32_t slot_cnt,
+                                         size_t slot_size,
+                                         int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    TEST_ASSERT_EQUAL(true, BSP_I2S_RING_SLOT_MAX >= slot_cnt);
+
+    m_test_ring_slot_size = slot_size;
+
+    // Each slot is filled before the ring is started.
+    for (uint32_t idx = 0U; idx < slot_cnt; idx++)
+    {
+        m_test_ring_slot[idx] = pp_slot[idx];
+
+        helper_ring_slot_record(idx);
+    }
+
+    return true;
+}
+
+static bool test_bsp_i2s_slot_commit_stub(uint32_t slot, int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    helper_ring_slot_record(slot);
+
+    return true;
+}
+
+static void helper_ring_slot_record(uint32_t slot)
+{
+    for (size_t idx = 0U; idx < m_test_ring_slot_size; idx++)
+    {
+        if (TEST_PCM_PLAY_SIZE > m_test_play_size)
+        {
+            m_test_play[m_test_play_size] = m_test_ring_slot[slot][idx];
+
+            m_test_play_size++;
+        }
+    }
+}
+
+static void helper_pcm_flash_set(uint32_t bit_depth)
+{
+    uint8_t *p_tbl = m_test_flash;
+
+    uint8_t *p_audio = &m_test_flash[TEST_API_DATA_AUDIO_CFG_TBL_SIZE];
+
+    uint32_t size = TEST_PCM_FRAME_CNT * 2U * (bit_depth / 8U);
+
+    helper_crc_flash_set(0U);
+
+    for (uint32_t idx = 0U; idx < (TEST_PCM_FRAME_CNT * 2U); idx++)
+    {
+        uint16_t sample = (uint16_t)((idx * 2731U) + ((idx & 1U) * 9000U));
+
+        // The 16-bit sample is the upper half of the 32-bit sample.
+        if (32U == bit_depth)
+        {
+            p_audio[(idx * 4U)] = 0U;
+            p_audio[(idx * 4U) + 1U] = 0U;
+            p_audio[(idx * 4U) + 2U] = (uint8_t)sample;
+            p_audio[(idx * 4U) + 3U] = (uint8_t)(sample >> 8U);
+        }
+        else
+        {
+            p_audio[(idx * 2U)] = (uint8_t)sample;
+            p_audio[(idx * 2U) + 1U] = (uint8_t)(sample >> 8U);
+        }
+    }
+
+    uint32_t crc = crc32_update(CRC32_INIT, p_audio, size);
+
+    p_tbl[TEST_CFG_TBL_SIZE_OFFSET + 2U] = (uint8_t)(size >> 8U);
+    p_tbl[TEST_CFG_TBL_SIZE_OFFSET + 3U] = (uint8_t)size;
+
+    p_tbl[TEST_CFG_TBL_BIT_DEPTH_OFFSET] = (uint8_t)bit_depth;
+    p_tbl[TEST_CFG_TBL_CH_CNT_OFFSET] = 2U;
+
+    p_tbl[TEST_CFG_TBL_CRC_OFFSET] = (uint8_t)(crc >> 24U);
+    p_tbl[TEST_CFG_TBL_CRC_OFFSET + 1U] = (uint8_t)(crc >> 16U);
+    p_tbl[TEST_CFG_TBL_CRC_OFFSET + 2U] = (uint8_t)(crc >> 8U);
+    p_tbl[TEST_CFG_TBL_CRC_OFFSET + 3U] = (uint8_t)crc;
+}
+
 static bool test_api_data_read(uint32_t data_label, 
                                uint8_t* p_data, 
                                size_t size, 
@@ -3227,6 +4095,24 @@ static bool test_bsp_data_cb_set_stub(api_data_cb_t callback,
     return true;
 }
 
+static bool test_api_data_audio_slot_get_stub(uint8_t audio,
+                                              uint32_t *p_label,
+                                              uint32_t *p_size,
+                                              int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    if (TEST_AUDIO_SLOT_CNT <= audio)
+    {
+        return false;
+    }
+
+    *p_label = (TEST_AUDIO_OFFSET * audio) + TEST_API_DATA_EEPROM_LAST_DATA;
+    *p_size = TEST_AUDIO_OFFSET;
+
+    return true;
+}
+
 static void helper_api_audio_run_state(void)
 {
     api_audio_process();
@@ -3247,6 +4133,8 @@ static void helper_api_audio_init_success(void)
 
     api_data_cb_set_StubWithCallback(test_bsp_data_cb_set_stub);
 
+    drv_amplifier_diag_cb_set_Ignore();
+
     (void)api_audio_init();
 }
 
@@ -3305,6 +4193,8 @@ static void helper_api_audio_init_with_stub_success(void)
 
     api_data_cb_set_StubWithCallback(test_bsp_data_cb_set_stub);
 
+    drv_amplifier_diag_cb_set_Ignore();
+
     (void)api_audio_init();
 }
 
@@ -0,0 +1,586 @@
+/**
+ * @file test_api_audio_mix.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the mixer layers, the standby layer and the two
+ *        block pipeline of the audio API module. The module is built with
+ *        AUDIO_CONF_BLOCK_CNT = 2, AUDIO_CONF_LAYER_CNT = 2 and
+ *        AUDIO_CONF_STANDBY = 1, see the defines of project.yml.
+ *
+ * @version 0.1
+ *
+ * @date 17/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "api_audio.h"
+
+#include <string.h>
+
+// Third - include the mocks of required modules
+#include "mock_api_data.h"
+#include "mock_bsp_i2s.h"
+#include "mock_bsp_mcu.h"
+#include "mock_drv_amplifier.h"
+#include "mock_drv_flash.h"
+
+#include "mock_log.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("api_audio.c");
+TEST_FILE("dsp_adpcm.c");
+TEST_FILE("dsp_biquad.c");
+TEST_FILE("dsp_chain.c");
+TEST_FILE("dsp_gain.c");
+TEST_FILE("dsp_limiter.c");
+TEST_FILE("dsp_osc.c");
+TEST_FILE("dsp_pcm.c");
+TEST_FILE("dsp_resampler.c");
+TEST_FILE("crc32.c");
+TEST_FILE("spsc_queue.c");
+
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the configuration table size of an audio slot.
+ *
+ */
+#define TEST_CFG_TBL_SIZE (500U)
+
+/**
+ * @brief This macro indicates the audio size offset in the configuration
+ *        table.
+ *
+ */
+#define TEST_CFG_TBL_SIZE_OFFSET (32U)
+
+/**
+ * @brief This macro indicates the gain table offset in the configuration
+ *        table.
+ *
+ */
+#define TEST_CFG_TBL_GAIN_OFFSET (100U)
+
+/**
+ * @brief This macro indicates the gain table size in the configuration table.
+ *
+ */
+#define TEST_CFG_TBL_GAIN_SIZE (200U)
+
+/**
+ * @brief This macro indicates the size of the 32-bit stereo audio of a slot.
+ *
+ */
+#define TEST_AUDIO_SIZE (2048U)
+
+/**
+ * @brief This macro indicates the External Flash size of an audio slot.
+ *
+ */
+#define TEST_AUDIO_SLOT_SIZE (TEST_CFG_TBL_SIZE + (500U * 1024U))
+
+/**
+ * @brief This macro indicates the audio slot count of the fixed layout.
+ *
+ */
+#define TEST_AUDIO_SLOT_CNT (3U)
+
+/**
+ * @brief This macro indicates the label of the first audio slot, it follows
+ *        the EEPROM labels.
+ *
+ */
+#define TEST_AUDIO_LABEL (API_DATA_LABEL_DID_HW_VER + 24U)
+
+/**
+ * @brief This macro indicates the DC sample of the audio of a slot.
+ *
+ */
+#define TEST_AUDIO_DC(slot) ((int32_t)((slot) + 1U) << 24)
+
+/**
+ * @brief This macro indicates the process call count of a play step.
+ *
+ */
+#define TEST_PROCESS_CNT (200U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/**
+ * @brief This variable is used to get the I2S function address.
+ *
+ */
+static bsp_i2s_cb_t m_test_audio_write_cb;
+
+/**
+ * @brief This array holds the ring slot addresses passed to the I2S.
+ *
+ */
+static int32_t *m_test_ring_slot[BSP_I2S_RING_SLOT_MAX];
+
+/**
+ * @brief This variable holds whether the ring has been started.
+ *
+ */
+static bool m_test_ring_run;
+
+/**
+ * @brief This variable holds the ring stop count.
+ *
+ */
+static uint32_t m_test_ring_stop_cnt;
+
+/**
+ * @brief This variable holds the first left sample of the last committed
+ *        slot.
+ *
+ */
+static int32_t m_test_out;
+
+/*******************************************************************************
+ * Private Functions Prototype Declarations
+ ******************************************************************************/
+
+/**
+ * @brief This stub function is used instead of I2S callback set function.
+ *
+ */
+static bool test_bsp_i2s_cb_set_stub(bsp_i2s_cb_t callback,
+                                     int cmock_num_calls);
+
+/**
+ * @brief This stub function records the ring slots of the I2S.
+ *
+ */
+static bool test_bsp_i2s_ring_start_stub(uint8_t *const *pp_slot,
+                                         uint32_t slot_cnt,
+                                         size_t slot_size,
+                                         int cmock_num_calls);
+
+/**
+ * @brief This stub function counts the ring stops.
+ *
+ */
+static bool test_bsp_i2s_ring_stop_stub(int cmock_num_calls);
+
+/**
+ * @brief This stub function records the output of a committed ring slot.
+ *
+ */
+static bool test_bsp_i2s_slot_commit_stub(uint32_t slot, int cmock_num_calls);
+
+/**
+ * @brief This stub function resolves the audio slots of the fixed layout.
+ *
+ */
+static bool test_api_data_audio_slot_get_stub(uint8_t audio,
+                                              uint32_t *p_label,
+                                              uint32_t *p_size,
+                                              int cmock_num_calls);
+
+/**
+ * @brief This stub function reads the External Flash image. Each slot holds
+ *        a DC audio of TEST_AUDIO_DC(slot), the EEPROM reads give zeros.
+ *
+ */
+static bool test_api_data_read_stub(uint32_t data_label,
+                                    uint8_t *p_data,
+                                    size_t size,
+                                    uint32_t offset,
+                                    int cmock_num_calls);
+
+/**
+ * @brief This helper function returns a byte of the External Flash image.
+ *
+ */
+static uint8_t helper_flash_byte_get(uint32_t addr);
+
+/**
+ * @brief This helper function initializes and plays the audio of the first
+ *        slot.
+ *
+ */
+static void helper_api_audio_play(void);
+
+/**
+ * @brief This helper function runs the pipeline, a ring slot is played after
+ *        each process call.
+ *
+ */
+static void helper_api_audio_run(void);
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+    log_print_Ignore();
+
+    bsp_mcu_tick_get_IgnoreAndReturn(0U);
+
+    api_data_audio_slot_cnt_get_IgnoreAndReturn(TEST_AUDIO_SLOT_CNT);
+    api_data_audio_slot_get_StubWithCallback(test_api_data_audio_slot_get_stub);
+    api_data_read_StubWithCallback(test_api_data_read_stub);
+    api_data_cb_set_IgnoreAndReturn(true);
+    api_data_dtc_set_IgnoreAndReturn(true);
+
+    bsp_i2s_cb_set_StubWithCallback(test_bsp_i2s_cb_set_stub);
+    bsp_i2s_rate_set_IgnoreAndReturn(true);
+    bsp_i2s_ring_start_StubWithCallback(test_bsp_i2s_ring_start_stub);
+    bsp_i2s_ring_stop_StubWithCallback(test_bsp_i2s_ring_stop_stub);
+    bsp_i2s_slot_commit_StubWithCallback(test_bsp_i2s_slot_commit_stub);
+    bsp_i2s_silence_set_IgnoreAndReturn(true);
+    bsp_i2s_irq_cnt_get_IgnoreAndReturn(0U);
+    bsp_i2s_underrun_cnt_get_IgnoreAndReturn(0U);
+
+    drv_amplifier_diag_cb_set_Ignore();
+    drv_amplifier_rate_set_IgnoreAndReturn(true);
+    drv_amplifier_mute_IgnoreAndReturn(true);
+    drv_amplifier_unmute_IgnoreAndReturn(true);
+
+    drv_flash_is_busy_IgnoreAndReturn(false);
+
+    m_test_ring_run = false;
+    m_test_ring_stop_cnt = 0U;
+    m_test_out = 0;
+}
+
+void tearDown()
+{
+    api_audio_deinit();
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the api_audio_layer_set and api_audio_layer_stop
+ * functions mix the audio of a layer into the output and take it out again.
+ *
+ */
+void test_api_audio_layer_set__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    int32_t test_out_solo = 0;
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_play();
+
+    test_out_solo = m_test_out;
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_NOT_EQUAL(0, test_out_solo);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, api_audio_layer_set(1U, 1U, 1000U));
+
+    helper_api_audio_run();
+
+    TEST_ASSERT_GREATER_THAN_INT32(test_out_solo, m_test_out);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(true, api_audio_layer_stop(1U));
+
+    helper_api_audio_run();
+
+    TEST_ASSERT_EQUAL_INT32(test_out_solo, m_test_out);
+}
+
+/**
+ * @brief The test verifies the api_audio_layer_set and api_audio_layer_stop
+ * functions refuse layer 0 and a layer above the layer count.
+ *
+ */
+void test_api_audio_layer_set__when_use_invalid_layer__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_play();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, api_audio_layer_set(0U, 1U, 1000U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, api_audio_layer_set(2U, 1U, 1000U));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, api_audio_layer_set(1U,
+                                                 TEST_AUDIO_SLOT_CNT,
+                                                 1000U));
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(false, api_audio_layer_stop(0U));
+
+    TEST_STEP(5);
+    TEST_ASSERT_EQUAL(false, api_audio_layer_stop(2U));
+}
+
+/**
+ * @brief The test verifies the api_audio_switch function swaps in the audio
+ * loaded by api_audio_prefetch without stopping the ring. The audio being
+ * loaded is not loaded again.
+ *
+ */
+void test_api_audio_prefetch__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    api_audio_diag_t diag = {0U};
+
+    int32_t test_out_old = 0;
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_play();
+
+    test_out_old = m_test_out;
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, api_audio_standby_get());
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, api_audio_prefetch(2U));
+    TEST_ASSERT_EQUAL(true, api_audio_prefetch(2U));
+
+    helper_api_audio_run();
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(true, api_audio_switch(2U));
+
+    helper_api_audio_run();
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(true, api_audio_diag_get(&diag));
+    TEST_ASSERT_EQUAL_UINT32(1U, diag.switch_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1U, diag.switch_fast_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0U, m_test_ring_stop_cnt);
+
+    TEST_STEP(5);
+    TEST_ASSERT_GREATER_THAN_INT32(test_out_old, m_test_out);
+}
+
+/**
+ * @brief The test verifies the api_audio_prefetch function refuses an audio
+ * number above the slot count.
+ *
+ */
+void test_api_audio_prefetch__when_use_invalid_audio__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_api_audio_play();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, api_audio_prefetch(TEST_AUDIO_SLOT_CNT));
+}
+
+/*******************************************************************************
+ * Private Functions Definitions
+ ******************************************************************************/
+
+static bool test_bsp_i2s_cb_set_stub(bsp_i2s_cb_t callback, int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    m_test_audio_write_cb = callback;
+
+    return true;
+}
+
+static bool test_bsp_i2s_ring_start_stub(uint8_t *const *pp_slot,
+                                         uint32_t slot_cnt,
+                                         size_t slot_size,
+                                         int cmock_num_calls)
+{
+    (void)slot_size;
+    (void)cmock_num_calls;
+
+    TEST_ASSERT_EQUAL(true, BSP_I2S_RING_SLOT_MAX >= slot_cnt);
+
+    for (uint32_t idx = 0U; idx < slot_cnt; idx++)
+    {
+        // PRQA S 0310, 3305 ++ # The ring slots are declared as 32-bit words.
+        m_test_ring_slot[idx] = (int32_t *)pp_slot[idx];
+        // PRQA S 0310, 3305 --
+    }
+
+    m_test_ring_run = true;
+
+    return true;
+}
+
+static bool test_bsp_i2s_ring_stop_stub(int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    m_test_ring_run = false;
+
+    m_test_ring_stop_cnt++;
+
+    return true;
+}
+
+static bool test_bsp_i2s_slot_commit_stub(uint32_t slot, int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    m_test_out = m_test_ring_slot[slot][0U];
+
+    return true;
+}
+
+static bool test_api_data_audio_slot_get_stub(uint8_t audio,
+                                              uint32_t *p_label,
+                                              uint32_t *p_size,
+                                              int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    if (TEST_AUDIO_SLOT_CNT <= audio)
+    {
+        return false;
+    }
+
+    *p_label = (TEST_AUDIO_SLOT_SIZE * audio) + TEST_AUDIO_LABEL;
+    *p_size = TEST_AUDIO_SLOT_SIZE;
+
+    return true;
+}
+
+static bool test_api_data_read_stub(uint32_t data_label,
+                                    uint8_t *p_data,
+                                    size_t size,
+                                    uint32_t offset,
+                                    int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    (void)memset(p_data, 0, size);
+
+    if (TEST_AUDIO_LABEL > data_label)
+    {
+        return true;
+    }
+
+    uint32_t addr = (data_label - TEST_AUDIO_LABEL) + offset;
+
+    for (size_t idx = 0U; idx < size; idx++)
+    {
+        p_data[idx] = helper_flash_byte_get(addr + idx);
+    }
+
+    return true;
+}
+
+static uint8_t helper_flash_byte_get(uint32_t addr)
+{
+    uint32_t slot = addr / TEST_AUDIO_SLOT_SIZE;
+
+    uint32_t pos = addr % TEST_AUDIO_SLOT_SIZE;
+
+    if (TEST_CFG_TBL_SIZE > pos)
+    {
+        // The sizes of the table are big-endian, the gains are 1000 per mille.
+        if ((TEST_CFG_TBL_SIZE_OFFSET + 2U) == pos)
+        {
+            return (uint8_t)(TEST_AUDIO_SIZE >> 8U);
+        }
+
+        if ((TEST_CFG_TBL_GAIN_OFFSET <= pos) &&
+            ((TEST_CFG_TBL_GAIN_OFFSET + TEST_CFG_TBL_GAIN_SIZE) > pos))
+        {
+            return (0U == ((pos - TEST_CFG_TBL_GAIN_OFFSET) & 1U)) ? 0x03U
+                                                                   : 0xE8U;
+        }
+
+        return 0U;
+    }
+
+    pos -= TEST_CFG_TBL_SIZE;
+
+    if (TEST_AUDIO_SIZE <= pos)
+    {
+        return 0U;
+    }
+
+    // The 32-bit samples are little-endian.
+    uint32_t sample = (uint32_t)TEST_AUDIO_DC(slot);
+
+    return (uint8_t)(sample >> ((pos & 3U) * 8U));
+}
+
+static void helper_api_audio_play(void)
+{
+    TEST_ASSERT_EQUAL(true, api_audio_init());
+
+    (void)api_audio_unmute();
+
+    (void)api_audio_play();
+
+    helper_api_audio_run();
+
+    TEST_ASSERT_EQUAL(true, m_test_ring_run);
+}
+
+static void helper_api_audio_run(void)
+{
+    for (uint32_t idx = 0U; idx < TEST_PROCESS_CNT; idx++)
+    {
+        api_audio_process();
+
+        // A slot is played once the ring has been started.
+        if (true == m_test_ring_run)
+        {
+            m_test_audio_write_cb(BSP_I2S_TX_EMPTY);
+        }
+    }
+}
+
+// end of file
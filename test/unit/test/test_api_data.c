@@ -391,7 +391,20 @@ TEST_FILE("api_data.c");
  * 
  */
 #define TEST_API_DATA_FLASH_LAST_DATA \
-    (TEST_API_DATA_LABEL_AUDIO_3 + TEST_API_DATA_AUDIO_DEFAULT_SIZE)
+    (TEST_API_DATA_EEPROM_LAST_DATA + (2048U * 1024U))
+
+/**
+ * @brief This macro indicates the read size of the audio directory.
+ *
+ */
+#define TEST_AUDIO_DIR_SIZE (8U + (4U * 32U))
+
+/**
+ * @brief This macro indicates the size of a slot of the fixed layout.
+ *
+ */
+#define TEST_AUDIO_SLOT_LEGACY_SIZE \
+    (TEST_API_DATA_AUDIO_CFG_TBL_SIZE + TEST_API_DATA_AUDIO_DEFAULT_SIZE)
 
 /*******************************************************************************
  * Private Functions Prototype Declarations
@@ -406,6 +419,12 @@ static void helper_flash_init(void);
 */
 static void helper_flash_init_with_fail(void);
 
+/**
+ * @brief This helper function expects the audio directory read of the
+ * initialization. The directory is left empty when p_dir is NULL.
+*/
+static void helper_audio_dir_read(const uint8_t *p_dir);
+
 /**
  * @brief This test function for using as the callback.
 */
@@ -498,6 +517,7 @@ void test_api_data_init__usual_run__success(void)
     int8_t test_cnt = 5;
 
     drv_flash_init_ExpectAndReturn(true);
+    helper_audio_dir_read(NULL);
     bsp_eeprom_read_StubWithCallback(test_bsp_eeprom_read_stub);
 
     for(int8_t cnt = 0; cnt < test_cnt; cnt++)
@@ -563,6 +583,7 @@ void test_api_data_init__when_default_set_fail__fail(void)
     uint8_t test_delay = 10U;
 
     drv_flash_init_ExpectAndReturn(true);
+    helper_audio_dir_read(NULL);
 
     const uint32_t max_try_cnt = 10U;
     uint32_t try_idx;
@@ -618,6 +639,7 @@ void test_api_data_init__when_default_set_success__success(void)
     uint8_t test_delay = 10U;
 
     drv_flash_init_ExpectAndReturn(true);
+    helper_audio_dir_read(NULL);
 
     const uint32_t max_try_cnt = 10U;
     uint32_t try_idx;
@@ -1010,6 +1032,46 @@ void test_api_data_read__when_ext_flash_read_err__fail(void)
     TEST_ASSERT_EQUAL(false, ret);
 }
 
+/**
+ * @brief Verifies the api_data_read function does not read the external flash
+ * when the read starts in the external flash and ends after it.
+ *
+ */
+void test_api_data_read__external_flash_end_limit__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // The last two bytes of the external flash are followed by two more.
+    uint32_t data_label = TEST_API_DATA_FLASH_LAST_DATA - 2U;
+
+    uint8_t data[4U] = {0U};
+
+    size_t size = sizeof(data);
+    uint32_t offset = 0U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    log_comm_Ignore();
+
+    helper_flash_init();
+
+    // ************************** Expected Calls **************************** //
+
+    // The flash is not read, the limit access error is logged. The read error
+    // is not logged again before its timeout.
+    bsp_mcu_tick_get_ExpectAndReturn(0U);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_data_read(data_label, data, size, offset);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
 /**
  * @brief Verifies the api_data_read function with an invalid data argument. 
  * 
@@ -1423,12 +1485,34 @@ void test_api_data_dtc_set__usual_run__success(void)
     TEST_CASE();
 
     // **************************** Input Params **************************** //
-    uint32_t data_label = TEST_API_DATA_EEPROM_LAST_DATA + 1U;
-    uint32_t dtc = 1U;
+    uint32_t data_label = TEST_API_DATA_LABEL_DTC_CSUM_FAIL;
+    uint32_t dtc = 0x00C1D2E3U;
+
+    // Vehicle speed, trans gear and current gear in the EEPROM.
+    uint8_t state[TEST_API_DATA_BYTE_4] = {0x34U, 0x12U, 0x02U, 0x03U};
+
+    uint8_t record[TEST_API_DATA_DTC_SIZE] = {
+        0xE3U, 0xD2U, 0xC1U, 0x00U, 0x34U, 0x12U, 0x02U, 0x03U
+    };
     // **************************** Pre-Actions ***************************** //
 
+    log_comm_Ignore();
+
     // ************************** Expected Calls **************************** //
 
+    bsp_eeprom_read_ExpectAndReturn(TEST_API_DATA_LABEL_CAR_SPEED,
+                                    NULL,
+                                    TEST_API_DATA_BYTE_4,
+                                    BSP_EEPROM_STATUS_SUCCESS);
+    bsp_eeprom_read_IgnoreArg_p_data();
+    bsp_eeprom_read_ReturnArrayThruPtr_p_data(state, TEST_API_DATA_BYTE_4);
+
+    bsp_eeprom_write_ExpectWithArrayAndReturn(data_label,
+                                              record,
+                                              TEST_API_DATA_DTC_SIZE,
+                                              TEST_API_DATA_DTC_SIZE,
+                                              BSP_EEPROM_STATUS_SUCCESS);
+
     // **************************** Test Steps ****************************** //
 
     TEST_STEP(1);
@@ -1438,6 +1522,79 @@ void test_api_data_dtc_set__usual_run__success(void)
     TEST_ASSERT_EQUAL(true, ret);
 }
 
+/**
+ * @brief Verifies the api_data_dtc_set function stores the DTC number with a
+ * zero vehicle state when the vehicle state can not be read.
+ *
+ */
+void test_api_data_dtc_set__when_state_read_fail__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+    uint32_t data_label = TEST_API_DATA_LABEL_DTC_SPKR_1_OC;
+    uint32_t dtc = 0x00C1D2E3U;
+
+    uint8_t record[TEST_API_DATA_DTC_SIZE] = {
+        0xE3U, 0xD2U, 0xC1U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U
+    };
+    // **************************** Pre-Actions ***************************** //
+
+    log_comm_Ignore();
+
+    // ************************** Expected Calls **************************** //
+
+    bsp_eeprom_read_ExpectAndReturn(TEST_API_DATA_LABEL_CAR_SPEED,
+                                    NULL,
+                                    TEST_API_DATA_BYTE_4,
+                                    BSP_EEPROM_STATUS_ERR);
+    bsp_eeprom_read_IgnoreArg_p_data();
+
+    bsp_eeprom_write_ExpectWithArrayAndReturn(data_label,
+                                              record,
+                                              TEST_API_DATA_DTC_SIZE,
+                                              TEST_API_DATA_DTC_SIZE,
+                                              BSP_EEPROM_STATUS_SUCCESS);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_data_dtc_set(data_label, dtc);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, ret);
+}
+
+/**
+ * @brief Verifies the api_data_dtc_set function with a label that is not a
+ * DTC label.
+ *
+ */
+void test_api_data_dtc_set__when_use_invalid_label_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+    uint32_t dtc = 1U;
+    // **************************** Pre-Actions ***************************** //
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = api_data_dtc_set(TEST_API_DATA_EEPROM_LAST_DATA + 1U, dtc);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, ret);
+
+    TEST_STEP(3);
+    ret = api_data_dtc_set(TEST_API_DATA_LABEL_DTC_SPKR_1_OC + 1U, dtc);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
 /**
  * @brief Verifies the api_data_dtc_set function with an invalid DTC argument.
  * 
@@ -1466,6 +1623,226 @@ void test_api_data_dtc_set__when_use_invalid_dtc_argument__fail(void)
     TEST_ASSERT_EQUAL(false, ret);
 }
 
+/**
+ * @brief Verifies the api_data_audio_slot_get function gives the fixed slots
+ * when the external flash has no audio directory.
+ *
+ */
+void test_api_data_audio_slot_get__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t label = 0U;
+    uint32_t size = 0U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    log_comm_Ignore();
+
+    helper_flash_init();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(3U, api_data_audio_slot_cnt_get());
+
+    TEST_STEP(2);
+    bool ret = api_data_audio_slot_get(2U, &label, &size);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(true, ret);
+    TEST_ASSERT_EQUAL(TEST_API_DATA_LABEL_AUDIO_3_CFG, label);
+    TEST_ASSERT_EQUAL(TEST_AUDIO_SLOT_LEGACY_SIZE, size);
+}
+
+/**
+ * @brief Verifies the api_data_audio_slot_get function resolves the slots of
+ * the audio directory.
+ *
+ */
+void test_api_data_audio_slot_get__when_audio_dir_exist__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint8_t dir[TEST_AUDIO_DIR_SIZE] = {
+
+        0x41U, 0x44U, 0x49U, 0x52U, 4U, 0U, 0U, 0U,
+        0x00U, 0x01U, 0x00U, 0x02U,
+        0x00U, 0x03U, 0x00U, 0x80U,
+        0x00U, 0x83U, 0x01U, 0x00U,
+        0x01U, 0x83U, 0x00U, 0x7DU,
+    };
+
+    uint32_t label = 0U;
+    uint32_t size = 0U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    log_comm_Ignore();
+
+    // ************************** Expected Calls **************************** //
+
+    drv_flash_init_ExpectAndReturn(true);
+    helper_audio_dir_read(dir);
+    bsp_eeprom_read_StubWithCallback(test_bsp_eeprom_read_stub);
+    bsp_mcu_delay_Ignore();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    (void)api_data_init();
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(4U, api_data_audio_slot_cnt_get());
+
+    TEST_STEP(3);
+    bool ret = api_data_audio_slot_get(2U, &label, &size);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(true, ret);
+    TEST_ASSERT_EQUAL(TEST_API_DATA_EEPROM_LAST_DATA + (0x83U * 4096U), label);
+    TEST_ASSERT_EQUAL(0x100U * 4096U, size);
+
+    TEST_STEP(5);
+    ret = api_data_audio_slot_get(3U, &label, &size);
+
+    TEST_STEP(6);
+    TEST_ASSERT_EQUAL(true, ret);
+    TEST_ASSERT_EQUAL(TEST_API_DATA_EEPROM_LAST_DATA + (0x183U * 4096U), label);
+    TEST_ASSERT_EQUAL(0x7DU * 4096U, size);
+}
+
+/**
+ * @brief Verifies the api_data_init function keeps the fixed slots when a slot
+ * of the audio directory is out of the external flash.
+ *
+ */
+void test_api_data_audio_slot_cnt_get__when_audio_dir_invalid__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint8_t dir[TEST_AUDIO_DIR_SIZE] = {
+
+        0x41U, 0x44U, 0x49U, 0x52U, 2U, 0U, 0U, 0U,
+        0x00U, 0x01U, 0x00U, 0x02U,
+        0x01U, 0xF0U, 0x00U, 0x20U,
+    };
+
+    // **************************** Pre-Actions ***************************** //
+
+    log_comm_Ignore();
+
+    // ************************** Expected Calls **************************** //
+
+    drv_flash_init_ExpectAndReturn(true);
+    helper_audio_dir_read(dir);
+    bsp_eeprom_read_StubWithCallback(test_bsp_eeprom_read_stub);
+    bsp_mcu_delay_Ignore();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    (void)api_data_init();
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(3U, api_data_audio_slot_cnt_get());
+}
+
+/**
+ * @brief Verifies the api_data_init function reads the audio directory when
+ * the tick wraps during the read.
+ *
+ */
+void test_api_data_audio_slot_cnt_get__when_tick_wraps__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint8_t dir[TEST_AUDIO_DIR_SIZE] = {
+
+        0x41U, 0x44U, 0x49U, 0x52U, 4U, 0U, 0U, 0U,
+        0x00U, 0x01U, 0x00U, 0x02U,
+        0x00U, 0x03U, 0x00U, 0x80U,
+        0x00U, 0x83U, 0x01U, 0x00U,
+        0x01U, 0x83U, 0x00U, 0x7DU,
+    };
+
+    // **************************** Pre-Actions ***************************** //
+
+    log_comm_Ignore();
+
+    // ************************** Expected Calls **************************** //
+
+    drv_flash_init_ExpectAndReturn(true);
+
+    drv_flash_read_ExpectAndReturn(0U, NULL, TEST_AUDIO_DIR_SIZE, true);
+    drv_flash_read_IgnoreArg_p_data();
+    drv_flash_read_ReturnArrayThruPtr_p_data(dir, TEST_AUDIO_DIR_SIZE);
+
+    // The read starts 16 ms before the tick wraps and ends 32 ms later.
+    bsp_mcu_tick_get_ExpectAndReturn(0xFFFFFFF0U);
+    drv_flash_is_busy_ExpectAndReturn(true);
+    bsp_mcu_tick_get_ExpectAndReturn(0xFFFFFFF8U);
+    drv_flash_process_Expect();
+    drv_flash_is_busy_ExpectAndReturn(true);
+    bsp_mcu_tick_get_ExpectAndReturn(0x00000010U);
+    drv_flash_process_Expect();
+    drv_flash_is_busy_ExpectAndReturn(false);
+
+    bsp_eeprom_read_StubWithCallback(test_bsp_eeprom_read_stub);
+    bsp_mcu_delay_Ignore();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    (void)api_data_init();
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(4U, api_data_audio_slot_cnt_get());
+}
+
+/**
+ * @brief Verifies the api_data_audio_slot_get function with invalid arguments.
+ *
+ */
+void test_api_data_audio_slot_get__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t label = 0U;
+    uint32_t size = 0U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    log_comm_Ignore();
+
+    helper_flash_init();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, api_data_audio_slot_get(3U, &label, &size));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, api_data_audio_slot_get(0U, NULL, &size));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, api_data_audio_slot_get(0U, &label, NULL));
+}
+
 /*******************************************************************************
  * Private Functions Definitions
  ******************************************************************************/
@@ -1475,6 +1852,7 @@ static void helper_flash_init()
     uint8_t test_delay = 10U;
 
     drv_flash_init_ExpectAndReturn(true);
+    helper_audio_dir_read(NULL);
 
     const uint32_t max_try_cnt = 10U;
     uint32_t try_idx;
@@ -1496,6 +1874,20 @@ static void helper_flash_init()
     (void)api_data_init();
 }
 
+static void helper_audio_dir_read(const uint8_t *p_dir)
+{
+    drv_flash_read_ExpectAndReturn(0U, NULL, TEST_AUDIO_DIR_SIZE, true);
+    drv_flash_read_IgnoreArg_p_data();
+
+    if (NULL != p_dir)
+    {
+        drv_flash_read_ReturnArrayThruPtr_p_data(p_dir, TEST_AUDIO_DIR_SIZE);
+    }
+
+    bsp_mcu_tick_get_ExpectAndReturn(0U);
+    drv_flash_is_busy_ExpectAndReturn(false);
+}
+
 static void helper_flash_init_with_fail()
 {
     drv_flash_init_ExpectAndReturn(false);
@@ -0,0 +1,523 @@
+/**
+ * @file test_app_avas.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the AVAS application module.
+ *
+ * @version 0.1
+ *
+ * @date 17/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "app_avas.h"
+
+// Third - include the mocks of required modules
+#include "mock_api_audio.h"
+#include "mock_api_data.h"
+#include "mock_appman.h"
+#include "mock_bsp_mcu.h"
+
+#include "mock_log.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("app_avas.c");
+
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the ignition status value of the ignition off.
+ *
+ */
+#define TEST_AVAS_IGN_OFF (0U)
+
+/**
+ * @brief This macro indicates the ignition status value of the ignition on.
+ *
+ */
+#define TEST_AVAS_IGN_ON (1U)
+
+/**
+ * @brief This macro indicates the calibrated reverse gear value.
+ *
+ */
+#define TEST_AVAS_REVERSE_GEAR (2U)
+
+/**
+ * @brief This macro indicates the calibrated reverse audio.
+ *
+ */
+#define TEST_AVAS_REVERSE_AUDIO (1U)
+
+/**
+ * @brief This macro indicates a transmission gear value other than the
+ *        reverse.
+ *
+ */
+#define TEST_AVAS_DRIVE_GEAR (1U)
+
+/**
+ * @brief This macro indicates the audio slot count.
+ *
+ */
+#define TEST_AVAS_AUDIO_SLOT_CNT (3U)
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief The data structure corresponds to the AVAS application's message
+ *        pool.
+ *
+ */
+typedef struct test_avas_msg_pool_s
+{
+    appman_msg_id_t msg_id;
+    appman_app_id_t app_id;
+    void *p_data;
+    size_t size;
+
+} test_avas_msg_pool_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/**
+ * @brief Holds the play status of the audio.
+ *
+ */
+static bool m_test_audio_play = false;
+
+/**
+ * @brief Holds the run state of the audio, it is kept on a pause.
+ *
+ */
+static bool m_test_audio_run = false;
+
+/**
+ * @brief Holds the last switched audio.
+ *
+ */
+static uint8_t m_test_audio_num = 0xFFU;
+
+/**
+ * @brief Holds the last prefetched audio.
+ *
+ */
+static uint8_t m_test_prefetch_num = 0xFFU;
+
+/**
+ * @brief Holds the prefetch call count.
+ *
+ */
+static uint32_t m_test_prefetch_cnt = 0U;
+
+/*******************************************************************************
+ * Private Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief This stub function is used instead of the audio play process. The
+ *        audio is only started once, a paused audio is resumed with false.
+ *
+ */
+static bool test_api_audio_play_stub(int cmock_num_calls);
+
+/**
+ * @brief This stub function is used instead of the audio pause process.
+ *
+ */
+static bool test_api_audio_pause_stub(int cmock_num_calls);
+
+/**
+ * @brief This stub function is used instead of the audio status process.
+ *
+ */
+static bool test_api_audio_status_get_stub(int cmock_num_calls);
+
+/**
+ * @brief This stub function is used instead of the audio switch process.
+ *
+ */
+static bool test_api_audio_switch_stub(uint8_t audio_num, int cmock_num_calls);
+
+/**
+ * @brief This stub function is used instead of the audio prefetch process.
+ *        The first prefetch fails, the next ones are successful.
+ *
+ */
+static bool test_api_audio_prefetch_stub(uint8_t audio_num,
+                                         int cmock_num_calls);
+
+/**
+ * @brief This stub function is used instead of the data read process. It
+ *        returns the reverse sound calibration.
+ *
+ */
+static bool test_api_data_read_calib_stub(uint32_t data_label,
+                                          uint8_t *p_data,
+                                          size_t size,
+                                          uint32_t offset,
+                                          int cmock_num_calls);
+
+/**
+ * @brief This helper function is used for the AVAS initialization.
+ *
+ */
+static void helper_app_avas_init_success(void);
+
+/**
+ * @brief This helper function is used to send the ignition status message.
+ *
+ */
+static void helper_app_avas_ign_send(uint8_t ign);
+
+/**
+ * @brief This helper function is used to send the transmission gear message.
+ *
+ */
+static void helper_app_avas_gear_send(uint8_t gear);
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+void setUp()
+{
+    log_print_Ignore();
+
+    appman_timer_create_Ignore();
+    appman_timer_start_Ignore();
+    appman_timer_stop_Ignore();
+
+    api_data_read_IgnoreAndReturn(false);
+
+    api_audio_init_IgnoreAndReturn(true);
+    api_audio_deinit_Ignore();
+    api_audio_mute_IgnoreAndReturn(true);
+    api_audio_unmute_IgnoreAndReturn(true);
+    api_audio_switch_StubWithCallback(test_api_audio_switch_stub);
+    api_audio_prefetch_IgnoreAndReturn(true);
+    api_audio_standby_get_IgnoreAndReturn(true);
+
+    api_audio_play_StubWithCallback(test_api_audio_play_stub);
+    api_audio_pause_StubWithCallback(test_api_audio_pause_stub);
+    api_audio_status_get_StubWithCallback(test_api_audio_status_get_stub);
+
+    m_test_audio_play = false;
+    m_test_audio_run = false;
+    m_test_audio_num = 0xFFU;
+    m_test_prefetch_num = 0xFFU;
+    m_test_prefetch_cnt = 0U;
+}
+
+void tearDown()
+{
+    app_avas_deinit();
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/**
+ * @brief The test verifies the app_avas_msg_handler function when the
+ * ignition goes off, on and off again. The sound is paused, resumed and
+ * paused again.
+ *
+ */
+void test_app_avas_msg_handler__ign_off_on_off__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_app_avas_init_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    helper_app_avas_ign_send(TEST_AVAS_IGN_OFF);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, m_test_audio_play);
+
+    TEST_STEP(3);
+    helper_app_avas_ign_send(TEST_AVAS_IGN_ON);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(true, m_test_audio_play);
+
+    TEST_STEP(5);
+    helper_app_avas_ign_send(TEST_AVAS_IGN_OFF);
+
+    TEST_STEP(6);
+    TEST_ASSERT_EQUAL(false, m_test_audio_play);
+}
+
+/**
+ * @brief The test verifies the app_avas_msg_handler function when the reverse
+ * gear and its audio are calibrated. The reverse audio is played in the
+ * reverse gear only.
+ *
+ */
+void test_app_avas_msg_handler__reverse_gear_calib__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    api_data_read_StubWithCallback(test_api_data_read_calib_stub);
+
+    api_data_audio_slot_cnt_get_IgnoreAndReturn(TEST_AVAS_AUDIO_SLOT_CNT);
+
+    helper_app_avas_init_success();
+
+    helper_app_avas_ign_send(TEST_AVAS_IGN_ON);
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    helper_app_avas_gear_send(TEST_AVAS_REVERSE_GEAR);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(TEST_AVAS_REVERSE_AUDIO, m_test_audio_num);
+
+    TEST_STEP(3);
+    helper_app_avas_gear_send(TEST_AVAS_DRIVE_GEAR);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(API_AUDIO_1, m_test_audio_num);
+}
+
+/**
+ * @brief The test verifies the app_avas_msg_handler function when the reverse
+ * gear is not calibrated. The selected audio is played in each gear.
+ *
+ */
+void test_app_avas_msg_handler__reverse_gear_not_calib__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_app_avas_init_success();
+
+    helper_app_avas_ign_send(TEST_AVAS_IGN_ON);
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    helper_app_avas_gear_send(TEST_AVAS_REVERSE_GEAR);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(API_AUDIO_1, m_test_audio_num);
+
+    TEST_STEP(3);
+    helper_app_avas_gear_send(TEST_AVAS_DRIVE_GEAR);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(API_AUDIO_1, m_test_audio_num);
+}
+
+/**
+ * @brief The test verifies the app_avas_run function when the prefetch of the
+ * audio of the next sound profile fails. The prefetch is retried by the next
+ * run and is not retried once it is successful.
+ *
+ */
+void test_app_avas_run__when_prefetch_fail__retry(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    api_data_read_StubWithCallback(test_api_data_read_calib_stub);
+
+    api_data_audio_slot_cnt_get_IgnoreAndReturn(TEST_AVAS_AUDIO_SLOT_CNT);
+
+    api_audio_prefetch_StubWithCallback(test_api_audio_prefetch_stub);
+
+    api_audio_name_get_IgnoreAndReturn(false);
+    api_audio_process_Ignore();
+
+    helper_app_avas_init_success();
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    helper_app_avas_ign_send(TEST_AVAS_IGN_ON);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(API_AUDIO_1, m_test_audio_num);
+    TEST_ASSERT_EQUAL(TEST_AVAS_REVERSE_AUDIO, m_test_prefetch_num);
+    TEST_ASSERT_EQUAL_UINT32(1U, m_test_prefetch_cnt);
+
+    TEST_STEP(3);
+    app_avas_run();
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(TEST_AVAS_REVERSE_AUDIO, m_test_prefetch_num);
+    TEST_ASSERT_EQUAL_UINT32(2U, m_test_prefetch_cnt);
+
+    TEST_STEP(5);
+    app_avas_run();
+
+    TEST_STEP(6);
+    TEST_ASSERT_EQUAL_UINT32(2U, m_test_prefetch_cnt);
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static bool test_api_audio_play_stub(int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    m_test_audio_play = true;
+
+    if (true == m_test_audio_run)
+    {
+        return false;
+    }
+
+    m_test_audio_run = true;
+
+    return true;
+}
+
+static bool test_api_audio_pause_stub(int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    m_test_audio_play = false;
+
+    return true;
+}
+
+static bool test_api_audio_status_get_stub(int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    return m_test_audio_play;
+}
+
+static bool test_api_audio_switch_stub(uint8_t audio_num, int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    m_test_audio_num = audio_num;
+
+    return true;
+}
+
+static bool test_api_audio_prefetch_stub(uint8_t audio_num,
+                                         int cmock_num_calls)
+{
+    m_test_prefetch_num = audio_num;
+
+    m_test_prefetch_cnt++;
+
+    return (0 != cmock_num_calls);
+}
+
+static bool test_api_data_read_calib_stub(uint32_t data_label,
+                                          uint8_t *p_data,
+                                          size_t size,
+                                          uint32_t offset,
+                                          int cmock_num_calls)
+{
+    (void)size;
+    (void)offset;
+    (void)cmock_num_calls;
+
+    if (API_DATA_LABEL_REVERSE_GEAR == data_label)
+    {
+        *p_data = TEST_AVAS_REVERSE_GEAR;
+    }
+    else if (API_DATA_LABEL_REVERSE_AUDIO == data_label)
+    {
+        *p_data = TEST_AVAS_REVERSE_AUDIO;
+    }
+    else
+    {
+        *p_data = API_AUDIO_1;
+    }
+
+    return true;
+}
+
+static void helper_app_avas_init_success(void)
+{
+    app_avas_init();
+
+    TEST_ASSERT_EQUAL(true, m_test_audio_play);
+}
+
+static void helper_app_avas_ign_send(uint8_t ign)
+{
+    test_avas_msg_pool_t msg = {
+
+        .msg_id = APPMAN_MSG_ID_IGN_STATUS,
+        .app_id = APPMAN_APP_ID_AVAS,
+        .p_data = &ign,
+        .size = sizeof(ign),
+    };
+
+    app_avas_msg_handler(&msg);
+}
+
+static void helper_app_avas_gear_send(uint8_t gear)
+{
+    test_avas_msg_pool_t msg = {
+
+        .msg_id = APPMAN_MSG_ID_TRANS_GEAR,
+        .app_id = APPMAN_APP_ID_AVAS,
+        .p_data = &gear,
+        .size = sizeof(gear),
+    };
+
+    app_avas_msg_handler(&msg);
+}
+
+// end of file
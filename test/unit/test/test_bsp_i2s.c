@@ -66,6 +66,24 @@ TEST_FILE("bsp_i2s.c");
  */
 #define TEST_EDMA_CH_2          2U
 
+/**
+ * @brief This macro indicates the slot count of the test playback ring.
+ *
+ */
+#define TEST_RING_SLOT_CNT      4U
+
+/**
+ * @brief This macro indicates the slot size of the test playback ring.
+ *
+ */
+#define TEST_RING_SLOT_SIZE     64U
+
+/**
+ * @brief This macro indicates the bit clock count of one I2S frame.
+ *
+ */
+#define TEST_I2S_FRAME_BIT_CNT  64U
+
 /*******************************************************************************
  * Extern Variables
  ******************************************************************************/
@@ -83,6 +101,17 @@ static bsp_i2s_status_t m_test_status;
 */
 static i2s_callback_t m_test_i2s_event_cb = NULL;
 
+/**
+ * @brief This variable holds the eDMA callback installed for the playback
+ *        ring.
+*/
+static edma_callback_t m_test_ring_dma_cb = NULL;
+
+/**
+ * @brief This variable holds the slots of the test playback ring.
+*/
+static uint8_t m_test_ring_slot[TEST_RING_SLOT_CNT][TEST_RING_SLOT_SIZE];
+
 /**
  * @brief This variable contain EDMA channel0 configuration. 
 */
@@ -132,11 +161,33 @@ static status_t test_flexio_drv_init_device_stub(
     flexio_i2s_master_state_t* master,
     int cmock_num_calls);
 
+/**
+ * @brief This stub function uses to take the eDMA callback address.
+*/
+static status_t test_edma_drv_install_callback_stub(uint8_t virtualChannel,
+                                                    edma_callback_t callback,
+                                                    void *parameter,
+                                                    int cmock_num_calls);
+
+/**
+ * @brief This stub function checks the FlexIO configuration of the rate.
+*/
+static status_t test_flexio_i2s_set_config_stub(
+    flexio_i2s_master_state_t* master,
+    uint32_t baudRate,
+    uint8_t bitsWidth,
+    int cmock_num_calls);
+
 /**
  * @brief The helper function starts bsp_i2s_init() successfully.
 */
 static void helper_bsp_i2s_init(void);
 
+/**
+ * @brief The helper function starts bsp_i2s_ring_start() successfully.
+*/
+static bool helper_bsp_i2s_ring_start(void);
+
 /**
  * @brief The helper function starts bsp_i2s_deinit() successfully.
 */
@@ -904,6 +955,312 @@ void test_bsp_i2s_init__when_i2s_master_init_fail__fail(void)
     TEST_STEP(2);
     TEST_ASSERT_EQUAL(false, ret);
 }
+
+/**
+ * @brief Verifies bsp_i2s_ring_start function with invalid arguments.
+ *
+ */
+void test_bsp_i2s_ring_start__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint8_t *const p_slot[TEST_RING_SLOT_CNT] = {
+        m_test_ring_slot[0U], m_test_ring_slot[1U], NULL, m_test_ring_slot[3U],
+    };
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_ring_start(NULL,
+                                                TEST_RING_SLOT_CNT,
+                                                TEST_RING_SLOT_SIZE));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_ring_start(p_slot,
+                                                1U,
+                                                TEST_RING_SLOT_SIZE));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_ring_start(p_slot,
+                                                BSP_I2S_RING_SLOT_MAX + 1U,
+                                                TEST_RING_SLOT_SIZE));
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_ring_start(p_slot,
+                                                2U,
+                                                TEST_RING_SLOT_SIZE - 1U));
+
+    TEST_STEP(5);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_ring_start(p_slot,
+                                                TEST_RING_SLOT_CNT,
+                                                TEST_RING_SLOT_SIZE));
+
+    TEST_STEP(6);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_ring_stop());
+}
+
+/**
+ * @brief Verifies bsp_i2s_ring_start function starts the ring with the first
+ * slot playing and the others queued.
+ *
+ */
+void test_bsp_i2s_ring_start__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_bsp_i2s_deinit();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, helper_bsp_i2s_ring_start());
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_PLAY, bsp_i2s_slot_state_get(0U));
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_READY, bsp_i2s_slot_state_get(1U));
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_READY, bsp_i2s_slot_state_get(3U));
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_PLAY,
+                      bsp_i2s_slot_state_get(TEST_RING_SLOT_CNT));
+    TEST_ASSERT_EQUAL_UINT32(0U, bsp_i2s_underrun_cnt_get());
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_write(m_test_ring_slot[0U],
+                                           TEST_RING_SLOT_SIZE));
+
+    TEST_STEP(4);
+    EDMA_DRV_StopChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+    FLEXIO_I2S_DRV_MasterTransferAbort_ExpectAnyArgsAndReturn(STATUS_SUCCESS);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_ring_stop());
+
+    TEST_STEP(5);
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_PLAY, bsp_i2s_slot_state_get(1U));
+}
+
+/**
+ * @brief Verifies the ring advances one slot per eDMA interrupt, takes the
+ * committed slots and counts the slots played before they were committed.
+ *
+ */
+void test_bsp_i2s_slot_commit__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_bsp_i2s_deinit();
+    (void)bsp_i2s_cb_set(test_callback);
+    m_test_status = BSP_I2S_ERROR;
+
+    TEST_ASSERT_EQUAL(true, helper_bsp_i2s_ring_start());
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_slot_commit(0U));
+    TEST_ASSERT_EQUAL(false, bsp_i2s_slot_commit(1U));
+
+    TEST_STEP(2);
+    m_test_ring_dma_cb(NULL, EDMA_CHN_NORMAL);
+
+    TEST_ASSERT_EQUAL(BSP_I2S_TX_EMPTY, m_test_status);
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_FREE, bsp_i2s_slot_state_get(0U));
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_PLAY, bsp_i2s_slot_state_get(1U));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_slot_commit(0U));
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_READY, bsp_i2s_slot_state_get(0U));
+    TEST_ASSERT_EQUAL(false, bsp_i2s_slot_commit(0U));
+
+    TEST_STEP(4);
+    m_test_ring_dma_cb(NULL, EDMA_CHN_NORMAL);
+    m_test_ring_dma_cb(NULL, EDMA_CHN_NORMAL);
+    m_test_ring_dma_cb(NULL, EDMA_CHN_NORMAL);
+
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_PLAY, bsp_i2s_slot_state_get(0U));
+    TEST_ASSERT_EQUAL_UINT32(0U, bsp_i2s_underrun_cnt_get());
+
+    TEST_STEP(5);
+    m_test_ring_dma_cb(NULL, EDMA_CHN_NORMAL);
+
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_PLAY, bsp_i2s_slot_state_get(1U));
+    TEST_ASSERT_EQUAL_UINT32(1U, bsp_i2s_underrun_cnt_get());
+
+    TEST_STEP(6);
+    m_test_ring_dma_cb(NULL, EDMA_CHN_ERROR);
+
+    TEST_ASSERT_EQUAL(BSP_I2S_ERROR, m_test_status);
+
+    TEST_STEP(7);
+    EDMA_DRV_StopChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+    FLEXIO_I2S_DRV_MasterTransferAbort_ExpectAnyArgsAndReturn(STATUS_SUCCESS);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_ring_stop());
+}
+
+/**
+ * @brief Verifies bsp_i2s_rate_set function sets the bit clock of the rate
+ * once.
+ *
+ */
+void test_bsp_i2s_rate_set__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_bsp_i2s_deinit();
+
+    // ************************** Expected Calls **************************** //
+
+    FLEXIO_I2S_DRV_MasterSetConfig_StubWithCallback(
+        test_flexio_i2s_set_config_stub);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_rate_set(8000U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_rate_set(8000U));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_rate_set(BSP_I2S_SAMPLE_RATE_DEFAULT));
+}
+
+/**
+ * @brief Verifies bsp_i2s_rate_set function with an invalid rate and while
+ * the ring is running.
+ *
+ */
+void test_bsp_i2s_rate_set__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_bsp_i2s_deinit();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_rate_set(0U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, helper_bsp_i2s_ring_start());
+    TEST_ASSERT_EQUAL(false, bsp_i2s_rate_set(8000U));
+
+    TEST_STEP(3);
+    EDMA_DRV_StopChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+    FLEXIO_I2S_DRV_MasterTransferAbort_ExpectAnyArgsAndReturn(STATUS_SUCCESS);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_ring_stop());
+}
+
+/**
+ * @brief Verifies bsp_i2s_rate_set function when the FlexIO configuration
+ * fails.
+ *
+ */
+void test_bsp_i2s_rate_set__when_flexio_config_fail__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_bsp_i2s_deinit();
+
+    // ************************** Expected Calls **************************** //
+
+    FLEXIO_I2S_DRV_MasterSetConfig_ExpectAnyArgsAndReturn(STATUS_ERROR);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_rate_set(32000U));
+}
+
+/**
+ * @brief Verifies bsp_i2s_silence_set function cuts the playing slot, counts
+ * the silence interrupts apart and goes on with the next slot.
+ *
+ */
+void test_bsp_i2s_silence_set__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_bsp_i2s_deinit();
+    (void)bsp_i2s_cb_set(test_callback);
+    m_test_status = BSP_I2S_ERROR;
+
+    TEST_ASSERT_EQUAL(true, helper_bsp_i2s_ring_start());
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    m_test_ring_dma_cb(NULL, EDMA_CHN_NORMAL);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_slot_commit(0U));
+    TEST_ASSERT_EQUAL_UINT32(1U, bsp_i2s_irq_cnt_get(BSP_I2S_MODE_RING));
+
+    TEST_STEP(2);
+    EDMA_DRV_StopChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+    EDMA_DRV_PushConfigToReg_ExpectAnyArgs();
+    EDMA_DRV_StartChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_silence_set(true));
+    TEST_ASSERT_EQUAL(true, bsp_i2s_silence_set(true));
+
+    TEST_STEP(3);
+    m_test_status = BSP_I2S_ERROR;
+    m_test_ring_dma_cb(NULL, EDMA_CHN_NORMAL);
+    m_test_ring_dma_cb(NULL, EDMA_CHN_NORMAL);
+
+    TEST_ASSERT_EQUAL(BSP_I2S_ERROR, m_test_status);
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_PLAY, bsp_i2s_slot_state_get(1U));
+    TEST_ASSERT_EQUAL_UINT32(2U, bsp_i2s_irq_cnt_get(BSP_I2S_MODE_SILENCE));
+    TEST_ASSERT_EQUAL_UINT32(1U, bsp_i2s_irq_cnt_get(BSP_I2S_MODE_RING));
+
+    TEST_STEP(4);
+    EDMA_DRV_StopChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+    EDMA_DRV_PushConfigToReg_ExpectAnyArgs();
+    EDMA_DRV_StartChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_silence_set(false));
+
+    TEST_ASSERT_EQUAL(BSP_I2S_TX_EMPTY, m_test_status);
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_FREE, bsp_i2s_slot_state_get(1U));
+    TEST_ASSERT_EQUAL(BSP_I2S_SLOT_STATE_PLAY, bsp_i2s_slot_state_get(2U));
+    TEST_ASSERT_EQUAL_UINT32(0U, bsp_i2s_underrun_cnt_get());
+    TEST_ASSERT_EQUAL_UINT32(0U, bsp_i2s_irq_cnt_get(BSP_I2S_MODE_CNT));
+
+    TEST_STEP(5);
+    EDMA_DRV_StopChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+    FLEXIO_I2S_DRV_MasterTransferAbort_ExpectAnyArgsAndReturn(STATUS_SUCCESS);
+    TEST_ASSERT_EQUAL(true, bsp_i2s_ring_stop());
+}
+
+/**
+ * @brief Verifies bsp_i2s_silence_set function while the ring is stopped.
+ *
+ */
+void test_bsp_i2s_silence_set__when_ring_stopped__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_bsp_i2s_deinit();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_silence_set(true));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, bsp_i2s_silence_set(false));
+}
+
 /*******************************************************************************
  * Private Functions Definitions
  ******************************************************************************/
@@ -919,6 +1276,71 @@ static void helper_bsp_i2s_init()
     (void)bsp_i2s_init();
 }
 
+static bool helper_bsp_i2s_ring_start(void)
+{
+    uint8_t *const p_slot[TEST_RING_SLOT_CNT] = {
+        m_test_ring_slot[0U], m_test_ring_slot[1U],
+        m_test_ring_slot[2U], m_test_ring_slot[3U],
+    };
+
+    m_test_ring_dma_cb = NULL;
+
+    FLEXIO_I2S_DRV_MasterSendData_ExpectAnyArgsAndReturn(STATUS_SUCCESS);
+    EDMA_DRV_StopChannel_ExpectAndReturn(TEST_EDMA_CH_2, STATUS_SUCCESS);
+    EDMA_DRV_StopChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+    EDMA_DRV_InstallCallback_StubWithCallback(
+        test_edma_drv_install_callback_stub);
+    EDMA_DRV_PushConfigToSTCD_Ignore();
+    EDMA_DRV_PushConfigToReg_ExpectAnyArgs();
+    EDMA_DRV_StartChannel_ExpectAndReturn(TEST_EDMA_CH_1, STATUS_SUCCESS);
+
+    bool ret = bsp_i2s_ring_start(p_slot,
+                                  TEST_RING_SLOT_CNT,
+                                  TEST_RING_SLOT_SIZE);
+
+    TEST_ASSERT_NOT_NULL(m_test_ring_dma_cb);
+
+    return ret;
+}
+
+static status_t test_edma_drv_install_callback_stub(uint8_t virtualChannel,
+                                                    edma_callback_t callback,
+                                                    void *parameter,
+                                                    int cmock_num_calls)
+{
+    (void)parameter;
+    (void)cmock_num_calls;
+
+    if (TEST_EDMA_CH_2 == virtualChannel)
+    {
+        TEST_ASSERT_NULL(callback);
+    }
+    else
+    {
+        m_test_ring_dma_cb = callback;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static status_t test_flexio_i2s_set_config_stub(
+    flexio_i2s_master_state_t* master,
+    uint32_t baudRate,
+    uint8_t bitsWidth,
+    int cmock_num_calls)
+{
+    (void)master;
+
+    // The second rate is set back to the default one.
+    uint32_t rate = (0 == cmock_num_calls) ? 8000U
+                                           : BSP_I2S_SAMPLE_RATE_DEFAULT;
+
+    TEST_ASSERT_EQUAL_UINT32(rate * TEST_I2S_FRAME_BIT_CNT, baudRate);
+    TEST_ASSERT_EQUAL_UINT8(32U, bitsWidth);
+
+    return STATUS_SUCCESS;
+}
+
 static void helper_bsp_i2s_deinit()
 {
     flexio_i2s_master_state_t i2s_master_state = {0U};
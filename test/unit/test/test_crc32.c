@@ -0,0 +1,169 @@
+
+
+/**
+ * @file test_crc32.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the CRC-32 module.
+ *
+ * @version 0.1
+ *
+ * @date 17/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "crc32.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("crc32.c");
+
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the byte count of the test stream. It is not a
+ * multiple of the word size, so the byte loops of the kernel are run too.
+ *
+ */
+#define TEST_STREAM_SIZE (203U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/**
+ * @brief This variable holds the test stream. One more byte is kept to start
+ * the stream at an unaligned address.
+ */
+static uint8_t m_test_stream[TEST_STREAM_SIZE + 1U];
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+    for (uint32_t idx = 0U; idx < sizeof(m_test_stream); idx++)
+    {
+        m_test_stream[idx] = (uint8_t)((idx * 37U) + 11U);
+    }
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the crc32_update function gives the check value of
+ * the CRC-32 and the CRC of an empty stream.
+ *
+ */
+void test_crc32_update__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint8_t check[] = "123456789";
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926U,
+                            crc32_update(CRC32_INIT, check, 9U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_HEX32(CRC32_INIT,
+                            crc32_update(CRC32_INIT, check, 0U));
+}
+
+/**
+ * @brief The test verifies the CRC of a stream does not depend on the parts
+ * it is given in, nor on their alignment.
+ *
+ */
+void test_crc32_update__when_stream_in_parts__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint8_t *p_stream = &m_test_stream[1U];
+
+    uint32_t crc = crc32_update(CRC32_INIT, p_stream, TEST_STREAM_SIZE);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    for (uint32_t split = 0U; split <= TEST_STREAM_SIZE; split += 7U)
+    {
+        uint32_t part = crc32_update(CRC32_INIT, p_stream, split);
+
+        part = crc32_update(part, &p_stream[split], TEST_STREAM_SIZE - split);
+
+        TEST_ASSERT_EQUAL_HEX32(crc, part);
+    }
+}
+
+/**
+ * @brief The test verifies the crc32_combine function gives the CRC of the
+ * joined parts.
+ *
+ */
+void test_crc32_combine__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint8_t *p_stream = m_test_stream;
+
+    uint32_t crc = crc32_update(CRC32_INIT, p_stream, TEST_STREAM_SIZE);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    for (uint32_t split = 0U; split <= TEST_STREAM_SIZE; split += 5U)
+    {
+        uint32_t first = crc32_update(CRC32_INIT, p_stream, split);
+
+        uint32_t second = crc32_update(CRC32_INIT,
+                                       &p_stream[split],
+                                       TEST_STREAM_SIZE - split);
+
+        TEST_ASSERT_EQUAL_HEX32(crc,
+                                crc32_combine(first,
+                                              second,
+                                              TEST_STREAM_SIZE - split));
+    }
+}
+
+// end of file
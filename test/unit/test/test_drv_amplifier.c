@@ -46,6 +46,18 @@ TEST_FILE("drv_amplifier.c");
  */
 #define TEST_IB11_ADDR                       0x0BU
 
+/**
+ * @brief Address of the instruction byte holding the WS select bits.
+ *
+ */
+#define TEST_IB1_ADDR                        0x01U
+
+/**
+ * @brief Mask of the WS select bits in IB1.
+ *
+ */
+#define TEST_SELECT_WS_MASK                  (0x07U << 2U)
+
 /**
  * @brief https://codebeamer.daiichi.com/issue/192998
  * 
@@ -349,6 +361,15 @@ static bool test_bsp_i2c_write_unmute_stub(uint32_t port,
                                            size_t size, 
                                            int cmock_num_calls);
 
+/**
+ * @brief Stub function to receive the rate data from bsp_i2c_write function.
+ *
+ */
+static bool test_bsp_i2c_write_rate_stub(uint32_t port,
+                                         const uint8_t* p_data,
+                                         size_t size,
+                                         int cmock_num_calls);
+
 /**
  * @brief Stub function for set rx data. 
  * 
@@ -916,6 +937,108 @@ void test_drv_amplifier_unmute__usual_run__success(void)
     TEST_ASSERT_EQUAL(true, ret);
 }
 
+/**
+ * @brief Verifies drv_amplifier_rate_set function writes the WS select bits of
+ * the rate to both amplifiers.
+ *
+ */
+void test_drv_amplifier_rate_set__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_drv_amplifier_init();
+
+    // ************************** Expected Calls **************************** //
+
+    bsp_i2c_write_StubWithCallback(test_bsp_i2c_write_rate_stub);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = drv_amplifier_rate_set(8000U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, ret);
+
+    TEST_STEP(3);
+    ret = drv_amplifier_rate_set(16000U);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(true, ret);
+}
+
+/**
+ * @brief Verifies drv_amplifier_rate_set function when the rate is not
+ * supported by the amplifier.
+ *
+ */
+void test_drv_amplifier_rate_set__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    // ************************** Expected Calls **************************** //
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = drv_amplifier_rate_set(44100U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
+/**
+ * @brief Verifies drv_amplifier_rate_set function when the write process is
+ * fail and it is seen that the function tries four times.
+ *
+ */
+void test_drv_amplifier_rate_set__when_amp_1_write_fail__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    // **************************** Pre-Actions ***************************** //
+
+    helper_drv_amplifier_init();
+
+    // ************************** Expected Calls **************************** //
+
+    bsp_i2c_write_ExpectAnyArgsAndReturn(false);
+
+    bsp_mcu_delay_Expect(10U);
+
+    bsp_i2c_write_ExpectAnyArgsAndReturn(false);
+
+    bsp_mcu_delay_Expect(10U);
+
+    bsp_i2c_write_ExpectAnyArgsAndReturn(false);
+
+    bsp_mcu_delay_Expect(10U);
+
+    bsp_i2c_write_ExpectAnyArgsAndReturn(false);
+
+    bsp_mcu_delay_Expect(10U);
+
+    bsp_i2c_write_ExpectAnyArgsAndReturn(false);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    bool ret = drv_amplifier_rate_set(32000U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, ret);
+}
+
 /**
  * @brief Verifies drv_amplifier_diag_cb_set function successfully.
  * 
@@ -1711,6 +1834,35 @@ static bool test_bsp_i2c_write_mute_stub(uint32_t port,
     return true;
 }
 
+static bool test_bsp_i2c_write_rate_stub(uint32_t port,
+                                         const uint8_t* p_data,
+                                         size_t size,
+                                         int cmock_num_calls)
+{
+    // The WS select bits of IB1 are 000 at 8 kHz and 001 at 16 kHz.
+    uint8_t ws_select = (2 > cmock_num_calls) ? 0x00U : 0x04U;
+
+    if (4 <= cmock_num_calls)
+    {
+        return false;
+    }
+
+    if (0 == (cmock_num_calls % 2))
+    {
+        TEST_ASSERT_EQUAL(BSP_I2C_AMP_1_PORT, port);
+    }
+    else
+    {
+        TEST_ASSERT_EQUAL(BSP_I2C_AMP_2_PORT, port);
+    }
+
+    TEST_ASSERT_EQUAL(TEST_IB1_ADDR, p_data[0U]);
+    TEST_ASSERT_EQUAL(ws_select, p_data[1U] & TEST_SELECT_WS_MASK);
+    TEST_ASSERT_EQUAL(2U, size);
+
+    return true;
+}
+
 static void test_drv_amplifier_diag_emty_cb(drv_amplifier_diag_t diagnostic)
 {
     (void)diagnostic;
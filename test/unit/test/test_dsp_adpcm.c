@@ -0,0 +1,218 @@
+/**
+ * @file test_dsp_adpcm.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the DSP ADPCM module.
+ *
+ * @version 0.1
+ *
+ * @date 16/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "dsp_adpcm.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("dsp_adpcm.c");
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the dsp_adpcm_hdr_load function loads the
+ * little-endian predictor and the step index of both channels.
+ *
+ */
+void test_dsp_adpcm_hdr_load__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint8_t hdr[DSP_ADPCM_HDR_SIZE] = {
+        0x34U, 0x12U, 10U, 0U, 0x00U, 0x80U, 88U, 0U,
+    };
+
+    dsp_adpcm_t adpcm = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, dsp_adpcm_hdr_load(&adpcm, hdr));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0x1234, adpcm.ch[0U].pred);
+    TEST_ASSERT_EQUAL_UINT32(10U, adpcm.ch[0U].index);
+    TEST_ASSERT_EQUAL_INT32(INT16_MIN, adpcm.ch[1U].pred);
+    TEST_ASSERT_EQUAL_UINT32(88U, adpcm.ch[1U].index);
+}
+
+/**
+ * @brief The test verifies the dsp_adpcm_hdr_load function rejects an out of
+ * range step index and an invalid argument.
+ *
+ */
+void test_dsp_adpcm_hdr_load__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint8_t hdr[DSP_ADPCM_HDR_SIZE] = {
+        0U, 0U, 0U, 0U, 0U, 0U, 89U, 0U,
+    };
+
+    dsp_adpcm_t adpcm = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, dsp_adpcm_hdr_load(&adpcm, hdr));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, dsp_adpcm_hdr_load(NULL, hdr));
+    TEST_ASSERT_EQUAL(false, dsp_adpcm_hdr_load(&adpcm, NULL));
+}
+
+/**
+ * @brief The test verifies the dsp_adpcm_code_decode function updates the
+ * predictor and the step index, and saturates the predictor.
+ *
+ */
+void test_dsp_adpcm_code_decode__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_adpcm_ch_t ch = {0, 0U};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_INT32(7, dsp_adpcm_code_decode(&ch, 0x4U));
+    TEST_ASSERT_EQUAL_UINT32(2U, ch.index);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(-9, dsp_adpcm_code_decode(&ch, 0xFU));
+    TEST_ASSERT_EQUAL_UINT32(10U, ch.index);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_INT32(-7, dsp_adpcm_code_decode(&ch, 0x0U));
+    TEST_ASSERT_EQUAL_UINT32(9U, ch.index);
+
+    TEST_STEP(4);
+    ch.pred = INT16_MAX - 1;
+    ch.index = DSP_ADPCM_INDEX_MAX;
+    TEST_ASSERT_EQUAL_INT32(INT16_MAX, dsp_adpcm_code_decode(&ch, 0x7U));
+    TEST_ASSERT_EQUAL_UINT32(DSP_ADPCM_INDEX_MAX, ch.index);
+
+    TEST_STEP(5);
+    TEST_ASSERT_EQUAL_UINT32(7U, dsp_adpcm_step_get(0U));
+    TEST_ASSERT_EQUAL_UINT32(32767U, dsp_adpcm_step_get(200U));
+}
+
+/**
+ * @brief The test verifies the dsp_adpcm_decode function decodes the left
+ * channel from the low nibble and the right channel from the high nibble to
+ * the upper half of the 32-bit samples, and only advances the state without an
+ * output.
+ *
+ */
+void test_dsp_adpcm_decode__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint8_t code[2U] = {0xF4U, 0x4FU};
+
+    int32_t out[4U] = {0};
+
+    dsp_adpcm_t adpcm = {0};
+
+    dsp_adpcm_t skip = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_adpcm_decode(&adpcm, code, out, 2U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(7 * 65536, out[0U]);
+    TEST_ASSERT_EQUAL_INT32(-11 * 65536, out[1U]);
+    TEST_ASSERT_EQUAL_INT32(-9 * 65536, out[2U]);
+    TEST_ASSERT_EQUAL_INT32(7 * 65536, out[3U]);
+
+    TEST_STEP(3);
+    dsp_adpcm_decode(&skip, code, NULL, 2U);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL_INT32(adpcm.ch[0U].pred, skip.ch[0U].pred);
+    TEST_ASSERT_EQUAL_UINT32(adpcm.ch[0U].index, skip.ch[0U].index);
+    TEST_ASSERT_EQUAL_INT32(adpcm.ch[1U].pred, skip.ch[1U].pred);
+    TEST_ASSERT_EQUAL_UINT32(adpcm.ch[1U].index, skip.ch[1U].index);
+}
+
+/**
+ * @brief The test verifies the dsp_adpcm_frame_cnt_get function counts the
+ * frames of the full blocks and of the last short block.
+ *
+ */
+void test_dsp_adpcm_frame_cnt_get__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_UINT32(0U, dsp_adpcm_frame_cnt_get(0U));
+    TEST_ASSERT_EQUAL_UINT32(0U, dsp_adpcm_frame_cnt_get(DSP_ADPCM_HDR_SIZE));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_UINT32(DSP_ADPCM_BLOCK_FRAME_CNT,
+                             dsp_adpcm_frame_cnt_get(DSP_ADPCM_BLOCK_SIZE));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_UINT32((2U * DSP_ADPCM_BLOCK_FRAME_CNT) + 10U,
+                             dsp_adpcm_frame_cnt_get((2U * DSP_ADPCM_BLOCK_SIZE) +
+                                                     DSP_ADPCM_HDR_SIZE + 10U));
+}
+
+// end of file
@@ -0,0 +1,171 @@
+/**
+ * @file test_dsp_biquad.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the DSP biquad module.
+ *
+ * @version 0.1
+ *
+ * @date 16/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "dsp_biquad.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("dsp_biquad.c");
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the dsp_biquad_run function passes the samples
+ * unchanged without a stage.
+ *
+ */
+void test_dsp_biquad_run__when_no_stage__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_biquad_t biquad = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_biquad_init(&biquad);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0x12345678, dsp_biquad_run(&biquad, 0x12345678));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, dsp_biquad_run(&biquad, INT32_MIN));
+}
+
+/**
+ * @brief The test verifies the dsp_biquad_run function runs the feed forward
+ * and the feedback paths of a cascade.
+ *
+ */
+void test_dsp_biquad_run__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_biquad_t biquad = {0};
+
+    // y = (x0 + x1) / 2, then y = x0 + y1 / 2
+    const int16_t coef[2U][DSP_BIQUAD_COEF_CNT] = {
+        {8192, 8192, 0, 0, 0},
+        {DSP_BIQUAD_COEF_UNITY, 0, 0, -8192, 0},
+    };
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, dsp_biquad_set(&biquad, coef[0U], 1U));
+    TEST_ASSERT_EQUAL_INT32(0x10000000, dsp_biquad_run(&biquad, 0x20001234));
+    TEST_ASSERT_EQUAL_INT32(0x20000000, dsp_biquad_run(&biquad, 0x20000000));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, dsp_biquad_set(&biquad, coef[1U], 1U));
+    TEST_ASSERT_EQUAL_INT32(0x40000000, dsp_biquad_run(&biquad, 0x40000000));
+    TEST_ASSERT_EQUAL_INT32(0x20000000, dsp_biquad_run(&biquad, 0));
+    TEST_ASSERT_EQUAL_INT32(0x10000000, dsp_biquad_run(&biquad, 0));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(true, dsp_biquad_set(&biquad, coef[0U], 2U));
+    TEST_ASSERT_EQUAL_INT32(0x20000000, dsp_biquad_run(&biquad, 0x40000000));
+    TEST_ASSERT_EQUAL_INT32(0x30000000, dsp_biquad_run(&biquad, 0));
+    TEST_ASSERT_EQUAL_INT32(0x18000000, dsp_biquad_run(&biquad, 0));
+}
+
+/**
+ * @brief The test verifies the dsp_biquad_run function saturates the output
+ * of a stage.
+ *
+ */
+void test_dsp_biquad_run__when_overflow__saturate(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_biquad_t biquad = {0};
+
+    const int16_t coef[DSP_BIQUAD_COEF_CNT] = {INT16_MAX, 0, 0, 0, 0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, dsp_biquad_set(&biquad, coef, 1U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0x7FFF0000, dsp_biquad_run(&biquad, INT32_MAX));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, dsp_biquad_run(&biquad, INT32_MIN));
+}
+
+/**
+ * @brief The test verifies the dsp_biquad_set function rejects an invalid
+ * stage count and pointer.
+ *
+ */
+void test_dsp_biquad_set__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_biquad_t biquad = {0};
+
+    const int16_t coef[DSP_BIQUAD_COEF_CNT] = {DSP_BIQUAD_COEF_UNITY};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false,
+                      dsp_biquad_set(&biquad, coef, DSP_BIQUAD_STAGE_MAX + 1U));
+    TEST_ASSERT_EQUAL(false, dsp_biquad_set(&biquad, NULL, 1U));
+    TEST_ASSERT_EQUAL(false, dsp_biquad_set(NULL, coef, 1U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_UINT32(0U, biquad.stage_cnt);
+}
+
+// end of file
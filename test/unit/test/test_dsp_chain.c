@@ -0,0 +1,187 @@
+/**
+ * @file test_dsp_chain.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the DSP chain module.
+ *
+ * @version 0.1
+ *
+ * @date 16/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "dsp_chain.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("dsp_biquad.c");
+TEST_FILE("dsp_chain.c");
+TEST_FILE("dsp_gain.c");
+TEST_FILE("dsp_limiter.c");
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the dsp_chain_process function leaves the frames
+ * unchanged after dsp_chain_init.
+ *
+ */
+void test_dsp_chain_process__when_flat__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_chain_t chain = {0};
+
+    int32_t frames[4U] = {0x10000, -0x20000, INT32_MAX, INT32_MIN};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_chain_init(&chain);
+    dsp_chain_process(&chain, frames, 2U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0x10000, frames[0U]);
+    TEST_ASSERT_EQUAL_INT32(-0x20000, frames[1U]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, frames[2U]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, frames[3U]);
+}
+
+/**
+ * @brief The test verifies the dsp_chain_process function applies the gain of
+ * each channel to its own samples only.
+ *
+ */
+void test_dsp_chain_process__per_channel_gain__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_chain_t chain = {0};
+
+    int32_t frames[4U] = {0x10000, 0x10000, -0x40000, -0x40000};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_chain_init(&chain);
+    TEST_ASSERT_EQUAL(true, dsp_chain_gain_set(&chain, 0U, 16384U));
+    TEST_ASSERT_EQUAL(true, dsp_chain_gain_set(&chain, 1U, 65536U));
+
+    TEST_STEP(2);
+    dsp_chain_process(&chain, frames, 2U);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_INT32(0x8000, frames[0U]);
+    TEST_ASSERT_EQUAL_INT32(0x1FFFE, frames[1U]);
+    TEST_ASSERT_EQUAL_INT32(-0x20000, frames[2U]);
+    TEST_ASSERT_EQUAL_INT32(-0x7FFF8, frames[3U]);
+}
+
+/**
+ * @brief The test verifies the dsp_chain_process function runs the EQ of a
+ * channel before its gain and leaves the other channel unchanged.
+ *
+ */
+void test_dsp_chain_process__per_channel_eq__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_chain_t chain = {0};
+
+    const int16_t coef[DSP_BIQUAD_COEF_CNT] = {8192, 8192, 0, 0, 0};
+
+    int32_t frames[4U] = {0x40000000, 0x12345678, 0x40000000, 0x12345678};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_chain_init(&chain);
+    TEST_ASSERT_EQUAL(true, dsp_chain_eq_set(&chain, 1U, coef, 1U));
+    TEST_ASSERT_EQUAL(true, dsp_chain_gain_set(&chain, 1U, 16384U));
+    TEST_ASSERT_EQUAL(false, chain.flat);
+
+    TEST_STEP(2);
+    dsp_chain_process(&chain, frames, 2U);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_INT32(0x40000000, frames[0U]);
+    TEST_ASSERT_EQUAL_INT32(0x048D0000, frames[1U]);
+    TEST_ASSERT_EQUAL_INT32(0x40000000, frames[2U]);
+    TEST_ASSERT_EQUAL_INT32(0x091A0000, frames[3U]);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(true, dsp_chain_eq_set(&chain, 1U, coef, 0U));
+    TEST_ASSERT_EQUAL(true, dsp_chain_gain_set(&chain, 1U, 32768U));
+    TEST_ASSERT_EQUAL(true, chain.flat);
+}
+
+/**
+ * @brief The test verifies the set functions of the chain reject an
+ * invalid channel, threshold and pointer.
+ *
+ */
+void test_dsp_chain_gain_set__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_chain_t chain = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_chain_init(&chain);
+    TEST_ASSERT_EQUAL(false, dsp_chain_gain_set(&chain, DSP_CHAIN_CH_CNT, 0U));
+    TEST_ASSERT_EQUAL(false, dsp_chain_gain_set(NULL, 0U, 0U));
+    TEST_ASSERT_EQUAL(false, dsp_chain_eq_set(&chain, DSP_CHAIN_CH_CNT,
+                                              NULL, 0U));
+    TEST_ASSERT_EQUAL(false, dsp_chain_limiter_set(&chain, 0U, 0U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, chain.flat);
+}
+
+// end of file
@@ -0,0 +1,379 @@
+/**
+ * @file test_dsp_gain.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the DSP gain module.
+ *
+ * @version 0.1
+ *
+ * @date 16/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "dsp_gain.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("dsp_gain.c");
+
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the calibration table gain rate.
+ *
+ */
+#define TEST_GAIN_CALC_RATE (1000U)
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the dsp_gain_q15_get function converts the
+ * calibration gain to Q15 format.
+ *
+ */
+void test_dsp_gain_q15_get__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_UINT32(DSP_GAIN_UNITY_Q15,
+                             dsp_gain_q15_get(1000U, TEST_GAIN_CALC_RATE));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_UINT32(16384U, dsp_gain_q15_get(500U, TEST_GAIN_CALC_RATE));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_UINT32(0U, dsp_gain_q15_get(0U, TEST_GAIN_CALC_RATE));
+}
+
+/**
+ * @brief The test verifies the dsp_gain_q15_get function clamps the gain and
+ * rejects a zero denominator.
+ *
+ */
+void test_dsp_gain_q15_get__out_of_range__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_UINT32(DSP_GAIN_MAX_Q15,
+                             dsp_gain_q15_get(5000U, TEST_GAIN_CALC_RATE));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_UINT32(0U, dsp_gain_q15_get(1000U, 0U));
+}
+
+/**
+ * @brief The test verifies the dsp_gain_s32_mul function against the exact
+ * 64-bit product for positive and negative samples.
+ *
+ */
+void test_dsp_gain_s32_mul__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const int32_t samples[] = {
+        0, 1, -1, 12345678, -12345678, 0x12345, -0x12345, 1073741823,
+        -1073741824,
+    };
+
+    const uint32_t gains[] = {0U, 1U, 16384U, 29491U, 32768U, 40000U};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    for (uint32_t s = 0U; s < (sizeof(samples) / sizeof(samples[0])); s++)
+    {
+        for (uint32_t g = 0U; g < (sizeof(gains) / sizeof(gains[0])); g++)
+        {
+            int64_t expected = ((int64_t)samples[s] * gains[g]) >> 15;
+
+            TEST_ASSERT_EQUAL_INT32((int32_t)expected,
+                                    dsp_gain_s32_mul(samples[s], gains[g]));
+        }
+    }
+}
+
+/**
+ * @brief The test verifies the dsp_gain_s32_mul function saturates the result.
+ *
+ */
+void test_dsp_gain_s32_mul__saturation__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, dsp_gain_s32_mul(INT32_MAX, 40000U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, dsp_gain_s32_mul(INT32_MIN, 40000U));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX,
+                            dsp_gain_s32_mul(0x7FFF0000, DSP_GAIN_MAX_Q15));
+}
+
+/**
+ * @brief The test verifies the dsp_gain_s32_apply function scales every sample
+ * of the stereo buffer, including an odd sample count.
+ *
+ */
+void test_dsp_gain_s32_apply__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    int32_t buff[5U] = {1000, -1000, 0x40000000, -0x40000000, 7};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_gain_s32_apply(buff, 5U, 16384U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(500, buff[0U]);
+    TEST_ASSERT_EQUAL_INT32(-500, buff[1U]);
+    TEST_ASSERT_EQUAL_INT32(0x20000000, buff[2U]);
+    TEST_ASSERT_EQUAL_INT32(-0x20000000, buff[3U]);
+    TEST_ASSERT_EQUAL_INT32(3, buff[4U]);
+}
+
+/**
+ * @brief The test verifies the dsp_gain_s32_apply function leaves the buffer
+ * untouched at unity gain and with an invalid argument.
+ *
+ */
+void test_dsp_gain_s32_apply__unity_gain__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    int32_t buff[2U] = {INT32_MAX, INT32_MIN};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_gain_s32_apply(buff, 2U, DSP_GAIN_UNITY_Q15);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, buff[0U]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, buff[1U]);
+
+    TEST_STEP(3);
+    dsp_gain_s32_apply(NULL, 2U, 0U);
+}
+
+/**
+ * @brief The test verifies the dsp_gain_s32_ramp function steps the gain once
+ * per frame from the start gain towards the end gain.
+ *
+ */
+void test_dsp_gain_s32_ramp__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    int32_t buff[8U] = {
+        0x10000, -0x10000, 0x10000, -0x10000,
+        0x10000, -0x10000, 0x10000, -0x10000,
+    };
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_gain_s32_ramp(buff, 4U, 2U, DSP_GAIN_UNITY_Q15, 0U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0x10000, buff[0U]);
+    TEST_ASSERT_EQUAL_INT32(-0x10000, buff[1U]);
+    TEST_ASSERT_EQUAL_INT32(0xC000, buff[2U]);
+    TEST_ASSERT_EQUAL_INT32(-0xC000, buff[3U]);
+    TEST_ASSERT_EQUAL_INT32(0x8000, buff[4U]);
+    TEST_ASSERT_EQUAL_INT32(-0x8000, buff[5U]);
+    TEST_ASSERT_EQUAL_INT32(0x4000, buff[6U]);
+    TEST_ASSERT_EQUAL_INT32(-0x4000, buff[7U]);
+}
+
+/**
+ * @brief The test verifies the dsp_gain_s32_ramp function falls back to the
+ * constant gain when the start and end gains match, and ignores an invalid
+ * argument.
+ *
+ */
+void test_dsp_gain_s32_ramp__constant_gain__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    int32_t buff[4U] = {1000, -1000, 2000, -2000};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_gain_s32_ramp(buff, 2U, 2U, 16384U, 16384U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(500, buff[0U]);
+    TEST_ASSERT_EQUAL_INT32(-500, buff[1U]);
+    TEST_ASSERT_EQUAL_INT32(1000, buff[2U]);
+    TEST_ASSERT_EQUAL_INT32(-1000, buff[3U]);
+
+    TEST_STEP(3);
+    dsp_gain_s32_ramp(NULL, 2U, 2U, 0U, DSP_GAIN_UNITY_Q15);
+    dsp_gain_s32_ramp(buff, 0U, 2U, 0U, DSP_GAIN_UNITY_Q15);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL_INT32(500, buff[0U]);
+}
+
+/**
+ * @brief The test verifies the dsp_gain_s32_xfade function moves from the
+ * faded-out block to the faded-in block with complementary gains.
+ *
+ */
+void test_dsp_gain_s32_xfade__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    int32_t out[6U] = {0x30000, -0x30000, 0x30000, -0x30000, 0x30000, -0x30000};
+
+    const int32_t in[6U] = {0, 0x10000, 0, 0x10000, 0, 0x10000};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_gain_s32_xfade(out, in, 3U, 2U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0x24000, out[0U]);
+    TEST_ASSERT_EQUAL_INT32(-0x20000, out[1U]);
+    TEST_ASSERT_EQUAL_INT32(0x18000, out[2U]);
+    TEST_ASSERT_EQUAL_INT32(-0x10000, out[3U]);
+    TEST_ASSERT_EQUAL_INT32(0xC000, out[4U]);
+    TEST_ASSERT_EQUAL_INT32(0, out[5U]);
+
+    TEST_STEP(3);
+    dsp_gain_s32_xfade(NULL, in, 3U, 2U);
+    dsp_gain_s32_xfade(out, in, 0U, 2U);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL_INT32(0x24000, out[0U]);
+}
+
+/**
+ * @brief The test verifies the dsp_gain_s32_mix function adds the samples and
+ * saturates the sum in both directions.
+ *
+ */
+void test_dsp_gain_s32_mix__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    int32_t out[4U] = {0x10000, -0x10000, 0x70000000, -0x70000000};
+
+    const int32_t in[4U] = {0x20000, 0x8000, 0x20000000, -0x20000000};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_gain_s32_mix(out, in, 4U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0x30000, out[0U]);
+    TEST_ASSERT_EQUAL_INT32(-0x8000, out[1U]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, out[2U]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, out[3U]);
+
+    TEST_STEP(3);
+    dsp_gain_s32_mix(NULL, in, 4U);
+    dsp_gain_s32_mix(out, NULL, 4U);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL_INT32(0x30000, out[0U]);
+}
+
+/**
+ * @brief The test verifies the dsp_gain_s16_apply function scales and saturates
+ * the 16-bit samples.
+ *
+ */
+void test_dsp_gain_s16_apply__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    int16_t buff[4U] = {1000, -1000, INT16_MAX, INT16_MIN};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_gain_s16_apply(buff, 2U, 16384U);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT16(500, buff[0U]);
+    TEST_ASSERT_EQUAL_INT16(-500, buff[1U]);
+
+    TEST_STEP(3);
+    dsp_gain_s16_apply(&buff[2U], 2U, DSP_GAIN_MAX_Q15);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, buff[2U]);
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, buff[3U]);
+}
+
+// end of file
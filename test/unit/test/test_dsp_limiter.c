@@ -0,0 +1,204 @@
+/**
+ * @file test_dsp_limiter.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the DSP limiter module.
+ *
+ * @version 0.1
+ *
+ * @date 16/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "dsp_limiter.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("dsp_gain.c");
+TEST_FILE("dsp_limiter.c");
+
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the threshold of the tests, half of the full
+ *        scale.
+ *
+ */
+#define TEST_THR_Q15 (16384U)
+
+/**
+ * @brief This macro indicates the threshold of the tests in the sample scale.
+ *
+ */
+#define TEST_THR (0x40000000)
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the dsp_limiter_run function passes the samples
+ * unchanged and without a delay while the limiter is off.
+ *
+ */
+void test_dsp_limiter_run__when_off__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_limiter_t limiter = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_limiter_init(&limiter);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, dsp_limiter_run(&limiter, INT32_MAX));
+    TEST_ASSERT_EQUAL_INT32(-0x1234, dsp_limiter_run(&limiter, -0x1234));
+}
+
+/**
+ * @brief The test verifies the dsp_limiter_run function delays the samples
+ * below the threshold without changing them.
+ *
+ */
+void test_dsp_limiter_run__below_threshold__delay(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_limiter_t limiter = {0};
+
+    int32_t out[DSP_LIMITER_DELAY_CNT + 4U] = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_limiter_init(&limiter);
+    TEST_ASSERT_EQUAL(true, dsp_limiter_thr_set(&limiter, TEST_THR_Q15));
+
+    TEST_STEP(2);
+    for (uint32_t idx = 0U; idx < (DSP_LIMITER_DELAY_CNT + 4U); idx++)
+    {
+        out[idx] = dsp_limiter_run(&limiter, (int32_t)(idx + 1U) << 16);
+    }
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_INT32(0, out[DSP_LIMITER_DELAY_CNT - 1U]);
+    TEST_ASSERT_EQUAL_INT32(0x10000, out[DSP_LIMITER_DELAY_CNT]);
+    TEST_ASSERT_EQUAL_INT32(0x40000, out[DSP_LIMITER_DELAY_CNT + 3U]);
+}
+
+/**
+ * @brief The test verifies the dsp_limiter_run function lowers the gain
+ * before a peak leaves the delay line and releases it after the peak.
+ *
+ */
+void test_dsp_limiter_run__over_threshold__limit(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_limiter_t limiter = {0};
+
+    int32_t out = 0;
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_limiter_init(&limiter);
+    TEST_ASSERT_EQUAL(true, dsp_limiter_thr_set(&limiter, TEST_THR_Q15));
+
+    TEST_STEP(2);
+    for (uint32_t idx = 0U; idx < (2U * DSP_LIMITER_DELAY_CNT); idx++)
+    {
+        int32_t sample = (0U == (idx & 1U)) ? 0x7FFF0000 : -0x7FFF0000;
+
+        out = dsp_limiter_run(&limiter, sample);
+
+        TEST_ASSERT_TRUE(TEST_THR >= out);
+        TEST_ASSERT_TRUE(-TEST_THR <= out);
+    }
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_INT32(-0x3FFF8000, out);
+    TEST_ASSERT_EQUAL_UINT32(16384U, limiter.gain);
+
+    TEST_STEP(4);
+    for (uint32_t idx = 0U; idx < 20000U; idx++)
+    {
+        out = dsp_limiter_run(&limiter, 0x10000000);
+    }
+
+    TEST_STEP(5);
+    TEST_ASSERT_EQUAL_INT32(0x10000000, out);
+    TEST_ASSERT_EQUAL_UINT32(32768U, limiter.gain);
+}
+
+/**
+ * @brief The test verifies the dsp_limiter_thr_set function rejects an
+ * invalid threshold and pointer.
+ *
+ */
+void test_dsp_limiter_thr_set__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_limiter_t limiter = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    dsp_limiter_init(&limiter);
+    TEST_ASSERT_EQUAL(false, dsp_limiter_thr_set(&limiter, 0U));
+    TEST_ASSERT_EQUAL(false, dsp_limiter_thr_set(&limiter,
+                                                 DSP_LIMITER_THR_UNITY + 1U));
+    TEST_ASSERT_EQUAL(false, dsp_limiter_thr_set(NULL, TEST_THR_Q15));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, limiter.enable);
+}
+
+// end of file
@@ -0,0 +1,184 @@
+/**
+ * @file test_dsp_osc.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the DSP oscillator module.
+ *
+ * @version 0.1
+ *
+ * @date 16/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "dsp_osc.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("dsp_osc.c");
+
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the sample rate of the tests.
+ *
+ */
+#define TEST_SAMPLE_RATE (16000U)
+
+/**
+ * @brief This macro indicates the unity level in Q15 format.
+ *
+ */
+#define TEST_LEVEL_UNITY (32768U)
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the dsp_osc_init function rejects an invalid
+ * wavetable, frequency, level and pointer, and leaves the oscillator silent.
+ *
+ */
+void test_dsp_osc_init__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_osc_t osc = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, dsp_osc_init(&osc, DSP_OSC_WAVE_CNT, 100U,
+                                          TEST_SAMPLE_RATE, TEST_LEVEL_UNITY));
+    TEST_ASSERT_EQUAL_UINT32(0U, osc.level);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, dsp_osc_init(&osc, DSP_OSC_WAVE_SINE, 8000U,
+                                          TEST_SAMPLE_RATE, TEST_LEVEL_UNITY));
+    TEST_ASSERT_EQUAL(false, dsp_osc_init(&osc, DSP_OSC_WAVE_SINE, 100U,
+                                          0U, TEST_LEVEL_UNITY));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, dsp_osc_init(&osc, DSP_OSC_WAVE_SINE, 100U,
+                                          TEST_SAMPLE_RATE,
+                                          TEST_LEVEL_UNITY + 1U));
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(false, dsp_osc_init(NULL, DSP_OSC_WAVE_SINE, 100U,
+                                          TEST_SAMPLE_RATE, TEST_LEVEL_UNITY));
+}
+
+/**
+ * @brief The test verifies the dsp_osc_render function steps through the
+ * wavetable with the phase increment of the frequency and writes the same
+ * sample to both channels.
+ *
+ */
+void test_dsp_osc_render__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_osc_t osc = {0};
+
+    int32_t out[10U] = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, dsp_osc_init(&osc, DSP_OSC_WAVE_SINE, 4000U,
+                                         TEST_SAMPLE_RATE, TEST_LEVEL_UNITY));
+
+    TEST_STEP(2);
+    dsp_osc_render(&osc, 1U, out, 5U);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_INT32(0, out[0U]);
+    TEST_ASSERT_EQUAL_INT32(0x7FFF0000, out[2U]);
+    TEST_ASSERT_EQUAL_INT32(0x7FFF0000, out[3U]);
+    TEST_ASSERT_EQUAL_INT32(0, out[4U]);
+    TEST_ASSERT_EQUAL_INT32(-0x7FFF0000, out[6U]);
+    TEST_ASSERT_EQUAL_INT32(-0x7FFF0000, out[7U]);
+    TEST_ASSERT_EQUAL_INT32(0, out[8U]);
+}
+
+/**
+ * @brief The test verifies the dsp_osc_render function scales each oscillator
+ * by its level and saturates the sum.
+ *
+ */
+void test_dsp_osc_render__level_and_saturation__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_osc_t osc[2U] = {0};
+
+    int32_t out[6U] = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, dsp_osc_init(&osc[0U], DSP_OSC_WAVE_SINE, 4000U,
+                                         TEST_SAMPLE_RATE,
+                                         TEST_LEVEL_UNITY / 2U));
+    TEST_ASSERT_EQUAL(true, dsp_osc_init(&osc[1U], DSP_OSC_WAVE_SINE, 4000U,
+                                         TEST_SAMPLE_RATE, 0U));
+
+    TEST_STEP(2);
+    dsp_osc_render(osc, 2U, out, 2U);
+    TEST_ASSERT_EQUAL_INT32(16383 * 65536, out[2U]);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(true, dsp_osc_init(&osc[0U], DSP_OSC_WAVE_SINE, 4000U,
+                                         TEST_SAMPLE_RATE, TEST_LEVEL_UNITY));
+    TEST_ASSERT_EQUAL(true, dsp_osc_init(&osc[1U], DSP_OSC_WAVE_SINE, 4000U,
+                                         TEST_SAMPLE_RATE, TEST_LEVEL_UNITY));
+
+    TEST_STEP(4);
+    dsp_osc_render(osc, 2U, out, 3U);
+    TEST_ASSERT_EQUAL_INT32(0x7FFF0000, out[2U]);
+    TEST_ASSERT_EQUAL_INT32(0, out[4U]);
+}
+
+// end of file
@@ -0,0 +1,184 @@
+/**
+ * @file test_dsp_pcm.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the DSP PCM module.
+ *
+ * @version 0.1
+ *
+ * @date 16/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "dsp_pcm.h"
+
+#include <string.h>
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("dsp_pcm.c");
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the dsp_pcm_frame_size_get function returns the
+ * stored frame size and rejects an unsupported format.
+ *
+ */
+void test_dsp_pcm_frame_size_get__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_UINT32(2U, dsp_pcm_frame_size_get(16U, 1U));
+    TEST_ASSERT_EQUAL_UINT32(4U, dsp_pcm_frame_size_get(16U, 2U));
+    TEST_ASSERT_EQUAL_UINT32(4U, dsp_pcm_frame_size_get(32U, 1U));
+    TEST_ASSERT_EQUAL_UINT32(8U, dsp_pcm_frame_size_get(32U, 2U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_UINT32(0U, dsp_pcm_frame_size_get(24U, 2U));
+    TEST_ASSERT_EQUAL_UINT32(0U, dsp_pcm_frame_size_get(16U, 3U));
+}
+
+/**
+ * @brief The test verifies the dsp_pcm_expand function widens and duplicates
+ * the 16-bit mono frames in place.
+ *
+ */
+void test_dsp_pcm_expand__s16_mono_in_place__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const int16_t src[4U] = {0x1234, -2, INT16_MAX, INT16_MIN};
+
+    int32_t buff[8U] = {0};
+
+    // The stored frames are placed at the end of the buffer.
+    uint8_t *p_in = &((uint8_t *)buff)[sizeof(buff) - sizeof(src)];
+
+    (void)memcpy(p_in, src, sizeof(src));
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, dsp_pcm_expand(buff, p_in, 4U, 16U, 1U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0x12340000, buff[0U]);
+    TEST_ASSERT_EQUAL_INT32(0x12340000, buff[1U]);
+    TEST_ASSERT_EQUAL_INT32(-0x20000, buff[2U]);
+    TEST_ASSERT_EQUAL_INT32(-0x20000, buff[3U]);
+    TEST_ASSERT_EQUAL_INT32(0x7FFF0000, buff[4U]);
+    TEST_ASSERT_EQUAL_INT32(0x7FFF0000, buff[5U]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, buff[6U]);
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, buff[7U]);
+}
+
+/**
+ * @brief The test verifies the dsp_pcm_expand function widens the 16-bit
+ * stereo frames and duplicates the 32-bit mono frames in place.
+ *
+ */
+void test_dsp_pcm_expand__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const int16_t s16[4U] = {1, -1, 2, -2};
+
+    const int32_t s32[2U] = {0x11111111, -0x22222222};
+
+    int32_t buff[4U] = {0};
+
+    uint8_t *p_in = &((uint8_t *)buff)[sizeof(buff) - sizeof(s16)];
+
+    (void)memcpy(p_in, s16, sizeof(s16));
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, dsp_pcm_expand(buff, p_in, 2U, 16U, 2U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0x10000, buff[0U]);
+    TEST_ASSERT_EQUAL_INT32(-0x10000, buff[1U]);
+    TEST_ASSERT_EQUAL_INT32(0x20000, buff[2U]);
+    TEST_ASSERT_EQUAL_INT32(-0x20000, buff[3U]);
+
+    TEST_STEP(3);
+    (void)memcpy(&buff[2U], s32, sizeof(s32));
+    TEST_ASSERT_EQUAL(true, dsp_pcm_expand(buff, &buff[2U], 2U, 32U, 1U));
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL_INT32(0x11111111, buff[0U]);
+    TEST_ASSERT_EQUAL_INT32(0x11111111, buff[1U]);
+    TEST_ASSERT_EQUAL_INT32(-0x22222222, buff[2U]);
+    TEST_ASSERT_EQUAL_INT32(-0x22222222, buff[3U]);
+}
+
+/**
+ * @brief The test verifies the dsp_pcm_expand function rejects an unsupported
+ * format and an invalid argument.
+ *
+ */
+void test_dsp_pcm_expand__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    int32_t buff[2U] = {0};
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, dsp_pcm_expand(buff, buff, 1U, 8U, 2U));
+    TEST_ASSERT_EQUAL(false, dsp_pcm_expand(buff, buff, 1U, 16U, 0U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, dsp_pcm_expand(NULL, buff, 1U, 16U, 2U));
+    TEST_ASSERT_EQUAL(false, dsp_pcm_expand(buff, NULL, 1U, 16U, 2U));
+}
+
+// end of file
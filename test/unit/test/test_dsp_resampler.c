@@ -0,0 +1,863 @@
+/**
+ * @file test_dsp_resampler.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the DSP resampler module.
+ *
+ * @version 0.1
+ *
+ * @date 16/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "dsp_resampler.h"
+
+#include <string.h>
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("dsp_resampler.c");
+
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the output frame count of a test block.
+ *
+ */
+#define TEST_OUT_CNT (128U)
+
+/**
+ * @brief This macro indicates the frame count of a test buffer.
+ *
+ */
+#define TEST_BUFF_FRAME_CNT (256U)
+
+/**
+ * @brief This macro indicates the sample count of a test buffer.
+ *
+ */
+#define TEST_BUFF_SAMPLE_CNT (TEST_BUFF_FRAME_CNT * DSP_RESAMPLER_CH_CNT)
+
+/**
+ * @brief This macro indicates the block count of the streaming tests.
+ *
+ */
+#define TEST_BLOCK_CNT (6U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/**
+ * @brief Buffer used by the in-place tests.
+ *
+ */
+static int32_t m_test_buff[TEST_BUFF_SAMPLE_CNT];
+
+/**
+ * @brief Input buffer of the out-of-place reference.
+ *
+ */
+static int32_t m_test_in[TEST_BUFF_SAMPLE_CNT];
+
+/**
+ * @brief Output buffer of the out-of-place reference.
+ *
+ */
+static int32_t m_test_out[TEST_BUFF_SAMPLE_CNT];
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Returns the sample of the test signal at the given stream position.
+ *
+ */
+static int32_t test_signal_get(uint32_t frame, uint32_t ch)
+{
+    uint32_t seed = (frame * 2654435761U) ^ (ch * 40503U);
+
+    seed = (seed ^ (seed >> 13U)) * 1274126177U;
+
+    return (int32_t)seed >> 2;
+}
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the dsp_resampler_plan function at unity and
+ * doubled step.
+ *
+ */
+void test_dsp_resampler_plan__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t phase = dsp_resampler_phase_init_get();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_UINT32(TEST_OUT_CNT,
+                             dsp_resampler_plan(&phase,
+                                                TEST_OUT_CNT,
+                                                DSP_RESAMPLER_STEP_UNITY,
+                                                0));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_UINT32(dsp_resampler_phase_init_get(), phase);
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_UINT32(2U * TEST_OUT_CNT,
+                             dsp_resampler_plan(&phase,
+                                                TEST_OUT_CNT,
+                                                2U * DSP_RESAMPLER_STEP_UNITY,
+                                                0));
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL_UINT32(0U, dsp_resampler_plan(NULL, TEST_OUT_CNT, 1U, 0));
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_process function reproduces the
+ * input with a fixed delay at unity step across block boundaries.
+ *
+ */
+void test_dsp_resampler_process__unity_step__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_resampler_t rs;
+
+    uint32_t phase = dsp_resampler_phase_init_get();
+
+    uint32_t in_frame = 0U;
+    uint32_t out_frame = 0U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    dsp_resampler_init(&rs, DSP_RESAMPLER_MODE_LINEAR);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    for (uint32_t block = 0U; block < TEST_BLOCK_CNT; block++)
+    {
+        uint32_t in_cnt = dsp_resampler_plan(&phase,
+                                             TEST_OUT_CNT,
+                                             DSP_RESAMPLER_STEP_UNITY, 0);
+
+        for (uint32_t idx = 0U; idx < in_cnt; idx++)
+        {
+            m_test_in[idx * 2U] = test_signal_get(in_frame + idx, 0U);
+            m_test_in[(idx * 2U) + 1U] = test_signal_get(in_frame + idx, 1U);
+        }
+
+        in_frame += in_cnt;
+
+        TEST_ASSERT_EQUAL(true, dsp_resampler_process(&rs,
+                                                      m_test_in,
+                                                      in_cnt,
+                                                      m_test_out,
+                                                      TEST_OUT_CNT,
+                                                      DSP_RESAMPLER_STEP_UNITY,
+                                                      0));
+
+        for (uint32_t idx = 0U; idx < TEST_OUT_CNT; idx++)
+        {
+            // The history delays the stream by three frames.
+            uint32_t frame = out_frame + idx;
+
+            int32_t left = (3U <= frame) ? test_signal_get(frame - 3U, 0U) : 0;
+
+            TEST_ASSERT_EQUAL_INT32(left, m_test_out[idx * 2U]);
+        }
+
+        out_frame += TEST_OUT_CNT;
+    }
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_process function interpolates a
+ * ramp signal exactly with the linear kernel.
+ *
+ */
+void test_dsp_resampler_process__linear_ramp__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_resampler_t rs;
+
+    const uint32_t step = (DSP_RESAMPLER_STEP_UNITY * 3U) / 2U;
+
+    uint32_t phase = dsp_resampler_phase_init_get();
+
+    // **************************** Pre-Actions ***************************** //
+
+    dsp_resampler_init(&rs, DSP_RESAMPLER_MODE_LINEAR);
+
+    uint32_t in_cnt = dsp_resampler_plan(&phase, 16U, step, 0);
+
+    for (uint32_t idx = 0U; idx < in_cnt; idx++)
+    {
+        m_test_in[idx * 2U] = (int32_t)(idx * 1024U);
+        m_test_in[(idx * 2U) + 1U] = -(int32_t)(idx * 1024U);
+    }
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, dsp_resampler_process(&rs,
+                                                  m_test_in,
+                                                  in_cnt,
+                                                  m_test_out,
+                                                  16U,
+                                                  step,
+                                                  0));
+
+    TEST_STEP(2);
+    // Outputs from the fourth frame on only use the input frames.
+    for (uint32_t idx = 4U; idx < 16U; idx++)
+    {
+        int32_t expected = (int32_t)(((idx * 3U) - 6U) * 512U);
+
+        TEST_ASSERT_EQUAL_INT32(expected, m_test_out[idx * 2U]);
+        TEST_ASSERT_EQUAL_INT32(-expected, m_test_out[(idx * 2U) + 1U]);
+    }
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_process function keeps a DC input
+ * unchanged with the cubic kernel.
+ *
+ */
+void test_dsp_resampler_process__cubic_dc__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_resampler_t rs;
+
+    const uint32_t step = 70001U;
+
+    uint32_t phase = dsp_resampler_phase_init_get();
+
+    // **************************** Pre-Actions ***************************** //
+
+    dsp_resampler_init(&rs, DSP_RESAMPLER_MODE_CUBIC);
+
+    for (uint32_t idx = 0U; idx < TEST_BUFF_SAMPLE_CNT; idx++)
+    {
+        m_test_in[idx] = (0U == (idx & 1U)) ? INT32_MAX : INT32_MIN;
+    }
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    for (uint32_t block = 0U; block < 3U; block++)
+    {
+        uint32_t in_cnt = dsp_resampler_plan(&phase, TEST_OUT_CNT, step, 0);
+
+        TEST_ASSERT_EQUAL(true, dsp_resampler_process(&rs,
+                                                      m_test_in,
+                                                      in_cnt,
+                                                      m_test_out,
+                                                      TEST_OUT_CNT,
+                                                      step,
+                                                      0));
+    }
+
+    TEST_STEP(2);
+    for (uint32_t idx = 0U; idx < TEST_OUT_CNT; idx++)
+    {
+        TEST_ASSERT_EQUAL_INT32(INT32_MAX, m_test_out[idx * 2U]);
+        TEST_ASSERT_EQUAL_INT32(INT32_MIN, m_test_out[(idx * 2U) + 1U]);
+    }
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_process function gives the same
+ * result in place as out of place over the whole step range.
+ *
+ */
+void test_dsp_resampler_process__in_place__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint32_t steps[] = {
+        DSP_RESAMPLER_STEP_MIN, 40000U, DSP_RESAMPLER_STEP_UNITY, 77777U,
+        100000U, DSP_RESAMPLER_STEP_MAX,
+    };
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, TEST_BUFF_FRAME_CNT >=
+                            DSP_RESAMPLER_INPLACE_FRAME_CNT(TEST_OUT_CNT));
+
+    TEST_STEP(2);
+    for (uint32_t mode = 0U; mode < 2U; mode++)
+    {
+        for (uint32_t s = 0U; s < (sizeof(steps) / sizeof(steps[0])); s++)
+        {
+            dsp_resampler_t rs_ref;
+            dsp_resampler_t rs;
+
+            uint32_t phase = dsp_resampler_phase_init_get();
+
+            uint32_t in_frame = 0U;
+
+            dsp_resampler_init(&rs_ref, (dsp_resampler_mode_t)mode);
+            dsp_resampler_init(&rs, (dsp_resampler_mode_t)mode);
+
+            for (uint32_t block = 0U; block < TEST_BLOCK_CNT; block++)
+            {
+                uint32_t in_cnt = dsp_resampler_plan(&phase,
+                                                     TEST_OUT_CNT,
+                                                     steps[s], 0);
+
+                uint32_t in_offset = (TEST_BUFF_FRAME_CNT - in_cnt) * 2U;
+
+                for (uint32_t idx = 0U; idx < (in_cnt * 2U); idx++)
+                {
+                    int32_t val = test_signal_get(in_frame + (idx / 2U),
+                                                  idx & 1U);
+
+                    m_test_in[idx] = val;
+                    m_test_buff[in_offset + idx] = val;
+                }
+
+                in_frame += in_cnt;
+
+                TEST_ASSERT_EQUAL(true, dsp_resampler_process(&rs_ref,
+                                                              m_test_in,
+                                                              in_cnt,
+                                                              m_test_out,
+                                                              TEST_OUT_CNT,
+                                                              steps[s],
+                                                              0));
+
+                TEST_ASSERT_EQUAL(true, dsp_resampler_process(&rs,
+                                                              &m_test_buff[in_offset],
+                                                              in_cnt,
+                                                              m_test_buff,
+                                                              TEST_OUT_CNT,
+                                                              steps[s],
+                                                              0));
+
+                TEST_ASSERT_EQUAL_INT32_ARRAY(m_test_out,
+                                              m_test_buff,
+                                              TEST_OUT_CNT * 2U);
+            }
+        }
+    }
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_process function rejects an
+ * input frame count that does not match the plan.
+ *
+ */
+void test_dsp_resampler_process__wrong_in_cnt__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_resampler_t rs;
+
+    // **************************** Pre-Actions ***************************** //
+
+    dsp_resampler_init(&rs, DSP_RESAMPLER_MODE_LINEAR);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, dsp_resampler_process(&rs,
+                                                   m_test_in,
+                                                   TEST_OUT_CNT + 1U,
+                                                   m_test_out,
+                                                   TEST_OUT_CNT,
+                                                   DSP_RESAMPLER_STEP_UNITY,
+                                                   0));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, dsp_resampler_process(NULL,
+                                                   m_test_in,
+                                                   TEST_OUT_CNT,
+                                                   m_test_out,
+                                                   TEST_OUT_CNT,
+                                                   DSP_RESAMPLER_STEP_UNITY,
+                                                   0));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_UINT32(dsp_resampler_phase_init_get(), rs.phase);
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_bypass function gives the output
+ * of the dsp_resampler_process function at unity step, with the input stored
+ * in the output buffer.
+ *
+ */
+void test_dsp_resampler_bypass__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_resampler_t rs_ref;
+    dsp_resampler_t rs;
+
+    uint32_t phase = dsp_resampler_phase_init_get();
+
+    uint32_t in_frame = 0U;
+
+    int32_t *p_in = &m_test_buff[DSP_RESAMPLER_DELAY_CNT * 2U];
+
+    // **************************** Pre-Actions ***************************** //
+
+    dsp_resampler_init(&rs_ref, DSP_RESAMPLER_MODE_CUBIC);
+    dsp_resampler_init(&rs, DSP_RESAMPLER_MODE_CUBIC);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(true, dsp_resampler_bypass_get(phase,
+                                                     DSP_RESAMPLER_STEP_UNITY,
+                                                     0));
+
+    TEST_STEP(2);
+    for (uint32_t block = 0U; block < TEST_BLOCK_CNT; block++)
+    {
+        uint32_t in_cnt = dsp_resampler_plan(&phase,
+                                             TEST_OUT_CNT,
+                                             DSP_RESAMPLER_STEP_UNITY, 0);
+
+        for (uint32_t idx = 0U; idx < in_cnt; idx++)
+        {
+            m_test_in[idx * 2U] = test_signal_get(in_frame + idx, 0U);
+            m_test_in[(idx * 2U) + 1U] = test_signal_get(in_frame + idx, 1U);
+        }
+
+        (void)memcpy(p_in, m_test_in, in_cnt * 2U * sizeof(int32_t));
+
+        in_frame += in_cnt;
+
+        TEST_ASSERT_EQUAL(true, dsp_resampler_process(&rs_ref,
+                                                      m_test_in,
+                                                      in_cnt,
+                                                      m_test_out,
+                                                      TEST_OUT_CNT,
+                                                      DSP_RESAMPLER_STEP_UNITY,
+                                                      0));
+
+        TEST_ASSERT_EQUAL(true, dsp_resampler_bypass(&rs,
+                                                     m_test_buff,
+                                                     TEST_OUT_CNT));
+
+        TEST_ASSERT_EQUAL_INT32_ARRAY(m_test_out,
+                                      m_test_buff,
+                                      TEST_OUT_CNT * 2U);
+    }
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(rs_ref.hist,
+                                  rs.hist,
+                                  DSP_RESAMPLER_HIST_CNT * 2U);
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_bypass function refuses a block
+ * that has to be interpolated.
+ *
+ */
+void test_dsp_resampler_bypass__when_phase_not_init__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    dsp_resampler_t rs;
+
+    uint32_t phase = dsp_resampler_phase_init_get();
+
+    // **************************** Pre-Actions ***************************** //
+
+    dsp_resampler_init(&rs, DSP_RESAMPLER_MODE_LINEAR);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, dsp_resampler_bypass_get(phase + 1U,
+                                                      DSP_RESAMPLER_STEP_UNITY,
+                                                      0));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, dsp_resampler_bypass_get(phase,
+                                                      DSP_RESAMPLER_STEP_MAX,
+                                                      0));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, dsp_resampler_bypass_get(phase,
+                                                      DSP_RESAMPLER_STEP_UNITY,
+                                                      1));
+
+    TEST_STEP(4);
+    rs.phase = phase + 1U;
+    TEST_ASSERT_EQUAL(false, dsp_resampler_bypass(&rs,
+                                                  m_test_buff,
+                                                  TEST_OUT_CNT));
+
+    TEST_STEP(5);
+    TEST_ASSERT_EQUAL(false, dsp_resampler_bypass(NULL,
+                                                  m_test_buff,
+                                                  TEST_OUT_CNT));
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_phase_align function brings the
+ * phase back to a frame after a step ramp, so the blocks at unity step are
+ * bypassed again with the output of the dsp_resampler_process function.
+ *
+ */
+void test_dsp_resampler_phase_align__after_step_ramp__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint32_t targets[TEST_BLOCK_CNT] = {
+        70001U, DSP_RESAMPLER_STEP_UNITY, DSP_RESAMPLER_STEP_UNITY,
+        DSP_RESAMPLER_STEP_UNITY, DSP_RESAMPLER_STEP_UNITY,
+        DSP_RESAMPLER_STEP_UNITY,
+    };
+
+    dsp_resampler_t rs_ref;
+    dsp_resampler_t rs;
+
+    uint32_t phase = dsp_resampler_phase_init_get();
+
+    uint32_t step = DSP_RESAMPLER_STEP_UNITY;
+
+    uint32_t in_frame = 0U;
+
+    uint32_t bypass_cnt = 0U;
+
+    int32_t *p_in = &m_test_buff[DSP_RESAMPLER_DELAY_CNT * 2U];
+
+    // **************************** Pre-Actions ***************************** //
+
+    dsp_resampler_init(&rs, DSP_RESAMPLER_MODE_CUBIC);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    for (uint32_t block = 0U; block < TEST_BLOCK_CNT; block++)
+    {
+        int32_t step_inc = dsp_resampler_ramp_get(&step,
+                                                  targets[block],
+                                                  TEST_OUT_CNT);
+
+        uint32_t block_step = step;
+
+        (void)dsp_resampler_phase_align(&phase,
+                                        &block_step,
+                                        step_inc,
+                                        TEST_OUT_CNT);
+
+        rs.phase = phase;
+
+        bool bypass = dsp_resampler_bypass_get(phase, block_step, step_inc);
+
+        uint32_t in_cnt = dsp_resampler_plan(&phase,
+                                             TEST_OUT_CNT,
+                                             block_step,
+                                             step_inc);
+
+        for (uint32_t idx = 0U; idx < in_cnt; idx++)
+        {
+            m_test_in[idx * 2U] = test_signal_get(in_frame + idx, 0U);
+            m_test_in[(idx * 2U) + 1U] = test_signal_get(in_frame + idx, 1U);
+        }
+
+        in_frame += in_cnt;
+
+        rs_ref = rs;
+
+        TEST_ASSERT_EQUAL(true, dsp_resampler_process(&rs_ref,
+                                                      m_test_in,
+                                                      in_cnt,
+                                                      m_test_out,
+                                                      TEST_OUT_CNT,
+                                                      block_step,
+                                                      step_inc));
+
+        if (true == bypass)
+        {
+            (void)memcpy(p_in, m_test_in, in_cnt * 2U * sizeof(int32_t));
+
+            TEST_ASSERT_EQUAL(true, dsp_resampler_bypass(&rs,
+                                                         m_test_buff,
+                                                         TEST_OUT_CNT));
+
+            TEST_ASSERT_EQUAL_INT32_ARRAY(m_test_out,
+                                          m_test_buff,
+                                          TEST_OUT_CNT * 2U);
+
+            TEST_ASSERT_EQUAL_INT32_ARRAY(rs_ref.hist,
+                                          rs.hist,
+                                          DSP_RESAMPLER_HIST_CNT * 2U);
+
+            bypass_cnt++;
+        }
+
+        rs = rs_ref;
+
+        step += (uint32_t)(step_inc * (int32_t)TEST_OUT_CNT);
+    }
+
+    TEST_STEP(2);
+    // The step is back at unity from the third block, which glides to a
+    // frame, the blocks after it are bypassed.
+    TEST_ASSERT_EQUAL_UINT32(TEST_BLOCK_CNT - 3U, bypass_cnt);
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_phase_align function leaves a
+ * block that is not at the unity step or already at a frame.
+ *
+ */
+void test_dsp_resampler_phase_align__when_not_unity__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint32_t phase_init = dsp_resampler_phase_init_get();
+
+    uint32_t phase = phase_init + 1000U;
+
+    uint32_t step = DSP_RESAMPLER_STEP_MAX;
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, dsp_resampler_phase_align(&phase,
+                                                       &step,
+                                                       0,
+                                                       TEST_OUT_CNT));
+
+    TEST_STEP(2);
+    step = DSP_RESAMPLER_STEP_UNITY;
+    TEST_ASSERT_EQUAL(false, dsp_resampler_phase_align(&phase,
+                                                       &step,
+                                                       1,
+                                                       TEST_OUT_CNT));
+
+    TEST_STEP(3);
+    phase = phase_init;
+    TEST_ASSERT_EQUAL(false, dsp_resampler_phase_align(&phase,
+                                                       &step,
+                                                       0,
+                                                       TEST_OUT_CNT));
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(false, dsp_resampler_phase_align(NULL,
+                                                       &step,
+                                                       0,
+                                                       TEST_OUT_CNT));
+
+    TEST_STEP(5);
+    phase = phase_init + TEST_OUT_CNT - 1U;
+    TEST_ASSERT_EQUAL(true, dsp_resampler_phase_align(&phase,
+                                                      &step,
+                                                      0,
+                                                      TEST_OUT_CNT));
+    TEST_ASSERT_EQUAL_UINT32(phase_init, phase);
+    TEST_ASSERT_EQUAL_UINT32(DSP_RESAMPLER_STEP_UNITY, step);
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_ramp_get function spreads the
+ * step change over the block and snaps a small change at once.
+ *
+ */
+void test_dsp_resampler_ramp_get__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t step = DSP_RESAMPLER_STEP_UNITY;
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_INT32(256, dsp_resampler_ramp_get(&step,
+                                                        DSP_RESAMPLER_STEP_UNITY +
+                                                        (256U * TEST_OUT_CNT),
+                                                        TEST_OUT_CNT));
+    TEST_ASSERT_EQUAL_UINT32(DSP_RESAMPLER_STEP_UNITY, step);
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_INT32(0, dsp_resampler_ramp_get(&step,
+                                                      DSP_RESAMPLER_STEP_UNITY +
+                                                      TEST_OUT_CNT - 1U,
+                                                      TEST_OUT_CNT));
+    TEST_ASSERT_EQUAL_UINT32(DSP_RESAMPLER_STEP_UNITY + TEST_OUT_CNT - 1U, step);
+
+    TEST_STEP(3);
+    step = DSP_RESAMPLER_STEP_MAX;
+    TEST_ASSERT_EQUAL_INT32(-(int32_t)((DSP_RESAMPLER_STEP_MAX -
+                                        DSP_RESAMPLER_STEP_MIN) /
+                                       TEST_OUT_CNT),
+                            dsp_resampler_ramp_get(&step, 0U, TEST_OUT_CNT));
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL_INT32(0, dsp_resampler_ramp_get(NULL,
+                                                      DSP_RESAMPLER_STEP_UNITY,
+                                                      TEST_OUT_CNT));
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_process function keeps the plan
+ * and the in-place output consistent while the step ramps between blocks.
+ *
+ */
+void test_dsp_resampler_process__step_ramp__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    const uint32_t targets[TEST_BLOCK_CNT] = {
+        DSP_RESAMPLER_STEP_MAX, DSP_RESAMPLER_STEP_MAX, DSP_RESAMPLER_STEP_MIN,
+        DSP_RESAMPLER_STEP_UNITY + 100U, DSP_RESAMPLER_STEP_UNITY,
+        DSP_RESAMPLER_STEP_MAX,
+    };
+
+    dsp_resampler_t rs;
+
+    uint32_t phase = dsp_resampler_phase_init_get();
+
+    uint32_t step = DSP_RESAMPLER_STEP_UNITY;
+
+    // **************************** Pre-Actions ***************************** //
+
+    dsp_resampler_init(&rs, DSP_RESAMPLER_MODE_CUBIC);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    for (uint32_t block = 0U; block < TEST_BLOCK_CNT; block++)
+    {
+        int32_t step_inc = dsp_resampler_ramp_get(&step,
+                                                  targets[block],
+                                                  TEST_OUT_CNT);
+
+        uint32_t in_cnt = dsp_resampler_plan(&phase,
+                                             TEST_OUT_CNT,
+                                             step,
+                                             step_inc);
+
+        TEST_ASSERT_EQUAL(true, TEST_BUFF_FRAME_CNT >= in_cnt);
+
+        uint32_t in_offset = (TEST_BUFF_FRAME_CNT - in_cnt) * 2U;
+
+        for (uint32_t idx = 0U; idx < (in_cnt * 2U); idx++)
+        {
+            m_test_buff[in_offset + idx] = 0x100000;
+        }
+
+        TEST_ASSERT_EQUAL(true, dsp_resampler_process(&rs,
+                                                      &m_test_buff[in_offset],
+                                                      in_cnt,
+                                                      m_test_buff,
+                                                      TEST_OUT_CNT,
+                                                      step,
+                                                      step_inc));
+
+        TEST_ASSERT_EQUAL_UINT32(phase, rs.phase);
+
+        step += (uint32_t)(step_inc * (int32_t)TEST_OUT_CNT);
+
+        int32_t rest = (int32_t)targets[block] - (int32_t)step;
+
+        TEST_ASSERT_EQUAL(true, (rest > -(int32_t)TEST_OUT_CNT) &&
+                                (rest < (int32_t)TEST_OUT_CNT));
+    }
+}
+
+/**
+ * @brief The test verifies the dsp_resampler_step_clamp function.
+ *
+ */
+void test_dsp_resampler_step_clamp__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_UINT32(DSP_RESAMPLER_STEP_MIN,
+                             dsp_resampler_step_clamp(0U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL_UINT32(DSP_RESAMPLER_STEP_MAX,
+                             dsp_resampler_step_clamp(0xFFFFFFFFU));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL_UINT32(DSP_RESAMPLER_STEP_UNITY,
+                             dsp_resampler_step_clamp(DSP_RESAMPLER_STEP_UNITY));
+}
+
+// end of file
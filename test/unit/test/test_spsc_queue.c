@@ -0,0 +1,233 @@
+/**
+ * @file test_spsc_queue.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief These tests verify the units of the SPSC queue module.
+ *
+ * @version 0.1
+ *
+ * @date 16/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+//First - include test framework headers
+#include "unity.h"
+#include "support.h"
+
+// Second - include the module to be tested
+#include "spsc_queue.h"
+
+/*******************************************************************************
+ * Test Files
+ ******************************************************************************/
+
+TEST_FILE("spsc_queue.c");
+
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/**
+ * @brief This macro indicates the item capacity of the test queue.
+ *
+ */
+#define TEST_QUEUE_CAP (3U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/**
+ * @brief This variable holds the storage of the test queue.
+ */
+static volatile uint32_t m_test_item[SPSC_QUEUE_STORAGE_SIZE(TEST_QUEUE_CAP)];
+
+/**
+ * @brief This variable holds the test queue.
+ */
+static spsc_queue_t m_test_queue;
+
+/*******************************************************************************
+ * Setup & Teardown
+ ******************************************************************************/
+
+void setUp()
+{
+    (void)spsc_queue_init(&m_test_queue,
+                          m_test_item,
+                          SPSC_QUEUE_STORAGE_SIZE(TEST_QUEUE_CAP));
+}
+
+void tearDown()
+{
+}
+
+void suiteSetUp(void)
+{
+}
+
+int suiteTearDown(int num_failures)
+{
+    (void)num_failures;
+    return 0;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+
+/**
+ * @brief The test verifies the spsc_queue_init function rejects the invalid
+ * arguments.
+ *
+ */
+void test_spsc_queue_init__when_use_invalid_argument__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    spsc_queue_t queue;
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, spsc_queue_init(NULL, m_test_item, 2U));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, spsc_queue_init(&queue, NULL, 2U));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(false, spsc_queue_init(&queue, m_test_item, 1U));
+}
+
+/**
+ * @brief The test verifies the items are popped in the pushed order and the
+ * count follows the pushes and pops.
+ *
+ */
+void test_spsc_queue_push__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t item = 0U;
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL_UINT32(0U, spsc_queue_cnt_get(&m_test_queue));
+    TEST_ASSERT_EQUAL(false, spsc_queue_pop(&m_test_queue, &item));
+    TEST_ASSERT_EQUAL(false, spsc_queue_peek(&m_test_queue, &item));
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(true, spsc_queue_push(&m_test_queue, 10U));
+    TEST_ASSERT_EQUAL(true, spsc_queue_push(&m_test_queue, 11U));
+    TEST_ASSERT_EQUAL_UINT32(2U, spsc_queue_cnt_get(&m_test_queue));
+
+    TEST_STEP(3);
+    TEST_ASSERT_EQUAL(true, spsc_queue_peek(&m_test_queue, &item));
+    TEST_ASSERT_EQUAL_UINT32(10U, item);
+    TEST_ASSERT_EQUAL(true, spsc_queue_pop(&m_test_queue, &item));
+    TEST_ASSERT_EQUAL_UINT32(10U, item);
+    TEST_ASSERT_EQUAL(true, spsc_queue_pop(&m_test_queue, &item));
+    TEST_ASSERT_EQUAL_UINT32(11U, item);
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL_UINT32(0U, spsc_queue_cnt_get(&m_test_queue));
+}
+
+/**
+ * @brief The test verifies the spsc_queue_peek_at function reads the items in
+ * order across the storage wrap.
+ *
+ */
+void test_spsc_queue_peek_at__usual_run__success(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t item = 0U;
+
+    // **************************** Pre-Actions ***************************** //
+
+    // The tail is moved, so the items wrap at the end of the storage.
+    (void)spsc_queue_push(&m_test_queue, 9U);
+    (void)spsc_queue_push(&m_test_queue, 9U);
+    (void)spsc_queue_pop(&m_test_queue, &item);
+    (void)spsc_queue_pop(&m_test_queue, &item);
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    TEST_ASSERT_EQUAL(false, spsc_queue_peek_at(&m_test_queue, 0U, &item));
+
+    TEST_STEP(2);
+    for (uint32_t idx = 0U; idx < TEST_QUEUE_CAP; idx++)
+    {
+        TEST_ASSERT_EQUAL(true, spsc_queue_push(&m_test_queue, 20U + idx));
+    }
+
+    TEST_STEP(3);
+    for (uint32_t pos = 0U; pos < TEST_QUEUE_CAP; pos++)
+    {
+        TEST_ASSERT_EQUAL(true, spsc_queue_peek_at(&m_test_queue, pos, &item));
+        TEST_ASSERT_EQUAL_UINT32(20U + pos, item);
+    }
+
+    TEST_STEP(4);
+    TEST_ASSERT_EQUAL(false,
+                      spsc_queue_peek_at(&m_test_queue, TEST_QUEUE_CAP, &item));
+    TEST_ASSERT_EQUAL_UINT32(TEST_QUEUE_CAP, spsc_queue_cnt_get(&m_test_queue));
+}
+
+/**
+ * @brief The test verifies the queue rejects a push when it is full and keeps
+ * the order while the indices wrap.
+ *
+ */
+void test_spsc_queue_push__when_queue_full__fail(void)
+{
+    TEST_CASE();
+
+    // **************************** Input Params **************************** //
+
+    uint32_t item = 0U;
+
+    // **************************** Test Steps ****************************** //
+
+    TEST_STEP(1);
+    for (uint32_t idx = 0U; idx < TEST_QUEUE_CAP; idx++)
+    {
+        TEST_ASSERT_EQUAL(true, spsc_queue_push(&m_test_queue, idx));
+    }
+
+    TEST_STEP(2);
+    TEST_ASSERT_EQUAL(false, spsc_queue_push(&m_test_queue, 99U));
+    TEST_ASSERT_EQUAL_UINT32(TEST_QUEUE_CAP, spsc_queue_cnt_get(&m_test_queue));
+
+    TEST_STEP(3);
+    for (uint32_t idx = 0U; idx < (TEST_QUEUE_CAP * 4U); idx++)
+    {
+        TEST_ASSERT_EQUAL(true, spsc_queue_pop(&m_test_queue, &item));
+        TEST_ASSERT_EQUAL_UINT32(idx, item);
+        TEST_ASSERT_EQUAL(true,
+                          spsc_queue_push(&m_test_queue, idx + TEST_QUEUE_CAP));
+        TEST_ASSERT_EQUAL_UINT32(TEST_QUEUE_CAP,
+                                 spsc_queue_cnt_get(&m_test_queue));
+    }
+
+    TEST_STEP(4);
+    spsc_queue_reset(&m_test_queue);
+    TEST_ASSERT_EQUAL_UINT32(0U, spsc_queue_cnt_get(&m_test_queue));
+    TEST_ASSERT_EQUAL(false, spsc_queue_pop(&m_test_queue, &item));
+}
+
+// end of file
@@ -0,0 +1,99 @@
+/**
+ * @file adpcm_encode.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Converts a 32-bit stereo PCM audio file to the IMA-ADPCM slot
+ *         format.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Usage: adpcm_encode <pcm_in.bin> <adpcm_out.bin>
+ *
+ * The output is written to the audio slot as it is. The audio configuration
+ * table of the slot has to carry the output size and the ADPCM format flag
+ * (reserved area byte 8 set to 1).
+ *
+ */
+
+#include "adpcm_encoder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv)
+{
+    if (3 != argc)
+    {
+        fprintf(stderr, "usage: %s <pcm_in.bin> <adpcm_out.bin>\n", argv[0]);
+
+        return 1;
+    }
+
+    FILE *p_in = fopen(argv[1], "rb");
+
+    if (NULL == p_in)
+    {
+        perror(argv[1]);
+
+        return 1;
+    }
+
+    FILE *p_out = fopen(argv[2], "wb");
+
+    if (NULL == p_out)
+    {
+        perror(argv[2]);
+
+        (void)fclose(p_in);
+
+        return 1;
+    }
+
+    static int32_t pcm[DSP_ADPCM_BLOCK_FRAME_CNT * DSP_ADPCM_CH_CNT];
+    static uint8_t block[DSP_ADPCM_BLOCK_SIZE];
+
+    dsp_adpcm_t enc = {0};
+
+    uint32_t in_size = 0U;
+    uint32_t out_size = 0U;
+
+    for (;;)
+    {
+        size_t frame_cnt = fread(pcm,
+                                 sizeof(int32_t) * DSP_ADPCM_CH_CNT,
+                                 DSP_ADPCM_BLOCK_FRAME_CNT,
+                                 p_in);
+
+        if (0U == frame_cnt)
+        {
+            break;
+        }
+
+        uint32_t size = adpcm_block_encode(&enc, pcm, (uint32_t)frame_cnt,
+                                           block);
+
+        if (size != fwrite(block, 1U, size, p_out))
+        {
+            perror(argv[2]);
+
+            break;
+        }
+
+        in_size += (uint32_t)frame_cnt * 8U;
+        out_size += size;
+    }
+
+    (void)fclose(p_in);
+    (void)fclose(p_out);
+
+    printf("%u -> %u bytes (%.2f:1), cfg table size field: %u\n",
+           in_size,
+           out_size,
+           (0U != out_size) ? ((double)in_size / (double)out_size) : 0.0,
+           out_size);
+
+    return 0;
+}
+
+// end of file
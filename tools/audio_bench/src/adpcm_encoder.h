@@ -0,0 +1,120 @@
+/**
+ * @file adpcm_encoder.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Host-side IMA-ADPCM encoder of the compressed audio slots.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The encoder follows the block layout of dsp_adpcm.h and tracks the state
+ * with dsp_adpcm_code_decode(), so the firmware decodes exactly the samples
+ * the encoder has predicted.
+ *
+ */
+
+#ifndef ADPCM_ENCODER_H
+#define ADPCM_ENCODER_H
+
+#include "dsp_adpcm.h"
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Returns the 4-bit code of one 16-bit sample and updates the state.
+ *
+ */
+static inline uint8_t adpcm_sample_encode(dsp_adpcm_ch_t *p_ch, int32_t sample)
+{
+    int32_t diff = sample - p_ch->pred;
+
+    uint32_t code = 0U;
+
+    if (0 > diff)
+    {
+        code = 0x08U;
+        diff = -diff;
+    }
+
+    int32_t step = (int32_t)dsp_adpcm_step_get(p_ch->index);
+
+    if (diff >= step)
+    {
+        code |= 0x04U;
+        diff -= step;
+    }
+
+    if (diff >= (step >> 1))
+    {
+        code |= 0x02U;
+        diff -= step >> 1;
+    }
+
+    if (diff >= (step >> 2))
+    {
+        code |= 0x01U;
+    }
+
+    (void)dsp_adpcm_code_decode(p_ch, code);
+
+    return (uint8_t)code;
+}
+
+/**
+ * @brief Converts one 32-bit PCM sample to 16 bits with rounding.
+ *
+ */
+static inline int32_t adpcm_pcm_s16_get(int32_t sample)
+{
+    int64_t val = ((int64_t)sample + 0x8000) >> 16;
+
+    return (val > INT16_MAX) ? INT16_MAX : (int32_t)val;
+}
+
+/**
+ * @brief Encodes up to DSP_ADPCM_BLOCK_FRAME_CNT 32-bit stereo frames to one
+ *        block. The state is carried on to the next block.
+ *
+ * @return Byte count of the block.
+ *
+ */
+static inline uint32_t adpcm_block_encode(dsp_adpcm_t *p_enc,
+                                          const int32_t *p_in,
+                                          uint32_t frame_cnt,
+                                          uint8_t *p_out)
+{
+    for (uint32_t ch = 0U; ch < DSP_ADPCM_CH_CNT; ch++)
+    {
+        uint8_t *p_hdr = &p_out[ch * DSP_ADPCM_CH_HDR_SIZE];
+
+        uint16_t pred = (uint16_t)(int16_t)p_enc->ch[ch].pred;
+
+        p_hdr[0] = (uint8_t)(pred & 0xFFU);
+        p_hdr[1] = (uint8_t)(pred >> 8);
+        p_hdr[2] = (uint8_t)p_enc->ch[ch].index;
+        p_hdr[3] = 0U;
+    }
+
+    for (uint32_t frame = 0U; frame < frame_cnt; frame++)
+    {
+        uint8_t left = adpcm_sample_encode(&p_enc->ch[0],
+                                           adpcm_pcm_s16_get(p_in[0]));
+
+        uint8_t right = adpcm_sample_encode(&p_enc->ch[1],
+                                            adpcm_pcm_s16_get(p_in[1]));
+
+        p_out[DSP_ADPCM_HDR_SIZE + frame] = (uint8_t)(left | (right << 4));
+
+        p_in += DSP_ADPCM_CH_CNT;
+    }
+
+    return DSP_ADPCM_HDR_SIZE + frame_cnt;
+}
+
+#endif /* ADPCM_ENCODER_H */
+
+// end of file
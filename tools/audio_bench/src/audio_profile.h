@@ -0,0 +1,102 @@
+/**
+ * @file audio_profile.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Stage timing of the audio pipeline in the host build of api_audio.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * api_audio.c includes this header when it is built with API_AUDIO_PROFILE.
+ * The target build leaves the stage marks empty.
+ *
+ */
+
+#ifndef AUDIO_PROFILE_H
+#define AUDIO_PROFILE_H
+
+#include "bench_common.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief Starts timing a stage of the pipeline.
+ *
+ */
+#define AUDIO_PROFILE_BEGIN(stage) \
+    (g_audio_profile[(stage)].start_ns = bench_now_ns())
+
+/**
+ * @brief Stops timing a stage of the pipeline and counts one block.
+ *
+ */
+#define AUDIO_PROFILE_END(stage) audio_profile_end(stage)
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+
+/**
+ * @brief List of the timed stages of the pipeline.
+ *
+ */
+typedef enum audio_profile_stage_e
+{
+    AUDIO_PROFILE_DECODE = 0U,
+    AUDIO_PROFILE_SYNTH = 1U,
+    AUDIO_PROFILE_EDIT = 2U,
+    AUDIO_PROFILE_CHAIN = 3U,
+    AUDIO_PROFILE_CRC = 4U,
+    AUDIO_PROFILE_PROCESS = 5U,
+    AUDIO_PROFILE_STAGE_CNT = 6U,
+
+} audio_profile_stage_t;
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to the timing of one stage.
+ *
+ */
+typedef struct audio_profile_s
+{
+    uint64_t start_ns;
+    uint64_t total_ns;
+
+    uint32_t block_cnt;
+
+} audio_profile_t;
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+
+/**
+ * @brief Timing of the stages, defined by the render tool.
+ *
+ */
+extern audio_profile_t g_audio_profile[AUDIO_PROFILE_STAGE_CNT];
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Stops timing a stage of the pipeline and counts one block.
+ *
+ */
+static inline void audio_profile_end(audio_profile_stage_t stage)
+{
+    audio_profile_t *p_profile = &g_audio_profile[stage];
+
+    p_profile->total_ns += bench_now_ns() - p_profile->start_ns;
+    p_profile->block_cnt++;
+}
+
+#endif /* AUDIO_PROFILE_H */
+
+// end of file
@@ -0,0 +1,555 @@
+/**
+ * @file audio_render.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Runs the real api_audio pipeline on the host against a flash image
+ *         and a speed profile, renders the played audio to a WAV file and
+ *         reports the cost of each pipeline stage.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Usage: audio_render [options] <flash.bin> <out.wav>
+ *
+ *   -a <n>    Audio number stored in the EEPROM (default 0).
+ *   -s <file> Speed profile, one "<time s> <speed km/h>" pair per line in
+ *             increasing time order. The speed is interpolated between the
+ *             lines and held after the last one. '#' starts a comment.
+ *   -t <s>    Rendered duration in seconds (default 10).
+ *   -c <n>    api_audio_process() calls per played slot (default 3).
+ *   -v <lvl>  Printed log level, 1 (verbose) to 6 (fatal), 0 is off.
+ *   -w <n>    Audio number switched to during the render (default none).
+ *   -x <s>    Time of the switch in seconds (default 1).
+ *   -p <0|1>  The switched audio is prefetched once the playback starts
+ *             (default 1), 0 renders the switch with the playback stopped.
+ *
+ * The WAV file holds the 32-bit stereo frames as the I2S ring plays them, so
+ * two renders of the same input can be compared sample by sample. The time
+ * runs with the played slots, the silence before the ring starts is kept. The
+ * WAV sample rate is the I2S rate set by the played audio.
+ *
+ */
+
+#include "audio_profile.h"
+#include "host_port.h"
+
+#include "api_audio.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief Highest frame count of one played slot, same as
+ *        AUDIO_BLOCK_FRAME_CNT. It is also the silence written per slot
+ *        before the ring starts.
+ *
+ */
+#define RENDER_SLOT_FRAME_CNT (32U)
+
+/**
+ * @brief Channel count of the played frames.
+ *
+ */
+#define RENDER_CH_CNT (2U)
+
+/**
+ * @brief Period of the vehicle speed updates in ms, the TCO1 cycle time.
+ *
+ */
+#define RENDER_SPEED_PERIOD_MS (50U)
+
+/**
+ * @brief api_audio_process() call count before the playback is started, the
+ *        configuration table is read and decoded meanwhile.
+ *
+ */
+#define RENDER_INIT_CALL_CNT (50U)
+
+/**
+ * @brief Highest line count of the speed profile.
+ *
+ */
+#define RENDER_SPEED_POINT_MAX (256U)
+
+/**
+ * @brief Audio number of no switch.
+ *
+ */
+#define RENDER_SWITCH_NONE (UINT32_MAX)
+
+/**
+ * @brief Size of the WAV header.
+ *
+ */
+#define WAV_HDR_SIZE (44U)
+
+/*******************************************************************************
+ * Structs
+ ******************************************************************************/
+
+/**
+ * @brief Data structure corresponds to one line of the speed profile.
+ *
+ */
+typedef struct render_speed_s
+{
+    double time_s;
+    double speed_kmh;
+
+} render_speed_t;
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+
+audio_profile_t g_audio_profile[AUDIO_PROFILE_STAGE_CNT];
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+static render_speed_t m_speed[RENDER_SPEED_POINT_MAX];
+static uint32_t m_speed_cnt = 0U;
+
+static const char *const mp_stage_name[AUDIO_PROFILE_STAGE_CNT] = {
+    "decode (flash to PCM)",
+    "synth (oscillators)",
+    "edit (resample, gain, mix)",
+    "chain (EQ, gain, limiter)",
+    "crc (audio check)",
+    "api_audio_process (total)",
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Reads the speed profile.
+ *
+ */
+static bool speed_load(const char *p_path)
+{
+    FILE *p_file = fopen(p_path, "r");
+
+    if (NULL == p_file)
+    {
+        perror(p_path);
+
+        return false;
+    }
+
+    char line[128];
+
+    while ((NULL != fgets(line, (int)sizeof(line), p_file)) &&
+           (RENDER_SPEED_POINT_MAX > m_speed_cnt))
+    {
+        render_speed_t *p_point = &m_speed[m_speed_cnt];
+
+        if ('#' == line[0U])
+        {
+            continue;
+        }
+
+        if (2 == sscanf(line, "%lf %lf", &p_point->time_s, &p_point->speed_kmh))
+        {
+            m_speed_cnt++;
+        }
+    }
+
+    (void)fclose(p_file);
+
+    return true;
+}
+
+/**
+ * @brief Gives the speed of the profile at a time in 1/256 km/h.
+ *
+ */
+static uint16_t speed_get(double time_s)
+{
+    double speed = 0.0;
+
+    if (0U != m_speed_cnt)
+    {
+        speed = m_speed[m_speed_cnt - 1U].speed_kmh;
+    }
+
+    for (uint32_t idx = 0U; idx < m_speed_cnt; idx++)
+    {
+        const render_speed_t *p_end = &m_speed[idx];
+
+        if (time_s >= p_end->time_s)
+        {
+            continue;
+        }
+
+        speed = p_end->speed_kmh;
+
+        if (0U != idx)
+        {
+            const render_speed_t *p_start = &m_speed[idx - 1U];
+
+            double frac = (time_s - p_start->time_s) /
+                          (p_end->time_s - p_start->time_s);
+
+            speed = p_start->speed_kmh +
+                    ((p_end->speed_kmh - p_start->speed_kmh) * frac);
+        }
+
+        break;
+    }
+
+    speed *= (double)(1U << API_AUDIO_SPEED_SHIFT);
+
+    if (0.0 > speed)
+    {
+        speed = 0.0;
+    }
+
+    if ((double)UINT16_MAX < speed)
+    {
+        speed = (double)UINT16_MAX;
+    }
+
+    return (uint16_t)speed;
+}
+
+/**
+ * @brief Writes a little-endian field of the WAV header.
+ *
+ */
+static void wav_put(uint8_t *p_hdr, uint32_t val, uint32_t size)
+{
+    for (uint32_t idx = 0U; idx < size; idx++)
+    {
+        p_hdr[idx] = (uint8_t)(val >> (idx * 8U));
+    }
+}
+
+/**
+ * @brief Writes the header of a 32-bit stereo PCM WAV file.
+ *
+ */
+static void wav_hdr_write(FILE *p_file, uint32_t data_size, uint32_t rate)
+{
+    uint8_t hdr[WAV_HDR_SIZE];
+
+    uint32_t block_align = RENDER_CH_CNT * 4U;
+
+    (void)memcpy(&hdr[0U], "RIFF", 4U);
+    wav_put(&hdr[4U], data_size + WAV_HDR_SIZE - 8U, 4U);
+    (void)memcpy(&hdr[8U], "WAVEfmt ", 8U);
+    wav_put(&hdr[16U], 16U, 4U);
+    wav_put(&hdr[20U], 1U, 2U);
+    wav_put(&hdr[22U], RENDER_CH_CNT, 2U);
+    wav_put(&hdr[24U], rate, 4U);
+    wav_put(&hdr[28U], rate * block_align, 4U);
+    wav_put(&hdr[32U], block_align, 2U);
+    wav_put(&hdr[34U], 32U, 2U);
+    (void)memcpy(&hdr[36U], "data", 4U);
+    wav_put(&hdr[40U], data_size, 4U);
+
+    (void)fseek(p_file, 0L, SEEK_SET);
+    (void)fwrite(hdr, 1U, sizeof(hdr), p_file);
+}
+
+/**
+ * @brief Runs api_audio_process() once and times it.
+ *
+ */
+static void process_run(void)
+{
+    AUDIO_PROFILE_BEGIN(AUDIO_PROFILE_PROCESS);
+
+    api_audio_process();
+
+    g_audio_profile[AUDIO_PROFILE_PROCESS].total_ns +=
+        bench_now_ns() - g_audio_profile[AUDIO_PROFILE_PROCESS].start_ns;
+}
+
+/**
+ * @brief Prints the cost of each stage.
+ *
+ */
+static void profile_report(uint32_t slot_cnt, double time_s)
+{
+    // The whole process is reported per played slot.
+    g_audio_profile[AUDIO_PROFILE_PROCESS].block_cnt = slot_cnt;
+
+    double slot_per_s = (double)slot_cnt / time_s;
+
+    printf("%-28s %8s %12s %12s %9s\n",
+           "stage", "blocks", "ns/block", "blocks/s", "RT load");
+
+    for (uint32_t stage = 0U; stage < AUDIO_PROFILE_STAGE_CNT; stage++)
+    {
+        const audio_profile_t *p_profile = &g_audio_profile[stage];
+
+        if (0U == p_profile->block_cnt)
+        {
+            printf("%-28s %8u %12s %12s %9s\n",
+                   mp_stage_name[stage], 0U, "-", "-", "-");
+
+            continue;
+        }
+
+        double ns_block = (double)p_profile->total_ns /
+                          (double)p_profile->block_cnt;
+
+        double load = (ns_block * slot_per_s) / 1e9 * 100.0;
+
+        printf("%-28s %8u %12.1f %12.0f %8.3f%%\n",
+               mp_stage_name[stage],
+               p_profile->block_cnt,
+               ns_block,
+               1e9 / ns_block,
+               load);
+    }
+}
+
+/**
+ * @brief Prints the usage of the tool.
+ *
+ */
+static int usage(const char *p_name)
+{
+    fprintf(stderr,
+            "usage: %s [-a audio] [-s speed.txt] [-t seconds] [-c calls] "
+            "[-v level] [-w audio] [-x seconds] [-p 0|1] "
+            "<flash.bin> <out.wav>\n",
+            p_name);
+
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t audio = 0U;
+    double duration_s = 10.0;
+    uint32_t call_cnt = 3U;
+    const char *p_speed_path = NULL;
+    uint32_t switch_audio = RENDER_SWITCH_NONE;
+    double switch_s = 1.0;
+    bool prefetch = true;
+
+    int arg = 1;
+
+    for (; (arg + 1) < argc; arg += 2)
+    {
+        const char *p_opt = argv[arg];
+        const char *p_val = argv[arg + 1];
+
+        if ('-' != p_opt[0U])
+        {
+            break;
+        }
+
+        switch (p_opt[1U])
+        {
+        case 'a':
+            audio = (uint32_t)strtoul(p_val, NULL, 0);
+            break;
+
+        case 's':
+            p_speed_path = p_val;
+            break;
+
+        case 't':
+            duration_s = strtod(p_val, NULL);
+            break;
+
+        case 'c':
+            call_cnt = (uint32_t)strtoul(p_val, NULL, 0);
+            break;
+
+        case 'v':
+            host_log_level_set((uint8_t)strtoul(p_val, NULL, 0));
+            break;
+
+        case 'w':
+            switch_audio = (uint32_t)strtoul(p_val, NULL, 0);
+            break;
+
+        case 'x':
+            switch_s = strtod(p_val, NULL);
+            break;
+
+        case 'p':
+            prefetch = (0UL != strtoul(p_val, NULL, 0));
+            break;
+
+        default:
+            return usage(argv[0U]);
+        }
+    }
+
+    if ((arg + 2) != argc)
+    {
+        return usage(argv[0U]);
+    }
+
+    if ((false == host_flash_load(argv[arg])) ||
+        ((NULL != p_speed_path) && (false == speed_load(p_speed_path))))
+    {
+        return 1;
+    }
+
+    FILE *p_wav = fopen(argv[arg + 1], "wb");
+
+    if (NULL == p_wav)
+    {
+        perror(argv[arg + 1]);
+
+        host_flash_free();
+
+        return 1;
+    }
+
+    wav_hdr_write(p_wav, 0U, BENCH_SAMPLE_RATE);
+
+    host_eeprom_audio_set((uint8_t)audio);
+
+    if (false == api_audio_init())
+    {
+        fprintf(stderr, "api_audio_init failed\n");
+
+        (void)fclose(p_wav);
+        host_flash_free();
+
+        return 1;
+    }
+
+    for (uint32_t idx = 0U; idx < RENDER_INIT_CALL_CNT; idx++)
+    {
+        process_run();
+    }
+
+    (void)api_audio_play();
+
+    if ((RENDER_SWITCH_NONE != switch_audio) && (true == prefetch))
+    {
+        (void)api_audio_prefetch((uint8_t)switch_audio);
+    }
+
+    static int32_t slot[RENDER_SLOT_FRAME_CNT * RENDER_CH_CNT];
+
+    uint32_t slot_cnt = 0U;
+    uint32_t data_size = 0U;
+    uint32_t next_speed_ms = 0U;
+
+    double time_s = 0.0;
+
+    while (time_s < duration_s)
+    {
+        uint32_t time_ms = (uint32_t)(time_s * 1000.0);
+
+        host_mcu_tick_set(time_ms);
+
+        if ((RENDER_SWITCH_NONE != switch_audio) && (time_s >= switch_s))
+        {
+            if (false == api_audio_switch((uint8_t)switch_audio))
+            {
+                fprintf(stderr, "api_audio_switch failed\n");
+            }
+
+            switch_audio = RENDER_SWITCH_NONE;
+        }
+
+        if (time_ms >= next_speed_ms)
+        {
+            api_audio_speed_update(speed_get((double)time_ms / 1000.0));
+
+            next_speed_ms += RENDER_SPEED_PERIOD_MS;
+        }
+
+        for (uint32_t call = 0U; call < call_cnt; call++)
+        {
+            process_run();
+        }
+
+        uint32_t size = host_i2s_tick(slot, (uint32_t)sizeof(slot));
+
+        if (0U == size)
+        {
+            (void)memset(slot, 0, sizeof(slot));
+
+            size = (uint32_t)sizeof(slot);
+        }
+
+        data_size += (uint32_t)fwrite(slot, 1U, size, p_wav);
+
+        time_s += (double)(size / (RENDER_CH_CNT * sizeof(int32_t))) /
+                  (double)host_i2s_rate_get();
+
+        slot_cnt++;
+    }
+
+    wav_hdr_write(p_wav, data_size, host_i2s_rate_get());
+
+    (void)fclose(p_wav);
+
+    uint32_t byte_cnt = 0U;
+    uint32_t read_cnt = host_flash_read_cnt_get(&byte_cnt);
+
+    api_audio_diag_t diag = {0U};
+
+    (void)api_audio_diag_get(&diag);
+
+    printf("audio_render: %.2f s at %u Hz, %u slots, underrun %u, "
+           "flash reads %u (%u bytes)\n",
+           time_s,
+           host_i2s_rate_get(),
+           slot_cnt,
+           diag.underrun_cnt,
+           read_cnt,
+           byte_cnt);
+
+    if (API_AUDIO_HEADROOM_NONE == diag.headroom_min_us)
+    {
+        printf("refills %u, late %u\n", diag.refill_cnt, diag.late_cnt);
+    }
+    else
+    {
+        printf("refills %u, late %u, min headroom %u us\n",
+               diag.refill_cnt,
+               diag.late_cnt,
+               diag.headroom_min_us);
+    }
+
+    if (0U != diag.switch_cnt)
+    {
+        printf("switches %u (fast %u), last latency %u ms, max %u ms\n",
+               diag.switch_cnt,
+               diag.switch_fast_cnt,
+               diag.switch_last_ms,
+               diag.switch_max_ms);
+    }
+
+    printf("i2s irqs %u (ring %u, silence %u), silences %u, %u ms\n",
+           diag.irq_ring_cnt + diag.irq_silence_cnt,
+           diag.irq_ring_cnt,
+           diag.irq_silence_cnt,
+           diag.silence_cnt,
+           diag.silence_ms);
+
+    printf("crc checks ok %u, fail %u\n", diag.crc_ok_cnt, diag.crc_fail_cnt);
+
+    printf("blocks direct %u, edited %u\n",
+           diag.block_direct_cnt,
+           diag.block_edit_cnt);
+
+    profile_report(slot_cnt, time_s);
+
+    api_audio_deinit();
+
+    host_flash_free();
+
+    return 0;
+}
+
+// end of file
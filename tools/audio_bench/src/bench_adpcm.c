@@ -0,0 +1,151 @@
+/**
+ * @file bench_adpcm.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Compares the SPI flash traffic and the CPU cost per second of audio
+ *         of the raw PCM slots and the IMA-ADPCM slots.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The raw PCM is copied by the SPI DMA, so its CPU cost is only the flash
+ * traffic. The ADPCM slots trade the traffic for the decoder, which is
+ * measured here together with the round trip error.
+ *
+ */
+
+#include "bench_common.h"
+
+#include "adpcm_encoder.h"
+
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief Frame count of the test signal, one second of audio.
+ *
+ */
+#define SIGNAL_FRAME_CNT (BENCH_SAMPLE_RATE)
+
+/**
+ * @brief Block count of the test signal.
+ *
+ */
+#define SIGNAL_BLOCK_CNT                                                  \
+    ((SIGNAL_FRAME_CNT + DSP_ADPCM_BLOCK_FRAME_CNT - 1U) /                 \
+     DSP_ADPCM_BLOCK_FRAME_CNT)
+
+/**
+ * @brief Pi, M_PI is hidden by the strict C99 mode.
+ *
+ */
+#define SIGNAL_PI (3.14159265358979323846)
+
+/**
+ * @brief SPI clock of the external flash in bit/s, see bsp_spi.c.
+ *
+ */
+#define SPI_BIT_RATE (4000000.0)
+
+/**
+ * @brief Iteration count of the decoder over the test signal.
+ *
+ */
+#define DECODE_ITER_CNT (200U)
+
+int main(void)
+{
+    static int32_t src[SIGNAL_FRAME_CNT * DSP_ADPCM_CH_CNT];
+    static int32_t out[SIGNAL_FRAME_CNT * DSP_ADPCM_CH_CNT];
+    static uint8_t coded[SIGNAL_BLOCK_CNT * DSP_ADPCM_BLOCK_SIZE];
+
+    // Two tones under a slow envelope, close to the AVAS sounds.
+    for (uint32_t frame = 0U; frame < SIGNAL_FRAME_CNT; frame++)
+    {
+        double t = (double)frame / (double)BENCH_SAMPLE_RATE;
+
+        double env = 0.6 + (0.3 * sin(2.0 * SIGNAL_PI * 2.0 * t));
+
+        double val = env * ((0.6 * sin(2.0 * SIGNAL_PI * 440.0 * t)) +
+                            (0.3 * sin(2.0 * SIGNAL_PI * 1250.0 * t)));
+
+        src[frame * 2U] = (int32_t)(val * 1073741824.0);
+        src[(frame * 2U) + 1U] = (int32_t)(val * 0.8 * 1073741824.0);
+    }
+
+    dsp_adpcm_t enc = {0};
+
+    uint32_t coded_size = 0U;
+
+    for (uint32_t frame = 0U; frame < SIGNAL_FRAME_CNT;
+         frame += DSP_ADPCM_BLOCK_FRAME_CNT)
+    {
+        uint32_t cnt = SIGNAL_FRAME_CNT - frame;
+
+        cnt = (cnt < DSP_ADPCM_BLOCK_FRAME_CNT) ? cnt
+                                                : DSP_ADPCM_BLOCK_FRAME_CNT;
+
+        coded_size += adpcm_block_encode(&enc, &src[frame * 2U], cnt,
+                                         &coded[coded_size]);
+    }
+
+    uint64_t start = bench_now_ns();
+
+    for (uint32_t it = 0U; it < DECODE_ITER_CNT; it++)
+    {
+        for (uint32_t block = 0U; block < SIGNAL_BLOCK_CNT; block++)
+        {
+            uint32_t frame = block * DSP_ADPCM_BLOCK_FRAME_CNT;
+
+            uint32_t cnt = SIGNAL_FRAME_CNT - frame;
+
+            cnt = (cnt < DSP_ADPCM_BLOCK_FRAME_CNT) ? cnt
+                                                    : DSP_ADPCM_BLOCK_FRAME_CNT;
+
+            const uint8_t *p_block = &coded[block * DSP_ADPCM_BLOCK_SIZE];
+
+            dsp_adpcm_t dec;
+
+            (void)dsp_adpcm_hdr_load(&dec, p_block);
+
+            dsp_adpcm_decode(&dec, &p_block[DSP_ADPCM_HDR_SIZE],
+                             &out[frame * 2U], cnt);
+        }
+    }
+
+    uint64_t decode_ns = (bench_now_ns() - start) / DECODE_ITER_CNT;
+
+    double sig = 0.0;
+    double err = 0.0;
+
+    for (uint32_t idx = 0U; idx < (SIGNAL_FRAME_CNT * 2U); idx++)
+    {
+        double s = (double)src[idx];
+        double e = (double)out[idx] - s;
+
+        sig += s * s;
+        err += e * e;
+    }
+
+    uint32_t pcm_size = SIGNAL_FRAME_CNT * 8U;
+
+    printf("one second of 32-bit stereo audio at %u Hz\n", BENCH_SAMPLE_RATE);
+    printf("%-28s %10u SPI bytes/s %7.1f ms SPI/s %8.1f us CPU/s\n",
+           "raw PCM", pcm_size,
+           ((double)pcm_size * 8.0 * 1000.0) / SPI_BIT_RATE, 0.0);
+    printf("%-28s %10u SPI bytes/s %7.1f ms SPI/s %8.1f us CPU/s\n",
+           "IMA-ADPCM", coded_size,
+           ((double)coded_size * 8.0 * 1000.0) / SPI_BIT_RATE,
+           (double)decode_ns / 1000.0);
+
+    bench_report("dsp_adpcm_decode", decode_ns, SIGNAL_BLOCK_CNT,
+                 DSP_ADPCM_BLOCK_FRAME_CNT);
+
+    printf("compression %.2f:1, round trip SNR %.1f dB\n",
+           (double)pcm_size / (double)coded_size,
+           10.0 * log10(sig / err));
+
+    return 0;
+}
+
+// end of file
@@ -0,0 +1,194 @@
+/**
+ * @file bench_biquad.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Measures the cost of the speaker EQ cascade per stereo frame and
+ *         its error against a double precision reference.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The host time does not translate to the target, so the cycles per frame of
+ * the Cortex-M0+ are estimated from the Thumb-1 sequence of one stage and
+ * compared to the cycle budget of a frame at 16 kHz.
+ *
+ */
+
+#include "bench_common.h"
+
+#include "dsp_chain.h"
+
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief Core clock of the S32K116 in Hz.
+ *
+ */
+#define M0_CORE_CLOCK (48000000U)
+
+/**
+ * @brief Estimated Cortex-M0+ cycles of one stage and one sample: 9 loads
+ *        (2 cycles each), 5 single cycle multiplies, 5 adds, 3 for the shift
+ *        and the fraction, 4 for the saturation and 3 stores (2 cycles each).
+ *
+ */
+#define M0_STAGE_CYCLES (41U)
+
+/**
+ * @brief Estimated Cortex-M0+ cycles of one frame outside of the stages: the
+ *        loads and stores of the samples, the calls and the Q15 gains.
+ *
+ */
+#define M0_FRAME_CYCLES (60U)
+
+/**
+ * @brief Pi, M_PI is not part of C99.
+ *
+ */
+#define BENCH_PI (3.14159265358979323846)
+
+/**
+ * @brief Fills one stage with a peaking EQ of the audio EQ cookbook.
+ *
+ */
+static void peak_coef_get(double *p_coef, double freq, double gain_db, double q)
+{
+    double amp = pow(10.0, gain_db / 40.0);
+    double w0 = (2.0 * BENCH_PI * freq) / (double)BENCH_SAMPLE_RATE;
+    double alpha = sin(w0) / (2.0 * q);
+    double a0 = 1.0 + (alpha / amp);
+
+    p_coef[0U] = (1.0 + (alpha * amp)) / a0;
+    p_coef[1U] = (-2.0 * cos(w0)) / a0;
+    p_coef[2U] = (1.0 - (alpha * amp)) / a0;
+    p_coef[3U] = (-2.0 * cos(w0)) / a0;
+    p_coef[4U] = (1.0 - (alpha / amp)) / a0;
+}
+
+int main(void)
+{
+    static int32_t src[BENCH_BLOCK_FRAME_CNT * DSP_CHAIN_CH_CNT];
+    static int32_t buff[BENCH_BLOCK_FRAME_CNT * DSP_CHAIN_CH_CNT];
+
+    // Typical speaker compensation: low shelf lift, housing notch, presence.
+    const double peaks[DSP_BIQUAD_STAGE_MAX][3U] = {
+        {150.0, 6.0, 0.7},
+        {900.0, -4.0, 2.0},
+        {2500.0, 3.0, 1.0},
+        {5000.0, -3.0, 0.7},
+    };
+
+    double coef_ref[DSP_BIQUAD_STAGE_MAX][DSP_BIQUAD_COEF_CNT];
+    int16_t coef[DSP_BIQUAD_STAGE_MAX][DSP_BIQUAD_COEF_CNT];
+
+    for (uint32_t stage = 0U; stage < DSP_BIQUAD_STAGE_MAX; stage++)
+    {
+        peak_coef_get(coef_ref[stage], peaks[stage][0U], peaks[stage][1U],
+                      peaks[stage][2U]);
+
+        for (uint32_t idx = 0U; idx < DSP_BIQUAD_COEF_CNT; idx++)
+        {
+            coef[stage][idx] = (int16_t)lrint(coef_ref[stage][idx] *
+                                              DSP_BIQUAD_COEF_UNITY);
+        }
+    }
+
+    // The peaks lift the signal, so the test signal is kept at -12 dBFS.
+    bench_signal_fill(src, BENCH_BLOCK_FRAME_CNT * DSP_CHAIN_CH_CNT);
+
+    for (uint32_t idx = 0U; idx < (BENCH_BLOCK_FRAME_CNT * 2U); idx++)
+    {
+        src[idx] /= 2;
+    }
+
+    uint32_t budget = M0_CORE_CLOCK / BENCH_SAMPLE_RATE;
+
+    printf("speaker EQ, 2 channels, %u frame block, %u Hz, "
+           "M0+ budget %u cycles/frame\n",
+           BENCH_BLOCK_FRAME_CNT, BENCH_SAMPLE_RATE, budget);
+
+    for (uint32_t stage_cnt = 1U; stage_cnt <= DSP_BIQUAD_STAGE_MAX;
+         stage_cnt++)
+    {
+        dsp_chain_t chain;
+
+        dsp_chain_init(&chain);
+
+        for (uint32_t ch = 0U; ch < DSP_CHAIN_CH_CNT; ch++)
+        {
+            (void)dsp_chain_eq_set(&chain, ch, coef[0U], stage_cnt);
+        }
+
+        uint64_t start = bench_now_ns();
+
+        for (uint32_t it = 0U; it < BENCH_ITER_CNT; it++)
+        {
+            memcpy(buff, src, sizeof(buff));
+
+            dsp_chain_process(&chain, buff, BENCH_BLOCK_FRAME_CNT);
+        }
+
+        uint64_t elapsed_ns = bench_now_ns() - start;
+
+        // The error of the left channel over one block, after the history of
+        // the benchmark loop is cleared.
+        double hist[DSP_BIQUAD_STAGE_MAX + 1U][2U] = {{0.0}};
+        double err_pow = 0.0;
+        double sig_pow = 0.0;
+
+        (void)dsp_chain_eq_set(&chain, 0U, coef[0U], stage_cnt);
+
+        memcpy(buff, src, sizeof(buff));
+
+        dsp_chain_process(&chain, buff, BENCH_BLOCK_FRAME_CNT);
+
+        for (uint32_t frame = 0U; frame < BENCH_BLOCK_FRAME_CNT; frame++)
+        {
+            double in = (double)src[frame * 2U] / 65536.0;
+
+            for (uint32_t stage = 0U; stage < stage_cnt; stage++)
+            {
+                const double *p_c = coef_ref[stage];
+
+                double out = (p_c[0U] * in) + (p_c[1U] * hist[stage][0U]) +
+                             (p_c[2U] * hist[stage][1U]) -
+                             (p_c[3U] * hist[stage + 1U][0U]) -
+                             (p_c[4U] * hist[stage + 1U][1U]);
+
+                hist[stage][1U] = hist[stage][0U];
+                hist[stage][0U] = in;
+
+                in = out;
+            }
+
+            hist[stage_cnt][1U] = hist[stage_cnt][0U];
+            hist[stage_cnt][0U] = in;
+
+            double diff = ((double)buff[frame * 2U] / 65536.0) - in;
+
+            err_pow += diff * diff;
+            sig_pow += in * in;
+        }
+
+        uint32_t cycles = (stage_cnt * M0_STAGE_CYCLES * DSP_CHAIN_CH_CNT) +
+                          M0_FRAME_CYCLES;
+
+        char name[64];
+
+        (void)snprintf(name, sizeof(name), "dsp_chain EQ %u stage%s",
+                       stage_cnt, (1U == stage_cnt) ? "" : "s");
+
+        bench_report(name, elapsed_ns, BENCH_ITER_CNT, BENCH_BLOCK_FRAME_CNT);
+
+        printf("  M0+ estimate %4u cycles/frame %5.1f %% CPU, "
+               "SNR vs double %5.1f dB\n",
+               cycles,
+               ((double)cycles * 100.0) / (double)budget,
+               10.0 * log10(sig_pow / (err_pow + 1e-12)));
+    }
+
+    return 0;
+}
+
+// end of file
@@ -0,0 +1,107 @@
+/**
+ * @file bench_common.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Common helpers of the host-side audio DSP benchmarks.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief Size of one audio block in bytes, same as AUDIO_BUFF_SIZE.
+ *
+ */
+#define BENCH_BLOCK_SIZE (2048U)
+
+/**
+ * @brief Frame count of one 32-bit stereo audio block.
+ *
+ */
+#define BENCH_BLOCK_FRAME_CNT (BENCH_BLOCK_SIZE / 8U)
+
+/**
+ * @brief Sample rate of the test assets in Hz.
+ *
+ */
+#define BENCH_SAMPLE_RATE (16000U)
+
+/**
+ * @brief Default iteration count of a benchmark.
+ *
+ */
+#define BENCH_ITER_CNT (20000U)
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Returns the monotonic time in nanoseconds.
+ *
+ */
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Fills the buffer with a deterministic pseudo random 32-bit stereo
+ *        signal at about -6 dBFS.
+ *
+ */
+static inline void bench_signal_fill(int32_t *p_buff, uint32_t cnt)
+{
+    uint32_t seed = 0x1234567U;
+
+    for (uint32_t idx = 0U; idx < cnt; idx++)
+    {
+        seed = (seed * 1664525U) + 1013904223U;
+
+        p_buff[idx] = (int32_t)seed >> 1;
+    }
+}
+
+/**
+ * @brief Prints one benchmark result line.
+ *
+ */
+static inline void bench_report(const char *p_name,
+                                uint64_t elapsed_ns,
+                                uint32_t iter_cnt,
+                                uint32_t frame_cnt)
+{
+    double ns_block = (double)elapsed_ns / (double)iter_cnt;
+
+    double ns_frame = ns_block / (double)frame_cnt;
+
+    // Share of one CPU needed to keep up with real time playback.
+    double load = (ns_frame * (double)BENCH_SAMPLE_RATE) / 1e9 * 100.0;
+
+    printf("%-28s %10.1f ns/block %8.2f ns/frame %7.3f %% RT load\n",
+           p_name, ns_block, ns_frame, load);
+}
+
+#endif /* BENCH_COMMON_H */
+
+// end of file
@@ -0,0 +1,141 @@
+/**
+ * @file bench_crc32.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Compares the slice-by-4 CRC-32 kernel with the bitwise and the
+ *         byte table CRC loops.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * api_audio checks the audio read for the playback, so the load is given at
+ * the flash byte rate of the 32-bit stereo slots, the heaviest format.
+ *
+ */
+
+#include "bench_common.h"
+
+#include "crc32.h"
+
+/**
+ * @brief Reflected polynomial of the CRC.
+ *
+ */
+#define CRC_POLY (0xEDB88320U)
+
+/**
+ * @brief Flash byte rate of the 32-bit stereo slots at the bench rate.
+ *
+ */
+#define CRC_AUDIO_BYTE_RATE (BENCH_SAMPLE_RATE * 8U)
+
+/**
+ * @brief Byte table of the byte loop.
+ *
+ */
+static uint32_t m_byte_tbl[256U];
+
+/**
+ * @brief CRC computed one bit at a time.
+ *
+ */
+static uint32_t crc_bitwise(uint32_t crc, const uint8_t *p_data, uint32_t size)
+{
+    uint32_t reg = ~crc;
+
+    for (uint32_t idx = 0U; idx < size; idx++)
+    {
+        reg ^= p_data[idx];
+
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            reg = (0U != (reg & 1U)) ? ((reg >> 1U) ^ CRC_POLY) : (reg >> 1U);
+        }
+    }
+
+    return ~reg;
+}
+
+/**
+ * @brief CRC computed one byte at a time with a 256-entry table.
+ *
+ */
+static uint32_t crc_byte(uint32_t crc, const uint8_t *p_data, uint32_t size)
+{
+    uint32_t reg = ~crc;
+
+    for (uint32_t idx = 0U; idx < size; idx++)
+    {
+        reg = m_byte_tbl[(reg ^ p_data[idx]) & 0xFFU] ^ (reg >> 8U);
+    }
+
+    return ~reg;
+}
+
+/**
+ * @brief Times a CRC loop over the block and prints its throughput.
+ *
+ */
+static void crc_report(const char *p_name,
+                       uint32_t (*p_crc)(uint32_t, const uint8_t *, uint32_t),
+                       const uint8_t *p_block,
+                       uint32_t iter_cnt)
+{
+    volatile uint32_t sink = 0U;
+
+    uint64_t start = bench_now_ns();
+
+    for (uint32_t it = 0U; it < iter_cnt; it++)
+    {
+        sink ^= p_crc(CRC32_INIT, p_block, BENCH_BLOCK_SIZE);
+    }
+
+    uint64_t elapsed_ns = bench_now_ns() - start;
+
+    double mb_s = ((double)BENCH_BLOCK_SIZE * (double)iter_cnt * 1000.0) /
+                  (double)elapsed_ns;
+
+    double load = ((double)CRC_AUDIO_BYTE_RATE / (mb_s * 1e6)) * 100.0;
+
+    (void)sink;
+
+    printf("%-28s %10.1f MB/s %7.3f %% RT load\n", p_name, mb_s, load);
+}
+
+int main(void)
+{
+    static int32_t block[BENCH_BLOCK_SIZE / 4U];
+
+    bench_signal_fill(block, BENCH_BLOCK_SIZE / 4U);
+
+    for (uint32_t idx = 0U; idx < 256U; idx++)
+    {
+        uint8_t byte = (uint8_t)idx;
+
+        m_byte_tbl[idx] = ~crc_bitwise(0xFFFFFFFFU, &byte, 1U);
+    }
+
+    const uint8_t *p_block = (const uint8_t *)block;
+
+    uint32_t ref = crc_bitwise(CRC32_INIT, p_block, BENCH_BLOCK_SIZE);
+
+    printf("CRC-32, %u byte block (crc %08X), %u bytes/s audio\n",
+           BENCH_BLOCK_SIZE, ref, CRC_AUDIO_BYTE_RATE);
+
+    if ((ref != crc_byte(CRC32_INIT, p_block, BENCH_BLOCK_SIZE)) ||
+        (ref != crc32_update(CRC32_INIT, p_block, BENCH_BLOCK_SIZE)))
+    {
+        printf("CRC mismatch\n");
+
+        return 1;
+    }
+
+    crc_report("bitwise", crc_bitwise, p_block, BENCH_ITER_CNT / 8U);
+    crc_report("byte table", crc_byte, p_block, BENCH_ITER_CNT);
+    crc_report("crc32_update (slice-by-4)", crc32_update, p_block,
+               BENCH_ITER_CNT);
+
+    return 0;
+}
+
+// end of file
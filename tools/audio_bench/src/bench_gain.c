@@ -0,0 +1,116 @@
+/**
+ * @file bench_gain.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Compares the legacy per-byte double gain loop of api_audio with the
+ *         fixed-point dsp_gain kernel.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The host has a hardware FPU, so the measured gap is a lower bound of the
+ * gap on the Cortex-M0+, where every double multiply is a library call.
+ *
+ */
+
+#include "bench_common.h"
+
+#include "dsp_gain.h"
+
+#include <string.h>
+
+/**
+ * @brief Copy of the audio_buff_db_edit body before the fixed-point rework.
+ *
+ */
+static void legacy_db_edit(uint8_t *p_buff, uint32_t size, uint16_t gain)
+{
+    double calculated_gain = (double)gain / 1000.0;
+
+    if (1.0 == calculated_gain)
+    {
+        return;
+    }
+
+    for (uint32_t idx = 0U; idx < size; idx++)
+    {
+        p_buff[idx] = (uint8_t)((double)p_buff[idx] * calculated_gain);
+    }
+}
+
+int main(void)
+{
+    static int32_t src[BENCH_BLOCK_SIZE / 4U];
+    static int32_t buff[BENCH_BLOCK_SIZE / 4U];
+
+    const uint16_t gain = 900U;
+
+    bench_signal_fill(src, BENCH_BLOCK_SIZE / 4U);
+
+    printf("gain stage, %u byte block, gain %u/1000\n", BENCH_BLOCK_SIZE, gain);
+
+    uint64_t start = bench_now_ns();
+
+    for (uint32_t it = 0U; it < BENCH_ITER_CNT; it++)
+    {
+        memcpy(buff, src, sizeof(buff));
+
+        legacy_db_edit((uint8_t *)buff, BENCH_BLOCK_SIZE, gain);
+    }
+
+    uint64_t legacy_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+
+    for (uint32_t it = 0U; it < BENCH_ITER_CNT; it++)
+    {
+        memcpy(buff, src, sizeof(buff));
+
+        dsp_gain_s32_apply(buff,
+                           BENCH_BLOCK_SIZE / 4U,
+                           dsp_gain_q15_get(gain, 1000U));
+    }
+
+    uint64_t fixed_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+
+    for (uint32_t it = 0U; it < BENCH_ITER_CNT; it++)
+    {
+        memcpy(buff, src, sizeof(buff));
+
+        dsp_gain_s32_ramp(buff,
+                          BENCH_BLOCK_FRAME_CNT,
+                          2U,
+                          dsp_gain_q15_get(gain, 1000U),
+                          dsp_gain_q15_get(gain + 50U, 1000U));
+    }
+
+    uint64_t ramp_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+
+    for (uint32_t it = 0U; it < BENCH_ITER_CNT; it++)
+    {
+        memcpy(buff, src, sizeof(buff));
+    }
+
+    uint64_t copy_ns = bench_now_ns() - start;
+
+    legacy_ns = (legacy_ns > copy_ns) ? (legacy_ns - copy_ns) : 0U;
+    fixed_ns = (fixed_ns > copy_ns) ? (fixed_ns - copy_ns) : 1U;
+    ramp_ns = (ramp_ns > copy_ns) ? (ramp_ns - copy_ns) : 1U;
+
+    bench_report("legacy double per byte", legacy_ns, BENCH_ITER_CNT,
+                 BENCH_BLOCK_FRAME_CNT);
+    bench_report("dsp_gain_s32_apply (Q15)", fixed_ns, BENCH_ITER_CNT,
+                 BENCH_BLOCK_FRAME_CNT);
+    bench_report("dsp_gain_s32_ramp (Q15)", ramp_ns, BENCH_ITER_CNT,
+                 BENCH_BLOCK_FRAME_CNT);
+
+    printf("speed-up: %.1fx\n", (double)legacy_ns / (double)fixed_ns);
+
+    return 0;
+}
+
+// end of file
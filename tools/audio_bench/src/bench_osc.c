@@ -0,0 +1,71 @@
+/**
+ * @file bench_osc.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Measures the cost of the wavetable oscillators per audio block.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The synthesized audio needs no SPI traffic, its whole cost is the render
+ * below, which only depends on the oscillator count.
+ *
+ */
+
+#include "bench_common.h"
+
+#include "dsp_osc.h"
+
+/**
+ * @brief Input frame count of one api_audio block at the highest pitch.
+ *
+ */
+#define BLOCK_IN_CNT (248U)
+
+/**
+ * @brief Highest oscillator count of a synthesized audio.
+ *
+ */
+#define OSC_CNT_MAX (3U)
+
+int main(void)
+{
+    static int32_t buff[BLOCK_IN_CNT * DSP_OSC_CH_CNT];
+
+    dsp_osc_t osc[OSC_CNT_MAX];
+
+    const dsp_osc_wave_t waves[OSC_CNT_MAX] = {
+        DSP_OSC_WAVE_SAW, DSP_OSC_WAVE_SQUARE, DSP_OSC_WAVE_SINE,
+    };
+
+    const uint32_t freqs[OSC_CNT_MAX] = {110U, 220U, 660U};
+
+    printf("wavetable oscillators, %u frame block\n", BLOCK_IN_CNT);
+
+    for (uint32_t cnt = 1U; cnt <= OSC_CNT_MAX; cnt++)
+    {
+        for (uint32_t idx = 0U; idx < cnt; idx++)
+        {
+            (void)dsp_osc_init(&osc[idx], waves[idx], freqs[idx],
+                               BENCH_SAMPLE_RATE, 32768U / cnt);
+        }
+
+        uint64_t start = bench_now_ns();
+
+        for (uint32_t it = 0U; it < BENCH_ITER_CNT; it++)
+        {
+            dsp_osc_render(osc, cnt, buff, BLOCK_IN_CNT);
+        }
+
+        char name[64];
+
+        (void)snprintf(name, sizeof(name), "dsp_osc_render x%u", cnt);
+
+        bench_report(name, bench_now_ns() - start, BENCH_ITER_CNT,
+                     BLOCK_IN_CNT);
+    }
+
+    return 0;
+}
+
+// end of file
@@ -0,0 +1,82 @@
+/**
+ * @file bench_pcm.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Compares the SPI flash traffic and the expansion cost of the PCM
+ *         storage formats against the 32-bit stereo slots.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "bench_common.h"
+
+#include "dsp_pcm.h"
+
+#include <string.h>
+
+/**
+ * @brief Output frame count of one api_audio block.
+ *
+ */
+#define BLOCK_OUT_CNT (32U)
+
+/**
+ * @brief SPI clock of the external flash in bit/s, see bsp_spi.c.
+ *
+ */
+#define SPI_BIT_RATE (4000000.0)
+
+int main(void)
+{
+    static int32_t src[BLOCK_OUT_CNT * 2U];
+    static int32_t buff[BLOCK_OUT_CNT * 2U];
+
+    const uint32_t formats[][2] = {{32U, 2U}, {32U, 1U}, {16U, 2U}, {16U, 1U}};
+
+    bench_signal_fill(src, BLOCK_OUT_CNT * 2U);
+
+    printf("PCM storage, %u frame block, %u Hz\n", BLOCK_OUT_CNT,
+           BENCH_SAMPLE_RATE);
+
+    for (uint32_t idx = 0U; idx < (sizeof(formats) / sizeof(formats[0])); idx++)
+    {
+        uint32_t bit_depth = formats[idx][0];
+        uint32_t ch_cnt = formats[idx][1];
+
+        uint32_t frame_size = dsp_pcm_frame_size_get(bit_depth, ch_cnt);
+
+        uint32_t len = BLOCK_OUT_CNT * frame_size;
+
+        uint8_t *p_in = &((uint8_t *)buff)[sizeof(buff) - len];
+
+        uint64_t start = bench_now_ns();
+
+        for (uint32_t it = 0U; it < BENCH_ITER_CNT; it++)
+        {
+            memcpy(p_in, src, len);
+
+            (void)dsp_pcm_expand(buff, p_in, BLOCK_OUT_CNT, bit_depth, ch_cnt);
+        }
+
+        uint64_t elapsed_ns = bench_now_ns() - start;
+
+        uint32_t spi_byte = BENCH_SAMPLE_RATE * frame_size;
+
+        char name[64];
+
+        (void)snprintf(name, sizeof(name), "%2u-bit %s", bit_depth,
+                       (1U == ch_cnt) ? "mono" : "stereo");
+
+        printf("%-28s %10u SPI bytes/s %7.1f ms SPI/s\n", name, spi_byte,
+               ((double)spi_byte * 8.0 * 1000.0) / SPI_BIT_RATE);
+
+        bench_report("  dsp_pcm_expand", elapsed_ns, BENCH_ITER_CNT,
+                     BLOCK_OUT_CNT);
+    }
+
+    return 0;
+}
+
+// end of file
@@ -0,0 +1,148 @@
+/**
+ * @file bench_resampler.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Compares the legacy memmove frequency shift of api_audio with the
+ *         dsp_resampler kernels over the pitch range.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "bench_common.h"
+
+#include "dsp_resampler.h"
+
+#include <string.h>
+
+/**
+ * @brief Output frame count of one api_audio block.
+ *
+ */
+#define BLOCK_OUT_CNT (32U)
+
+/**
+ * @brief Byte count moved by the last legacy_freq_shift() call. The host
+ *        memmove is vectorised, on the Cortex-M0+ this count is what drives
+ *        the cost of the legacy shift.
+ *
+ */
+static uint32_t m_moved_byte_cnt;
+
+/**
+ * @brief Copy of the audio_buff_freq_shift body before the resampler rework.
+ *
+ */
+static uint32_t legacy_freq_shift(uint8_t *p_src,
+                                  uint32_t max_size,
+                                  uint16_t edit_cnt,
+                                  uint16_t rate)
+{
+    uint32_t removed_sample_cnt = 0U;
+
+    if (0U == rate)
+    {
+        return 0U;
+    }
+
+    uint32_t src_addr_offset = (edit_cnt < rate) ? rate : (uint32_t)(edit_cnt - rate);
+
+    size_t remaining_byte = (size_t)(max_size - edit_cnt);
+
+    m_moved_byte_cnt = 0U;
+
+    while ((src_addr_offset < max_size) && (0U != remaining_byte))
+    {
+        memmove(&p_src[src_addr_offset],
+                &p_src[src_addr_offset + rate],
+                remaining_byte);
+
+        m_moved_byte_cnt += (uint32_t)remaining_byte;
+
+        remaining_byte = (edit_cnt < remaining_byte) ? (remaining_byte - edit_cnt) : 0U;
+
+        src_addr_offset = src_addr_offset + ((uint32_t)edit_cnt - rate);
+
+        removed_sample_cnt += rate;
+    }
+
+    return removed_sample_cnt;
+}
+
+int main(void)
+{
+    static int32_t src[BENCH_BLOCK_SIZE / 4U];
+    static int32_t buff[BENCH_BLOCK_SIZE / 4U];
+
+    const uint16_t edit_cnt = 64U;
+    const uint16_t rates[] = {0U, 8U, 16U, 24U};
+
+    bench_signal_fill(src, BENCH_BLOCK_SIZE / 4U);
+
+    printf("pitch shift, max_sample_cnt %u, cost per output frame\n", edit_cnt);
+
+    for (uint32_t r = 0U; r < (sizeof(rates) / sizeof(rates[0])); r++)
+    {
+        char name[64];
+
+        uint32_t step = ((uint32_t)edit_cnt << DSP_RESAMPLER_STEP_SHIFT) /
+                        (uint32_t)(edit_cnt - rates[r]);
+
+        printf("-- rate %u (x%.3f)\n", rates[r], (double)step / 65536.0);
+
+        uint64_t start = bench_now_ns();
+
+        uint32_t out_frames = 0U;
+
+        for (uint32_t it = 0U; it < BENCH_ITER_CNT; it++)
+        {
+            memcpy(buff, src, sizeof(buff));
+
+            uint32_t removed = legacy_freq_shift((uint8_t *)buff,
+                                                 BENCH_BLOCK_SIZE,
+                                                 edit_cnt,
+                                                 rates[r]);
+
+            out_frames = (BENCH_BLOCK_SIZE - removed) / 8U;
+        }
+
+        (void)snprintf(name, sizeof(name), "legacy memmove");
+        bench_report(name, bench_now_ns() - start, BENCH_ITER_CNT, out_frames);
+
+        printf("%-28s %10u bytes moved per block\n", "", m_moved_byte_cnt);
+
+        for (uint32_t mode = 0U; mode < 2U; mode++)
+        {
+            dsp_resampler_t rs;
+
+            uint32_t phase = dsp_resampler_phase_init_get();
+
+            dsp_resampler_init(&rs, (dsp_resampler_mode_t)mode);
+
+            start = bench_now_ns();
+
+            for (uint32_t it = 0U; it < BENCH_ITER_CNT; it++)
+            {
+                uint32_t in_cnt = dsp_resampler_plan(&phase, BLOCK_OUT_CNT,
+                                                     step, 0);
+
+                int32_t *p_in = &buff[(BENCH_BLOCK_FRAME_CNT - in_cnt) * 2U];
+
+                memcpy(p_in, src, in_cnt * 8U);
+
+                (void)dsp_resampler_process(&rs, p_in, in_cnt, buff,
+                                            BLOCK_OUT_CNT, step, 0);
+            }
+
+            (void)snprintf(name, sizeof(name), "dsp_resampler %s",
+                           (0U == mode) ? "linear" : "cubic");
+            bench_report(name, bench_now_ns() - start, BENCH_ITER_CNT,
+                         BLOCK_OUT_CNT);
+        }
+    }
+
+    return 0;
+}
+
+// end of file
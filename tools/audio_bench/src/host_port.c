@@ -0,0 +1,572 @@
+/**
+ * @file host_port.c
+ * @author Muhammed Salih AYDOGAN
+ * @brief  This module is the implementation of the host stand-ins below
+ *         api_audio.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "host_port.h"
+
+#include "api_data.h"
+#include "bsp_i2s.h"
+#include "bsp_mcu.h"
+#include "drv_amplifier.h"
+#include "drv_flash.h"
+#include "log.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+
+/**
+ * @brief Size of the external flash area of the audio slots.
+ *
+ */
+#define HOST_FLASH_SIZE (API_DATA_FLASH_LAST_DATA - API_DATA_EEPROM_LAST_DATA)
+
+/**
+ * @brief Value of an erased flash byte.
+ *
+ */
+#define HOST_FLASH_ERASED (0xFFU)
+
+/**
+ * @brief Magic value of the audio directory, "ADIR".
+ *
+ */
+#define HOST_AUDIO_DIR_MAGIC (0x41444952U)
+
+/**
+ * @brief Size of the header and of a slot entry of the audio directory.
+ *
+ */
+#define HOST_AUDIO_DIR_HDR_SIZE (8U)
+#define HOST_AUDIO_DIR_ENTRY_SIZE (4U)
+
+/**
+ * @brief Word count of the silence descriptor of bsp_i2s.c, it interrupts once
+ *        per major loop.
+ *
+ */
+#define HOST_I2S_SILENCE_WORD_CNT (0x7FFFU)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+static uint8_t *mp_flash = NULL;
+static uint32_t m_flash_size = 0U;
+
+static uint32_t m_flash_read_cnt = 0U;
+static uint32_t m_flash_byte_cnt = 0U;
+
+static uint8_t m_eeprom_audio = 0U;
+
+static uint8_t m_log_level = LOG_LEVEL_NONE;
+
+static uint32_t m_mcu_tick = 0U;
+
+static bsp_i2s_cb_t mp_i2s_cb = NULL;
+
+static uint8_t *mp_i2s_slot[BSP_I2S_RING_SLOT_MAX] = {NULL};
+static uint32_t m_i2s_slot_cnt = 0U;
+static uint32_t m_i2s_slot_size = 0U;
+static uint32_t m_i2s_play_slot = 0U;
+static bool m_i2s_slot_ready[BSP_I2S_RING_SLOT_MAX] = {false};
+static uint32_t m_i2s_underrun_cnt = 0U;
+static uint32_t m_i2s_sample_rate = BSP_I2S_SAMPLE_RATE_DEFAULT;
+static bool m_i2s_silence = false;
+static uint32_t m_i2s_silence_word = 0U;
+static uint32_t m_i2s_irq_cnt[BSP_I2S_MODE_CNT] = {0U};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Gives the slot count of the audio directory of the image, zero when
+ *        the image has the fixed slots.
+ *
+ */
+static uint8_t host_audio_dir_cnt_get(void)
+{
+    if (NULL == mp_flash)
+    {
+        return 0U;
+    }
+
+    uint32_t magic = ((uint32_t)mp_flash[0U] << 24U) |
+                     ((uint32_t)mp_flash[1U] << 16U) |
+                     ((uint32_t)mp_flash[2U] << 8U) |
+                     (uint32_t)mp_flash[3U];
+
+    if ((HOST_AUDIO_DIR_MAGIC != magic) ||
+        (API_DATA_AUDIO_SLOT_MAX < mp_flash[4U]))
+    {
+        return 0U;
+    }
+
+    return mp_flash[4U];
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+bool host_flash_load(const char *p_path)
+{
+    FILE *p_file = fopen(p_path, "rb");
+
+    if (NULL == p_file)
+    {
+        perror(p_path);
+
+        return false;
+    }
+
+    host_flash_free();
+
+    mp_flash = malloc(HOST_FLASH_SIZE);
+
+    if (NULL == mp_flash)
+    {
+        (void)fclose(p_file);
+
+        return false;
+    }
+
+    m_flash_size = (uint32_t)fread(mp_flash, 1U, HOST_FLASH_SIZE, p_file);
+
+    (void)fclose(p_file);
+
+    (void)memset(&mp_flash[m_flash_size],
+                 HOST_FLASH_ERASED,
+                 HOST_FLASH_SIZE - m_flash_size);
+
+    return true;
+}
+
+void host_flash_free(void)
+{
+    free(mp_flash);
+
+    mp_flash = NULL;
+    m_flash_size = 0U;
+}
+
+uint32_t host_flash_read_cnt_get(uint32_t *p_byte_cnt)
+{
+    *p_byte_cnt = m_flash_byte_cnt;
+
+    return m_flash_read_cnt;
+}
+
+void host_eeprom_audio_set(uint8_t audio)
+{
+    m_eeprom_audio = audio;
+}
+
+void host_log_level_set(uint8_t level)
+{
+    m_log_level = level;
+}
+
+void host_mcu_tick_set(uint32_t tick_ms)
+{
+    m_mcu_tick = tick_ms;
+}
+
+uint32_t host_i2s_tick(int32_t *p_frame, uint32_t max_size)
+{
+    if ((0U == m_i2s_slot_cnt) || (max_size < m_i2s_slot_size))
+    {
+        return 0U;
+    }
+
+    if (true == m_i2s_silence)
+    {
+        (void)memset(p_frame, 0, m_i2s_slot_size);
+
+        // The silence descriptor interrupts once per major loop only.
+        m_i2s_silence_word += m_i2s_slot_size / sizeof(uint32_t);
+
+        while (HOST_I2S_SILENCE_WORD_CNT <= m_i2s_silence_word)
+        {
+            m_i2s_silence_word -= HOST_I2S_SILENCE_WORD_CNT;
+
+            m_i2s_irq_cnt[BSP_I2S_MODE_SILENCE]++;
+        }
+
+        return m_i2s_slot_size;
+    }
+
+    (void)memcpy(p_frame, mp_i2s_slot[m_i2s_play_slot], m_i2s_slot_size);
+
+    m_i2s_irq_cnt[BSP_I2S_MODE_RING]++;
+
+    // The eDMA loads the next descriptor whether the slot is ready or not.
+    uint32_t next = m_i2s_play_slot + 1U;
+
+    if (m_i2s_slot_cnt <= next)
+    {
+        next = 0U;
+    }
+
+    if (false == m_i2s_slot_ready[next])
+    {
+        m_i2s_underrun_cnt++;
+    }
+
+    m_i2s_slot_ready[next] = false;
+
+    m_i2s_play_slot = next;
+
+    if (NULL != mp_i2s_cb)
+    {
+        mp_i2s_cb(BSP_I2S_TX_EMPTY);
+    }
+
+    return m_i2s_slot_size;
+}
+
+uint32_t host_i2s_underrun_cnt_get(void)
+{
+    return m_i2s_underrun_cnt;
+}
+
+uint32_t host_i2s_rate_get(void)
+{
+    return m_i2s_sample_rate;
+}
+
+/*******************************************************************************
+ * api_data
+ ******************************************************************************/
+
+bool api_data_read(uint32_t data_label,
+                   uint8_t *p_data,
+                   size_t size,
+                   uint32_t offset)
+{
+    if (API_DATA_EEPROM_LAST_DATA > data_label)
+    {
+        (void)memset(p_data, 0, size);
+
+        if (API_DATA_LABEL_CURR_AUDIO == data_label)
+        {
+            p_data[0U] = m_eeprom_audio;
+        }
+
+        return true;
+    }
+
+    uint32_t addr = (data_label - API_DATA_EEPROM_LAST_DATA) + offset;
+
+    if ((NULL == mp_flash) || (HOST_FLASH_SIZE < (addr + size)))
+    {
+        return false;
+    }
+
+    (void)memcpy(p_data, &mp_flash[addr], size);
+
+    m_flash_read_cnt++;
+    m_flash_byte_cnt += (uint32_t)size;
+
+    return true;
+}
+
+uint8_t api_data_audio_slot_cnt_get(void)
+{
+    uint8_t slot_cnt = host_audio_dir_cnt_get();
+
+    if (0U == slot_cnt)
+    {
+        slot_cnt = (uint8_t)API_DATA_AUDIO_SLOT_LEGACY_CNT;
+    }
+
+    return slot_cnt;
+}
+
+bool api_data_audio_slot_get(uint8_t audio,
+                             uint32_t *p_label,
+                             uint32_t *p_size)
+{
+    if (api_data_audio_slot_cnt_get() <= audio)
+    {
+        return false;
+    }
+
+    if (0U == host_audio_dir_cnt_get())
+    {
+        *p_size = API_DATA_AUDIO_CFG_TBL_SIZE + API_DATA_AUDIO_DEFAULT_SIZE;
+        *p_label = API_DATA_LABEL_AUDIO_1_CFG + (*p_size * audio);
+
+        return true;
+    }
+
+    const uint8_t *p_entry = &mp_flash[HOST_AUDIO_DIR_HDR_SIZE +
+                                       (audio * HOST_AUDIO_DIR_ENTRY_SIZE)];
+
+    uint32_t sector = ((uint32_t)p_entry[0U] << 8U) | p_entry[1U];
+    uint32_t sector_cnt = ((uint32_t)p_entry[2U] << 8U) | p_entry[3U];
+
+    *p_label = API_DATA_EEPROM_LAST_DATA + (sector * DRV_FLASH_CFG_SECTOR_SIZE);
+    *p_size = sector_cnt * DRV_FLASH_CFG_SECTOR_SIZE;
+
+    return true;
+}
+
+bool api_data_dtc_set(uint32_t data_label, uint32_t dtc)
+{
+    fprintf(stderr, "dtc set; label:%u, dtc:%u\n", data_label, dtc);
+
+    return true;
+}
+
+bool api_data_cb_set(api_data_cb_t callback)
+{
+    (void)callback;
+
+    return true;
+}
+
+bool drv_flash_is_busy(void)
+{
+    return false;
+}
+
+/*******************************************************************************
+ * bsp_i2s
+ ******************************************************************************/
+
+bool bsp_i2s_cb_set(bsp_i2s_cb_t callback)
+{
+    mp_i2s_cb = callback;
+
+    return true;
+}
+
+bool bsp_i2s_ring_start(uint8_t *const *pp_slot,
+                        uint32_t slot_cnt,
+                        size_t slot_size)
+{
+    if ((2U > slot_cnt) || (BSP_I2S_RING_SLOT_MAX < slot_cnt) ||
+        (0U != m_i2s_slot_cnt))
+    {
+        return false;
+    }
+
+    for (uint32_t idx = 0U; idx < slot_cnt; idx++)
+    {
+        mp_i2s_slot[idx] = pp_slot[idx];
+
+        m_i2s_slot_ready[idx] = true;
+    }
+
+    m_i2s_slot_ready[0U] = false;
+
+    m_i2s_play_slot = 0U;
+    m_i2s_underrun_cnt = 0U;
+
+    m_i2s_silence = false;
+
+    for (uint32_t mode = 0U; mode < BSP_I2S_MODE_CNT; mode++)
+    {
+        m_i2s_irq_cnt[mode] = 0U;
+    }
+
+    m_i2s_slot_size = (uint32_t)slot_size;
+    m_i2s_slot_cnt = slot_cnt;
+
+    return true;
+}
+
+bool bsp_i2s_ring_stop(void)
+{
+    if (0U == m_i2s_slot_cnt)
+    {
+        return false;
+    }
+
+    m_i2s_slot_cnt = 0U;
+
+    m_i2s_silence = false;
+
+    for (uint32_t idx = 0U; idx < BSP_I2S_RING_SLOT_MAX; idx++)
+    {
+        m_i2s_slot_ready[idx] = false;
+    }
+
+    return true;
+}
+
+bool bsp_i2s_slot_commit(uint32_t slot)
+{
+    if (BSP_I2S_SLOT_STATE_FREE != bsp_i2s_slot_state_get(slot))
+    {
+        return false;
+    }
+
+    m_i2s_slot_ready[slot] = true;
+
+    return true;
+}
+
+bsp_i2s_slot_state_t bsp_i2s_slot_state_get(uint32_t slot)
+{
+    if ((slot >= m_i2s_slot_cnt) || (slot == m_i2s_play_slot))
+    {
+        return BSP_I2S_SLOT_STATE_PLAY;
+    }
+
+    if (true == m_i2s_slot_ready[slot])
+    {
+        return BSP_I2S_SLOT_STATE_READY;
+    }
+
+    return BSP_I2S_SLOT_STATE_FREE;
+}
+
+uint32_t bsp_i2s_underrun_cnt_get(void)
+{
+    return m_i2s_underrun_cnt;
+}
+
+bool bsp_i2s_silence_set(bool enable)
+{
+    if (0U == m_i2s_slot_cnt)
+    {
+        return false;
+    }
+
+    if ((enable == m_i2s_silence) || (true == enable))
+    {
+        m_i2s_silence = enable;
+
+        m_i2s_silence_word = 0U;
+
+        return true;
+    }
+
+    // The ring goes on with the slot after the cut one.
+    uint32_t next = m_i2s_play_slot + 1U;
+
+    if (m_i2s_slot_cnt <= next)
+    {
+        next = 0U;
+    }
+
+    if (false == m_i2s_slot_ready[next])
+    {
+        m_i2s_underrun_cnt++;
+    }
+
+    m_i2s_slot_ready[next] = false;
+
+    m_i2s_play_slot = next;
+
+    m_i2s_silence = false;
+
+    if (NULL != mp_i2s_cb)
+    {
+        mp_i2s_cb(BSP_I2S_TX_EMPTY);
+    }
+
+    return true;
+}
+
+uint32_t bsp_i2s_irq_cnt_get(bsp_i2s_mode_t mode)
+{
+    if (BSP_I2S_MODE_CNT <= mode)
+    {
+        return 0U;
+    }
+
+    return m_i2s_irq_cnt[mode];
+}
+
+bool bsp_i2s_rate_set(uint32_t sample_rate)
+{
+    if ((0U == sample_rate) || (0U != m_i2s_slot_cnt))
+    {
+        return false;
+    }
+
+    m_i2s_sample_rate = sample_rate;
+
+    return true;
+}
+
+/*******************************************************************************
+ * drv_amplifier
+ ******************************************************************************/
+
+bool drv_amplifier_mute(void)
+{
+    return true;
+}
+
+bool drv_amplifier_unmute(void)
+{
+    return true;
+}
+
+bool drv_amplifier_rate_set(uint32_t sample_rate)
+{
+    return ((8000U == sample_rate) || (16000U == sample_rate) ||
+            (32000U == sample_rate) || (48000U == sample_rate));
+}
+
+void drv_amplifier_diag_cb_set(drv_amplifier_diag_cb_t callback)
+{
+    (void)callback;
+}
+
+/*******************************************************************************
+ * bsp_mcu
+ ******************************************************************************/
+
+uint32_t bsp_mcu_tick_get(void)
+{
+    return m_mcu_tick;
+}
+
+/*******************************************************************************
+ * log
+ ******************************************************************************/
+
+void log_print(bool b_buffer,
+               uint8_t level,
+               const char *p_module,
+               uint32_t line,
+               const char *p_str,
+               ...)
+{
+    (void)b_buffer;
+
+    if ((LOG_LEVEL_NONE == m_log_level) || (level < m_log_level))
+    {
+        return;
+    }
+
+    va_list args;
+
+    va_start(args, p_str);
+
+    (void)fprintf(stderr, "[%s:%u] ", p_module, line);
+    (void)vfprintf(stderr, p_str, args);
+    (void)fputc('\n', stderr);
+
+    va_end(args);
+}
+
+// end of file
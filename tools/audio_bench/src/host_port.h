@@ -0,0 +1,109 @@
+/**
+ * @file host_port.h
+ * @author Muhammed Salih AYDOGAN
+ * @brief  Host stand-ins of the modules below api_audio: a file-backed
+ *         external flash, a fake I2S ring, the amplifier, the MCU tick and
+ *         the log.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The flash image is a raw dump of the external flash from address 0, so the
+ * audio slots are at the api_data labels minus API_DATA_EEPROM_LAST_DATA. An
+ * image starting with an audio directory is resolved through it as api_data
+ * does, otherwise the fixed slots are used. The reads complete at once, the
+ * flash is never busy. The I2S ring plays one slot
+ * per host_i2s_tick() call and follows the slot states of bsp_i2s.c. In the
+ * silence mode a tick plays zeros and the interrupts are counted as the
+ * silence descriptor would raise them.
+ *
+ */
+
+#ifndef HOST_PORT_H
+#define HOST_PORT_H
+
+#include "daiichi_types.h"
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Loads the flash image. The bytes after the image read as erased
+ *        flash.
+ *
+ * @param[in] p_path Path of the flash image.
+ *
+ * @return bool Load status.
+ *
+ */
+bool host_flash_load(const char *p_path);
+
+/**
+ * @brief Frees the flash image.
+ *
+ */
+void host_flash_free(void);
+
+/**
+ * @brief Gives the flash read count and the read byte count.
+ *
+ * @param[out] p_byte_cnt Read byte count.
+ *
+ * @return uint32_t Read count.
+ *
+ */
+uint32_t host_flash_read_cnt_get(uint32_t *p_byte_cnt);
+
+/**
+ * @brief Sets the audio number stored in the EEPROM.
+ *
+ * @param[in] audio Audio number.
+ *
+ */
+void host_eeprom_audio_set(uint8_t audio);
+
+/**
+ * @brief Sets the lowest printed log level, LOG_LEVEL_NONE prints nothing.
+ *
+ * @param[in] level Log level.
+ *
+ */
+void host_log_level_set(uint8_t level);
+
+/**
+ * @brief Sets the tick given by bsp_mcu_tick_get(), the render time.
+ *
+ * @param[in] tick_ms Tick in milliseconds.
+ *
+ */
+void host_mcu_tick_set(uint32_t tick_ms);
+
+/**
+ * @brief Plays the current slot of the ring and moves to the next one as the
+ *        eDMA interrupt does.
+ *
+ * @param[out] p_frame  32-bit stereo frames of the played slot.
+ * @param[in]  max_size Size of the frame buffer in bytes.
+ *
+ * @return uint32_t Played byte count, zero while the ring is stopped.
+ *
+ */
+uint32_t host_i2s_tick(int32_t *p_frame, uint32_t max_size);
+
+/**
+ * @brief Gives the underrun count of the ring since it was started.
+ *
+ */
+uint32_t host_i2s_underrun_cnt_get(void);
+
+/**
+ * @brief Gives the sample rate set by bsp_i2s_rate_set().
+ *
+ */
+uint32_t host_i2s_rate_get(void);
+
+#endif /* HOST_PORT_H */
+
+// end of file